@@ -1,5 +1,6 @@
 #include "adiar.h"
 
+#include <cstdlib>
 #include <exception>
 
 #include <tpie/tpie.h>
@@ -9,13 +10,47 @@
 #include <adiar/internal/assert.h>
 #include <adiar/internal/block_size.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/io/temp_dir.h>
 
 namespace adiar
 {
   bool _adiar_initialized = false;
   bool _tpie_initialized  = false;
 
+  //////////////////////////////////////////////////////////////////////////////
+  // TPIE cannot be initialized again after 'tpie::tpie_finish' has been called.
+  //
+  // See: 'https://github.com/thomasmoelhave/tpie/issues/265'
+  //
+  // Hence, 'adiar_deinit()' only cleans up Adiar's own state while TPIE is kept
+  // alive until the program terminates.
+  void __tpie_finish()
+  {
+    if (!_tpie_initialized) return;
+
+    tpie::tpie_finish(tpie::ALL);
+    _tpie_initialized = false;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Set TPIE's memory limit and the block size derived from it.
+  void __set_memory_limit(size_t memory_limit_bytes)
+  {
+    tpie::get_memory_manager().set_limit(memory_limit_bytes);
+    internal::set_block_size(internal::recommended_block_size(memory_limit_bytes));
+  }
+
   void adiar_init(size_t memory_limit_bytes, std::string temp_dir)
+  {
+    if (temp_dir != "") {
+      adiar_init(memory_limit_bytes, std::vector<std::string>{ temp_dir });
+    } else {
+      adiar_init(memory_limit_bytes, std::vector<std::string>());
+    }
+  }
+
+  void adiar_init(size_t memory_limit_bytes,
+                  const std::vector<std::string> &temp_dirs)
   {
     if (_adiar_initialized) {
 #ifndef NDEBUG
@@ -23,37 +58,39 @@ namespace adiar
 #endif
       return;
     }
-    if (!_adiar_initialized && _tpie_initialized) {
-      throw runtime_error("Adiar cannot be initialized after call to 'adiar_deinit()'");
-    }
     if (memory_limit_bytes < minimum_memory) {
       throw invalid_argument("Adiar requires at least "
                              + std::to_string(minimum_memory / 1024 / 1024)
                              + " MiB of memory");
     }
 
-    try {
-      // Initialise TPIE
-      tpie::tpie_init(tpie::ALL);
-
-      // - file names
-      tpie::tempname::set_default_base_name("ADIAR");
-      tpie::tempname::set_default_extension("adiar");
+    const bool tpie_reinit = _tpie_initialized;
 
-      // - tmp directory
-      if (temp_dir != "") {
-        tpie::tempname::set_default_path(temp_dir);
+    try {
+      // Initialise TPIE (unless it is still alive from a prior initialisation)
+      if (!tpie_reinit) {
+        tpie::tpie_init(tpie::ALL);
+        std::atexit(__tpie_finish);
+
+        // - file names
+        tpie::tempname::set_default_base_name("ADIAR");
+        tpie::tempname::set_default_extension("adiar");
       }
 
+      // - tmp directories (an empty path restores TPIE's default, which matters
+      //   when reinitialising after a prior 'adiar_init' with a directory)
+      tpie::tempname::set_default_path(temp_dirs.empty() ? "" : temp_dirs.front());
+      internal::set_temp_dirs(temp_dirs);
+
       // - memory limit and block size
-      tpie::get_memory_manager().set_limit(memory_limit_bytes);
-      internal::set_block_size(internal::recommended_block_size(memory_limit_bytes));
+      __set_memory_limit(memory_limit_bytes);
 
       _tpie_initialized = true;
 
       // Initialise Adiar state
       // - reset statistics
       statistics_reset();
+      internal::disk_peak_reset();
 
       // - all done, mark initialized
       _adiar_initialized = true;
@@ -61,10 +98,12 @@ namespace adiar
       // LCOV_EXCL_START
       // Mark as not initialized.
       _adiar_initialized = false;
-      _tpie_initialized  = true;
 
       // Try to gracefully close down TPIE.
-      tpie::tpie_finish(tpie::ALL);
+      if (!tpie_reinit) {
+        _tpie_initialized = false;
+        tpie::tpie_finish(tpie::ALL);
+      }
 
       // Tell the user what happened.
       throw e;
@@ -77,18 +116,62 @@ namespace adiar
     return _adiar_initialized;
   }
 
+  void adiar_set_memory_limit(size_t memory_limit_bytes)
+  {
+    if (!_adiar_initialized) {
+      throw runtime_error("Adiar is not initialized");
+    }
+    if (memory_limit_bytes < minimum_memory) {
+      throw invalid_argument("Adiar requires at least "
+                             + std::to_string(minimum_memory / 1024 / 1024)
+                             + " MiB of memory");
+    }
+
+    __set_memory_limit(memory_limit_bytes);
+  }
+
+  size_t adiar_memory_limit()
+  {
+    if (!_adiar_initialized) {
+      throw runtime_error("Adiar is not initialized");
+    }
+    return tpie::get_memory_manager().limit();
+  }
+
+  size_t adiar_disk_usage()
+  {
+    return internal::disk_usage();
+  }
+
+  size_t adiar_disk_peak()
+  {
+    return internal::disk_peak();
+  }
+
+  void adiar_disk_peak_reset()
+  {
+    internal::disk_peak_reset();
+  }
+
+  void adiar_set_disk_limit(size_t disk_limit_bytes)
+  {
+    internal::set_disk_limit(disk_limit_bytes);
+  }
+
+  size_t adiar_disk_limit()
+  {
+    return internal::disk_limit();
+  }
+
   void adiar_deinit()
   {
     if (!_adiar_initialized) return;
 
     domain_unset();
+    internal::set_temp_dirs({});
 
-    tpie::tpie_finish(tpie::ALL);
+    // TPIE is kept alive to allow for a later 'adiar_init()'; it is closed down
+    // by '__tpie_finish()' when the program terminates.
     _adiar_initialized = false;
-
-    // TPIE does seem to work after having called 'tpie::tpie_finish' the first
-    // time. Hence, we will not update the _tpie_initialized flag.
-    //
-    // See: 'https://github.com/thomasmoelhave/tpie/issues/265'
   }
 }
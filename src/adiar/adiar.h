@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <string>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 #include <adiar/version.h>
@@ -71,27 +72,113 @@ namespace adiar
   ///
   /// \throws invalid_argument If `memory_limit_bytes` is set to a value less
   ///                          than the `minimum_memory` required.
-  ///
-  /// \throws runtime_error    If `adiar_init()` and then `adiar_deinit()` have
-  ///                          been called previously.
   //////////////////////////////////////////////////////////////////////////////
   void adiar_init(size_t memory_limit_bytes, std::string temp_dir = "");
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Initiates Adiar with the given amount of memory (given in bytes)
+  ///        and multiple directories for temporary files.
+  ///
+  /// \param memory_limit_bytes
+  ///   The amount of internal memory (in bytes) that Adiar is allowed to use.
+  ///   This has to be at least minimum_memory.
+  ///
+  /// \param temp_dirs
+  ///   The directories across which to stripe the temporary files of decision
+  ///   diagrams and of the arcs in-between algorithms, e.g. one per disk. Files
+  ///   are placed in a round-robin fashion, such that the input and the output
+  ///   of an algorithm usually end up on different disks. All other temporary
+  ///   files, e.g. the runs of a sorter, are placed in the first directory.
+  ///
+  /// \throws invalid_argument If `memory_limit_bytes` is set to a value less
+  ///                          than the `minimum_memory` required.
+  //////////////////////////////////////////////////////////////////////////////
+  void adiar_init(size_t memory_limit_bytes,
+                  const std::vector<std::string> &temp_dirs);
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Whether Adiar is initialized.
   //////////////////////////////////////////////////////////////////////////////
   bool adiar_initialized() noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Change the amount of memory (given in bytes) Adiar is allowed to
+  ///        use.
+  ///
+  /// \details The new limit takes effect for the next operation, i.e. all
+  ///          operations that are currently running continue with the memory
+  ///          they already have obtained. The block size is derived anew from
+  ///          the limit, as in `adiar_init`.
+  ///
+  /// \param memory_limit_bytes
+  ///   The amount of internal memory (in bytes) that Adiar is allowed to use.
+  ///   This has to be at least minimum_memory.
+  ///
+  /// \throws invalid_argument If `memory_limit_bytes` is set to a value less
+  ///                          than the `minimum_memory` required.
+  ///
+  /// \throws runtime_error    If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////
+  void adiar_set_memory_limit(size_t memory_limit_bytes);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The amount of memory (given in bytes) Adiar is allowed to use.
+  ///
+  /// \throws runtime_error    If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t adiar_memory_limit();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of bytes on disk currently occupied by Adiar's temporary
+  ///        files, i.e. the files of decision diagrams, of the arcs in-between
+  ///        algorithms, and of external sorters and priority queues.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t adiar_disk_usage();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Largest value of `adiar_disk_usage()` observed since `adiar_init()`
+  ///        or the last call to `adiar_disk_peak_reset()`.
+  ///
+  /// \details The disk usage is sampled whenever an external memory data
+  ///          structure is created and whenever an algorithm moves on to the
+  ///          next level. The peak of each algorithm is available in the
+  ///          statistics of its levelized priority queue, which is recorded
+  ///          also without `ADIAR_STATS`.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t adiar_disk_peak();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Reset `adiar_disk_peak()` to the current disk usage.
+  //////////////////////////////////////////////////////////////////////////////
+  void adiar_disk_peak_reset();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Set the number of bytes Adiar's temporary files may occupy on disk.
+  ///
+  /// \details The limit is checked whenever an external memory data structure
+  ///          is created and whenever an algorithm moves on to the next level.
+  ///          If it is exceeded, then the operation is aborted with a
+  ///          `runtime_error`.
+  //////////////////////////////////////////////////////////////////////////////
+  void adiar_set_disk_limit(size_t disk_limit_bytes);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The number of bytes Adiar's temporary files may occupy on disk. By
+  ///        default, this is the largest value of `size_t`, i.e. unlimited.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t adiar_disk_limit();
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief   Closes and cleans up everything by Adiar
   ///
+  /// \details Afterwards, Adiar can be initialized again with `adiar_init()`.
+  ///          The underlying TPIE library cannot be restarted. Hence, it is
+  ///          kept alive until the program terminates.
+  ///
   /// \warning All of Adiar's file objects must be destructed **before** this
   ///          functions i called. That is, any \ref bdd \ref bdd_builder, \ref
   ///          zdd \ref zdd_builder or any \ref shared_file objects you may be
   ///          using.
-  ///
-  /// \throws runtime_error If compiled with *debug* and one of Adiar's objects
-  ///                       have *not* been destructed.
   //////////////////////////////////////////////////////////////////////////////
   void adiar_deinit();
 
@@ -16,6 +16,7 @@
 
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include <adiar/bool_op.h>
 #include <adiar/exec_policy.h>
@@ -23,8 +24,11 @@
 #include <adiar/types.h>
 
 #include <adiar/bdd/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
 #include <adiar/zdd/zdd.h>
 
+#include <adiar/internal/data_structures/shared_forest.h>
+
 namespace adiar
 {
   //////////////////////////////////////////////////////////////////////////////
@@ -265,6 +269,166 @@ namespace adiar
   bdd bdd_cube(ForwardIt begin, ForwardIt end)
   { return bdd_cube(make_generator(begin, end)); }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDD representing the disjunction of many cubes.
+  ///
+  /// \details     The cubes are first collected as a family of sets of literals
+  ///              with `zdd_from_sets`, i.e. with \f$ O(\mathit{sort}(N)) \f$
+  ///              I/Os for \f$ N \f$ literals. The BDD is then derived from this
+  ///              family with a conjunction and a single existential
+  ///              quantification rather than with \f$ n \f$ calls to `bdd_or`.
+  ///
+  /// \param n     Number of cubes. The cubes are identified by \f$ 0, 1, \dots,
+  ///              n-1 \f$ and a cube without any literals is the constant true.
+  ///
+  /// \param cubes Generator of pairs \f$ (i, (x, \mathit{negated})) \f$ stating
+  ///              that the literal \f$ x \f$ (or \f$ \neg x \f$) is part of the
+  ///              \f$ i \f$th cube. The pairs may be given in any order and may
+  ///              include duplicates.
+  ///
+  /// \returns     \f$ \bigvee_{i < n} c_i \f$
+  ///
+  /// \throws invalid_argument If a cube identifier is not smaller than `n` or
+  ///                          if a variable exceeds
+  ///                          \f$ (\texttt{bdd::max\_label} - 2) / 3 \f$.
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_from_cubes(const size_t n,
+                       const generator<pair<size_t, pair<bdd::label_type, bool>>> &cubes);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD representing the disjunction of many cubes.
+  ///
+  /// \see bdd_from_cubes
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_from_cubes(const exec_policy &ep,
+                       const size_t n,
+                       const generator<pair<size_t, pair<bdd::label_type, bool>>> &cubes);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      The BDD representing that at most `k` of the given variables
+  ///             are true.
+  ///
+  /// \details    The BDD is constructed directly in its canonical form. It has
+  ///             \f$ O(n \cdot k) \f$ nodes for \f$ n \f$ variables.
+  ///
+  /// \remark     Requires internal memory as described for `bdd_linear_leq`
+  ///             (with \f$ \mathit{bound} = k \f$).
+  ///
+  /// \param vars Generator of labels of variables in \em descending order.
+  ///             These values can at most be `bdd::max_label`.
+  ///
+  /// \param k    Maximum number of variables that are true.
+  ///
+  /// \returns    \f$ \sum_{x \in \mathit{vars}} x \leq k \f$
+  ///
+  /// \throws invalid_argument If `vars` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_atmost(const generator<bdd::label_type> &vars, const uint64_t k);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDD representing that at most `k` of the given variables
+  ///              are true.
+  ///
+  /// \param begin Single-pass forward iterator that provides the variables in
+  ///              \em descending order. All its values should be smaller than
+  ///              or equals to `bdd::max_label`.
+  ///
+  /// \param end   Marks the end for `begin`.
+  ///
+  /// \param k     Maximum number of variables that are true.
+  ///
+  /// \throws invalid_argument If the iterator does not provide values in
+  ///                          descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ForwardIt>
+  bdd bdd_atmost(ForwardIt begin, ForwardIt end, const uint64_t k)
+  { return bdd_atmost(make_generator(begin, end), k); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      The BDD representing that exactly `k` of the given variables
+  ///             are true.
+  ///
+  /// \details    The BDD is constructed directly in its canonical form. It has
+  ///             \f$ O(n \cdot k) \f$ nodes for \f$ n \f$ variables.
+  ///
+  /// \remark     Requires internal memory as described for `bdd_linear_leq`
+  ///             (with \f$ \mathit{bound} = k \f$).
+  ///
+  /// \param vars Generator of labels of variables in \em descending order.
+  ///             These values can at most be `bdd::max_label`.
+  ///
+  /// \param k    Number of variables that are true.
+  ///
+  /// \returns    \f$ \sum_{x \in \mathit{vars}} x = k \f$
+  ///
+  /// \throws invalid_argument If `vars` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_exactly(const generator<bdd::label_type> &vars, const uint64_t k);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDD representing that exactly `k` of the given variables
+  ///              are true.
+  ///
+  /// \param begin Single-pass forward iterator that provides the variables in
+  ///              \em descending order. All its values should be smaller than
+  ///              or equals to `bdd::max_label`.
+  ///
+  /// \param end   Marks the end for `begin`.
+  ///
+  /// \param k     Number of variables that are true.
+  ///
+  /// \throws invalid_argument If the iterator does not provide values in
+  ///                          descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ForwardIt>
+  bdd bdd_exactly(ForwardIt begin, ForwardIt end, const uint64_t k)
+  { return bdd_exactly(make_generator(begin, end), k); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDD representing the (pseudo-Boolean) linear constraint
+  ///              \f$ \sum_i a_i x_i \leq \mathit{bound} \f$.
+  ///
+  /// \details     The BDD is constructed directly in its canonical form. Each
+  ///              node corresponds to a distinct reachable remainder of the
+  ///              bound. Hence, it has at most \f$ O(n \cdot \mathit{bound})
+  ///              \f$ nodes for \f$ n \f$ variables.
+  ///
+  /// \remark      The remainders of the bound on a single level are kept in
+  ///              internal memory while it is constructed. Remainders that are
+  ///              equivalent for all levels below are merged, such that there
+  ///              are at most \f$ \min(2^i, \mathit{bound} + 2) \f$ of them on
+  ///              the \f$ i \f$th level. This may be more than the width of the
+  ///              output, since different remainders may yield the same node.
+  ///
+  /// \param terms Generator of pairs \f$ (x_i, a_i) \f$ in \em descending
+  ///              order of their label. The labels can at most be
+  ///              `bdd::max_label`.
+  ///
+  /// \param bound Upper bound on the sum.
+  ///
+  /// \throws invalid_argument If `terms` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_linear_leq(const generator<pair<bdd::label_type, uint64_t>> &terms,
+                     const uint64_t bound);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDD representing the (pseudo-Boolean) linear constraint
+  ///              \f$ \sum_i a_i x_i \leq \mathit{bound} \f$.
+  ///
+  /// \param begin Single-pass forward iterator that provides the pairs
+  ///              \f$ (x_i, a_i) \f$ in \em descending order of their label.
+  ///
+  /// \param end   Marks the end for `begin`.
+  ///
+  /// \param bound Upper bound on the sum.
+  ///
+  /// \throws invalid_argument If the iterator does not provide values in
+  ///                          descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ForwardIt>
+  bdd bdd_linear_leq(ForwardIt begin, ForwardIt end, const uint64_t bound)
+  { return bdd_linear_leq(make_generator(begin, end), bound); }
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
@@ -635,6 +799,55 @@ namespace adiar
                      ForwardIt end)
   { return bdd_restrict(ep, f, make_generator(begin, end)); }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Generalised cofactor of `f` with respect to the care set `c`.
+  ///
+  /// \details Coudert and Madre's *constrain* operator: within `c` the result
+  ///          agrees with `f`, whereas every assignment outside of `c` is mapped
+  ///          onto a nearby one inside of `c`. In particular, the result
+  ///          satisfies \f$ (f \downarrow c) \land c = f \land c \f$ and it
+  ///          distributes over all Boolean operators. The result may depend on
+  ///          variables of `c` that `f` does not depend on.
+  ///
+  /// \param f  BDD to simplify.
+  ///
+  /// \param c  Care set, i.e. the assignments on which the result has to agree
+  ///           with `f`. If `c` is `false`, then the result is `false`.
+  ///
+  /// \returns  \f$ f \downarrow c \f$
+  ///
+  /// \see bdd_simplify
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_constrain(const bdd &f, const bdd &c);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Generalised cofactor of `f` with respect to the care set `c`.
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_constrain(const exec_policy &ep, const bdd &f, const bdd &c);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Minimise `f` with the don't-care set `~c`.
+  ///
+  /// \details Similar to Coudert and Madre's *restrict* operator: the result
+  ///          agrees with `f` within `c`, only depends on variables in the
+  ///          support of `f`, and is never larger than `f`. To this end, all
+  ///          variables of `c` that are not in the support of `f` are first
+  ///          existentially quantified, before computing `bdd_constrain`.
+  ///
+  /// \param f  BDD to simplify.
+  ///
+  /// \param c  Care set, i.e. the assignments on which the result has to agree
+  ///           with `f`. If `c` is `false`, then the result is `false`.
+  ///
+  /// \see bdd_constrain
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_simplify(const bdd &f, const bdd &c);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Minimise `f` with the don't-care set `~c`.
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_simplify(const exec_policy &ep, const bdd &f, const bdd &c);
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief   Restrict the root to `false`, i.e. follow its low edge.
   ///
@@ -1065,6 +1278,65 @@ namespace adiar
   bool operator!= (__bdd &&f, __bdd &&g);
   /// \endcond
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether `f` implies `g`, i.e. whether every assignment satisfying
+  ///        `f` also satisfies `g`.
+  ///
+  /// \details This is equivalent to `bdd_equal(bdd_imp(f, g), bdd_true())` but
+  ///          does not construct the product of `f` and `g`; it terminates at
+  ///          the first pair of nodes that witnesses a counterexample.
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_implies(const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether `f` implies `g`, i.e. whether every assignment satisfying
+  ///        `f` also satisfies `g`.
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_implies(const exec_policy& ep, const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the set of assignments satisfying `f` is a subset or equal
+  ///        to the ones satisfying `g`.
+  ///
+  /// \see bdd_implies
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_subseteq(const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the set of assignments satisfying `f` is a subset or equal
+  ///        to the ones satisfying `g`.
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_subseteq(const exec_policy& ep, const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether `f` and `g` share no satisfying assignment, i.e. whether
+  ///        `f & g` is unsatisfiable.
+  ///
+  /// \details This does not construct the product of `f` and `g`; it terminates
+  ///          at the first pair of nodes that witnesses a shared assignment.
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_disjoint(const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether `f` and `g` share no satisfying assignment, i.e. whether
+  ///        `f & g` is unsatisfiable.
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_disjoint(const exec_policy& ep, const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether `f` and `g` share a satisfying assignment, i.e. whether
+  ///        `f & g` is satisfiable.
+  ///
+  /// \see bdd_disjoint
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_intersects(const bdd& f, const bdd& g);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether `f` and `g` share a satisfying assignment, i.e. whether
+  ///        `f & g` is satisfiable.
+  //////////////////////////////////////////////////////////////////////////////
+  bool bdd_intersects(const exec_policy& ep, const bdd& f, const bdd& g);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
@@ -1137,6 +1409,71 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////
   uint64_t bdd_satcount(const exec_policy &ep, const bdd &f);
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Weighted model count of f, i.e. the sum of the weights of all
+  ///          assignments x that make f(x) true.
+  ///
+  /// \details The weight of an assignment is the product of the weights of its
+  ///          literals. Its variables are the ones of the global domain (if
+  ///          any) together with the ones within the given BDD.
+  ///
+  /// \param f BDD to count within.
+  ///
+  /// \param w Weight of each literal, i.e. `w(x, true)` is the weight of `x`
+  ///          and `w(x, false)` is the weight of `~x`.
+  ///
+  /// \see domain_set bdd_wmc_log
+  //////////////////////////////////////////////////////////////////////////////
+  double bdd_wmc(const bdd &f, const function<double(bdd::label_type, bool)> &w);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Weighted model count of f.
+  //////////////////////////////////////////////////////////////////////////////
+  double bdd_wmc(const exec_policy &ep,
+                 const bdd &f,
+                 const function<double(bdd::label_type, bool)> &w);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Natural logarithm of the weighted model count of f.
+  ///
+  /// \details Same as `std::log(bdd_wmc(f, w))`, but all computations are done
+  ///          in log-space. Hence, this does not underflow (or overflow) for
+  ///          many variables with small (or large) weights.
+  ///
+  /// \returns The logarithm of the weighted model count, i.e. `-infinity` if f
+  ///          is unsatisfiable.
+  ///
+  /// \throws invalid_argument If some weight is negative (since its logarithm
+  ///                          is undefined).
+  ///
+  /// \see bdd_wmc
+  //////////////////////////////////////////////////////////////////////////////
+  double bdd_wmc_log(const bdd &f, const function<double(bdd::label_type, bool)> &w);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Natural logarithm of the weighted model count of f.
+  //////////////////////////////////////////////////////////////////////////////
+  double bdd_wmc_log(const exec_policy &ep,
+                     const bdd &f,
+                     const function<double(bdd::label_type, bool)> &w);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Probability of f being satisfied, if each variable x
+  ///          independently is true with probability `p(x)`.
+  ///
+  /// \throws invalid_argument If `p(x)` is not within [0,1] for some variable.
+  ///
+  /// \see bdd_wmc
+  //////////////////////////////////////////////////////////////////////////////
+  double bdd_probability(const bdd &f, const function<double(bdd::label_type)> &p);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Probability of f being satisfied.
+  //////////////////////////////////////////////////////////////////////////////
+  double bdd_probability(const exec_policy &ep,
+                         const bdd &f,
+                         const function<double(bdd::label_type)> &p);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
@@ -1381,6 +1718,37 @@ namespace adiar
   bool bdd_eval(const bdd &f, ForwardIt begin, ForwardIt end)
   { return bdd_eval(f, make_generator(begin, end)); }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief    Evaluate a BDD according to 64 assignments at once.
+  ///
+  /// \details  The assignments are given bit-sliced, i.e. the `j`th bit of
+  ///           `xs(i)` is the value of the variable `i` in the `j`th
+  ///           assignment. All 64 assignments are evaluated within a single
+  ///           sweep through the BDD. Hence, this is much faster than 64 calls
+  ///           to `bdd_eval`.
+  ///
+  /// \param f  The BDD to evaluate.
+  ///
+  /// \param xs Bit-sliced assignment function of the type \f$
+  ///           \texttt{label\_t} \rightarrow \texttt{uint64\_t} \f$. This
+  ///           function is called at most once per level of `f` and in
+  ///           strictly increasing order of the labels.
+  ///
+  /// \returns Bit-vector where the `j`th bit is the result of `f` on the `j`th
+  ///          assignment.
+  //////////////////////////////////////////////////////////////////////////////
+  uint64_t bdd_eval_batch(const bdd &f,
+                          const function<uint64_t(bdd::label_type)> &xs);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief    Evaluate a BDD according to 64 assignments at once.
+  ///
+  /// \see bdd_eval_batch
+  //////////////////////////////////////////////////////////////////////////////
+  uint64_t bdd_eval_batch(const exec_policy &ep,
+                          const bdd &f,
+                          const function<uint64_t(bdd::label_type)> &xs);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
@@ -1466,6 +1834,239 @@ namespace adiar
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \name CNF Files
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      The BDD of a CNF in the DIMACS format.
+  ///
+  /// \details    The variable \f$ i \f$ of the DIMACS file is the BDD variable
+  ///             \f$ i-1 \f$. Each clause is directly constructed as a BDD.
+  ///             The clauses are then clustered by their top variable and
+  ///             conjoined according to the `exec_policy::schedule`, which is
+  ///             much faster than conjoining them one by one.
+  ///
+  /// \param in   Input stream with the CNF.
+  ///
+  /// \param vars Predicate for which variables to existentially quantify, e.g.
+  ///             all variables outside of the projection in *projected model
+  ///             counting*. Each of them is quantified as soon as it only
+  ///             occurs within a single intermediate result.
+  ///
+  /// \returns    \f$ \exists x_i : \mathit{vars}(x_i) : \bigwedge_{c} c \f$
+  ///
+  /// \throws invalid_argument If the input is not a (well-formed) CNF.
+  ///
+  /// \remark     All clauses are kept in internal memory, i.e. the memory
+  ///             usage is linear in the size of the CNF. Only the BDDs are
+  ///             stored on disk.
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(std::istream &in, const predicate<bdd::label_type> &vars);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of a CNF in the DIMACS format.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const exec_policy &ep,
+                   std::istream &in,
+                   const predicate<bdd::label_type> &vars);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of a CNF in the DIMACS format.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(std::istream &in);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of a CNF in the DIMACS format.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const exec_policy &ep, std::istream &in);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of the CNF in the DIMACS file with the given name.
+  ///
+  /// \throws runtime_error If the file cannot be opened.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const std::string &file_name, const predicate<bdd::label_type> &vars);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of the CNF in the DIMACS file with the given name.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const exec_policy &ep,
+                   const std::string &file_name,
+                   const predicate<bdd::label_type> &vars);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of the CNF in the DIMACS file with the given name.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const std::string &file_name);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDD of the CNF in the DIMACS file with the given name.
+  ///
+  /// \see bdd_from_cnf
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const exec_policy &ep, const std::string &file_name);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \name Circuit Files
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Static heuristics for the variable order of a circuit's inputs.
+  //////////////////////////////////////////////////////////////////////////////
+  enum class circuit_order
+  {
+    /** Order of the inputs in the file. */
+    Input,
+    /** Order in which a depth-first traversal of the fan-in of each output
+        (in the order of the file) reaches the inputs. */
+    Depth_First,
+    /** The *FORCE* heuristic, placing connected inputs and gates close to each
+        other (starting from the `Depth_First` order). */
+    Force
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of all outputs of a circuit.
+  //////////////////////////////////////////////////////////////////////////////
+  struct bdd_circuit
+  {
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The BDD variable of each input (in the order of the file).
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<bdd::label_type> inputs;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The BDD of each output (in the order of the file).
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<bdd> outputs;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDDs of a combinational circuit in the AIGER format
+  ///              (binary or ASCII).
+  ///
+  /// \details     The gates reachable from the outputs are computed in the
+  ///              order of a depth-first traversal of their fan-in with one
+  ///              `bdd_and` each. Each gate is computed once, shared between all
+  ///              outputs, and released as soon as it is not needed anymore.
+  ///
+  /// \param in    Input stream with the circuit.
+  ///
+  /// \param order Heuristic for the variable order of the inputs.
+  ///
+  /// \throws invalid_argument If the input is not a (well-formed) AIGER file
+  ///                          or includes latches.
+  ///
+  /// \remark      The entire circuit is kept in internal memory.
+  ///
+  /// \remark      Latches (i.e. sequential circuits) are not supported.
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_aiger(std::istream &in,
+                             const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of a combinational circuit in the AIGER format.
+  ///
+  /// \see bdd_from_aiger
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_aiger(const exec_policy &ep,
+                             std::istream &in,
+                             const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of the combinational circuit in the AIGER file with the
+  ///        given name.
+  ///
+  /// \throws runtime_error If the file cannot be opened.
+  ///
+  /// \see bdd_from_aiger
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_aiger(const std::string &file_name,
+                             const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of the combinational circuit in the AIGER file with the
+  ///        given name.
+  ///
+  /// \see bdd_from_aiger
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_aiger(const exec_policy &ep,
+                             const std::string &file_name,
+                             const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The BDDs of a combinational circuit in the BLIF format.
+  ///
+  /// \details     Each `.names` cover is translated into and-gates (with
+  ///              structural hashing). Then, the BDDs are computed as in
+  ///              `bdd_from_aiger`.
+  ///
+  /// \param in    Input stream with the circuit.
+  ///
+  /// \param order Heuristic for the variable order of the inputs.
+  ///
+  /// \throws invalid_argument If the input is not a (well-formed) BLIF file
+  ///                          or includes latches or subcircuits.
+  ///
+  /// \remark      The entire circuit is kept in internal memory.
+  ///
+  /// \remark      Latches (i.e. sequential circuits) and subcircuits are not
+  ///              supported.
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_blif(std::istream &in,
+                            const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of a combinational circuit in the BLIF format.
+  ///
+  /// \see bdd_from_blif
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_blif(const exec_policy &ep,
+                            std::istream &in,
+                            const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of the combinational circuit in the BLIF file with the
+  ///        given name.
+  ///
+  /// \throws runtime_error If the file cannot be opened.
+  ///
+  /// \see bdd_from_blif
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_blif(const std::string &file_name,
+                            const circuit_order order = circuit_order::Input);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The BDDs of the combinational circuit in the BLIF file with the
+  ///        given name.
+  ///
+  /// \see bdd_from_blif
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_blif(const exec_policy &ep,
+                            const std::string &file_name,
+                            const circuit_order order = circuit_order::Input);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
   //////////////////////////////////////////////////////////////////////////////
   /// \name DOT Files of BDDs
   ///
@@ -1484,6 +2085,26 @@ namespace adiar
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \name Shared Forest of BDDs
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Store of many BDDs in a single unique node table, i.e. all nodes
+  ///        are shared between them and two BDDs are equivalent if and only if
+  ///        their roots in the forest are the same.
+  ///
+  /// \details Use `insert(f)` to add a BDD or the (unreduced) result of an
+  ///          operation and obtain its root, `get(root)` to obtain the BDD of
+  ///          a root, and `gc(roots)` to remove all nodes that are not
+  ///          reachable from `roots`.
+  //////////////////////////////////////////////////////////////////////////////
+  using bdd_forest = internal::shared_forest<bdd_policy>;
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 }
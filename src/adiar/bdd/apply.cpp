@@ -5,6 +5,7 @@
 #include <adiar/internal/cut.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/unreachable.h>
+#include <adiar/internal/algorithms/depth_first.h>
 #include <adiar/internal/algorithms/prod2.h>
 #include <adiar/internal/data_types/tuple.h>
 
@@ -119,6 +120,14 @@ namespace adiar
 
   __bdd bdd_apply(const exec_policy &ep, const bdd &f, const bdd &g, const bool_op &op)
   {
+    // Trivial cases are resolved in O(1) time by `prod2` itself.
+    const bool is_trivial =
+      f.file_ptr() == g.file_ptr() || bdd_isterminal(f) || bdd_isterminal(g);
+
+    if (!is_trivial && internal::depth_first_fits(ep, f.size() + g.size())) {
+      const optional<bdd> res = internal::depth_first_apply<bdd_policy>(ep, f, g, op);
+      if (res) { return res.value(); }
+    }
     return internal::prod2<apply_prod2_policy>(ep, f, g, op);
   }
 
@@ -58,6 +58,7 @@ namespace adiar
 
     // |- classes [internal]
     friend class apply_prod2_policy;
+    friend class constrain_prod2_policy;
 
     // |- functions
     friend bdd bdd_not(const bdd&);
@@ -72,6 +73,12 @@ namespace adiar
     friend __bdd
     bdd_ite(const exec_policy &ep, const bdd &f, const bdd &g, const bdd &h);
 
+    friend bool
+    bdd_implies(const exec_policy &ep, const bdd &f, const bdd &g);
+
+    friend bool
+    bdd_disjoint(const exec_policy &ep, const bdd &f, const bdd &g);
+
   public:
     /// \cond
     ////////////////////////////////////////////////////////////////////////////
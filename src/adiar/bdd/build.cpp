@@ -1,11 +1,20 @@
 #include <adiar/bdd.h>
 
+#include <utility>
+
+#include <adiar/builder.h>
+#include <adiar/exception.h>
+#include <adiar/zdd.h>
+
 #include <adiar/bdd/bdd_policy.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/cut.h>
+#include <adiar/internal/io/file.h>
 #include <adiar/internal/io/file_stream.h>
+#include <adiar/internal/io/file_writer.h>
 #include <adiar/internal/io/levelized_file_writer.h>
 #include <adiar/internal/algorithms/build.h>
+#include <adiar/internal/algorithms/relabel.h>
 #include <adiar/internal/data_types/uid.h>
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/data_types/ptr.h>
@@ -115,4 +124,145 @@ namespace adiar
   {
     return bdd_and(vars);
   }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // The disjunction of cubes may have an exponential-sized BDD, so it cannot
+  // be constructed by sorting the cubes alone. Instead, the cubes are first
+  // collected with `zdd_from_sets` as the family of their literals. To this
+  // end, each variable x is split into three levels: its positive literal
+  // (3x), its negative literal (3x+1), and the variable itself (3x+2). The BDD
+  // is the result of quantifying all literals from the conjunction of the
+  // family's characteristic function with the constraint that every literal
+  // chosen is satisfied.
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of levels for each variable in `bdd_from_cubes`.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr bdd::label_type bdd_from_cubes_levels = 3u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Offset of the variable itself within its levels.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr bdd::label_type bdd_from_cubes_var = 2u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Largest variable label that fits with its literals.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr bdd::label_type bdd_from_cubes_max_var =
+    (bdd::max_label - bdd_from_cubes_var) / bdd_from_cubes_levels;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The constraint that all chosen literals are satisfied, i.e.
+  ///        \f$ \bigwedge_{x} (x^+ \rightarrow x) \wedge (x^- \rightarrow \neg x) \f$.
+  ///
+  /// \param vars Variables in \em descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  inline bdd
+  __bdd_from_cubes_constraint(const generator<bdd::label_type> &vars)
+  {
+    bdd_builder b;
+    bdd_ptr next = b.add_node(true);
+
+    for (optional<bdd::label_type> v = vars(); v; v = vars()) {
+      const bdd::label_type pos = bdd_from_cubes_levels * v.value();
+      const bdd::label_type neg = pos + 1u;
+      const bdd::label_type var = pos + bdd_from_cubes_var;
+
+      const bdd_ptr var_true  = b.add_node(var, false, next);
+      const bdd_ptr var_false = b.add_node(var, next, false);
+
+      const bdd_ptr neg_low  = b.add_node(neg, next, var_false);
+      const bdd_ptr neg_high = b.add_node(neg, var_true, false);
+
+      next = b.add_node(pos, neg_low, neg_high);
+    }
+    return b.build();
+  }
+
+  __bdd bdd_from_cubes(const exec_policy &ep,
+                       const size_t n,
+                       const generator<pair<size_t, pair<bdd::label_type, bool>>> &cubes)
+  {
+    const zdd literals = zdd_from_sets(ep, n, [&cubes]() {
+      const optional<pair<size_t, pair<bdd::label_type, bool>>> x = cubes();
+      if (!x) {
+        return make_optional<pair<size_t, zdd::label_type>>();
+      }
+
+      const bdd::label_type var = x.value().second.first;
+      if (bdd_from_cubes_max_var < var) {
+        throw invalid_argument("Variables in cubes must be at most (bdd::max_label-2)/3");
+      }
+
+      const bool negated = x.value().second.second;
+      return make_optional(make_pair(x.value().first,
+                                     static_cast<zdd::label_type>(bdd_from_cubes_levels * var + negated)));
+    });
+
+    if (zdd_isterminal(literals)) {
+      // Either there are no cubes or only the empty cube.
+      return bdd_terminal(zdd_isnull(literals));
+    }
+
+    // Obtain the literals and the variables they belong to
+    internal::shared_file<bdd::label_type> lits;
+    internal::shared_file<bdd::label_type> vars;
+    {
+      internal::file_writer<bdd::label_type> lw(lits);
+      internal::file_writer<bdd::label_type> vw(vars);
+
+      optional<bdd::label_type> prev_var;
+      zdd_support(literals, [&](const zdd::label_type x) {
+        lw << x;
+
+        const bdd::label_type v = x / bdd_from_cubes_levels;
+        if (!prev_var || prev_var.value() != v) { vw << v; }
+        prev_var = make_optional(v);
+      });
+    }
+
+    bdd chi;
+    {
+      internal::file_stream<bdd::label_type> ls(lits);
+      chi = bdd_from(ep, literals, make_generator(ls));
+    }
+
+    bdd constraint;
+    {
+      internal::file_stream<bdd::label_type, true> vs(vars);
+      constraint = __bdd_from_cubes_constraint(make_generator(vs));
+    }
+
+    bdd res = bdd_and(ep, chi, constraint);
+    res = bdd_exists(ep, std::move(res), [](const bdd::label_type x) {
+      return x % bdd_from_cubes_levels != bdd_from_cubes_var;
+    });
+
+    return internal::relabel<bdd_policy>(res, [](const bdd::label_type x) {
+      return x / bdd_from_cubes_levels;
+    });
+  }
+
+  __bdd bdd_from_cubes(const size_t n,
+                       const generator<pair<size_t, pair<bdd::label_type, bool>>> &cubes)
+  {
+    return bdd_from_cubes(exec_policy(), n, cubes);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_atmost(const generator<bdd::label_type> &vars, const uint64_t k)
+  {
+    return internal::build_linear<bdd_policy>(vars, 0u, k);
+  }
+
+  bdd bdd_exactly(const generator<bdd::label_type> &vars, const uint64_t k)
+  {
+    return internal::build_linear<bdd_policy>(vars, k, k);
+  }
+
+  bdd bdd_linear_leq(const generator<pair<bdd::label_type, uint64_t>> &terms,
+                     const uint64_t bound)
+  {
+    return internal::build_linear<bdd_policy>(terms, 0u, bound);
+  }
 }
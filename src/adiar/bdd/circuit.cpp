@@ -0,0 +1,732 @@
+#include <adiar/bdd.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <adiar/exception.h>
+#include <adiar/exec_policy.h>
+#include <adiar/types.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //  Circuit Import
+  // ================
+  //
+  // Both AIGER and BLIF files are first translated into an And-Inverter Graph
+  // (AIG) in internal memory. Similar to AIGER, a *literal* is `2v` for the
+  // variable `v` and `2v+1` for its negation and the variable 0 is the constant
+  // false.
+  //
+  // Only the gates reachable from an output are then converted into BDDs. The
+  // gates are computed in the (topological) order of a depth-first traversal
+  // with a single `bdd_and` each, i.e. every gate is computed exactly once (and
+  // shared between all outputs) and its BDD is released as soon as all gates
+  // and outputs depending on it are done. Contrary to an order by depth, this
+  // keeps few intermediate BDDs alive at the same time.
+  //
+  // Latches (i.e. sequential circuits) are not supported (see the remarks on
+  // `bdd_from_aiger` and `bdd_from_blif`).
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief An And-Inverter Graph.
+  //////////////////////////////////////////////////////////////////////////////
+  struct circuit_aig
+  {
+    enum kind_t : uint8_t { Undefined, Constant, Input, And };
+
+    struct var_t
+    {
+      kind_t kind = Undefined;
+      uint64_t in0 = 0u;
+      uint64_t in1 = 0u;
+    };
+
+    std::vector<var_t> vars = { var_t{ Constant, 0u, 0u } };
+
+    std::vector<uint64_t> inputs;
+    std::vector<uint64_t> outputs;
+
+    static constexpr uint64_t var_of(const uint64_t lit)
+    { return lit >> 1; }
+
+    static constexpr bool is_negated(const uint64_t lit)
+    { return lit & 1u; }
+
+    uint64_t add_input()
+    {
+      vars.push_back(var_t{ Input, 0u, 0u });
+      inputs.push_back(vars.size() - 1u);
+      return 2u * (vars.size() - 1u);
+    }
+
+    uint64_t add_and(const uint64_t in0, const uint64_t in1)
+    {
+      vars.push_back(var_t{ And, in0, in1 });
+      return 2u * (vars.size() - 1u);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  // AIGER
+  //////////////////////////////////////////////////////////////////////////////
+  inline uint64_t
+  __aiger_parse_literal(const std::string &line, const uint64_t max_var)
+  {
+    std::istringstream line_in(line);
+
+    uint64_t lit;
+    std::string rest;
+    if (!(line_in >> lit) || (line_in >> rest) || max_var < circuit_aig::var_of(lit)) {
+      throw invalid_argument("Malformed AIGER literal: '" + line + "'");
+    }
+    return lit;
+  }
+
+  inline uint64_t
+  __aiger_decode(std::istream &in)
+  {
+    uint64_t x = 0u;
+    unsigned int shift = 0u;
+
+    while (true) {
+      const int ch = in.get();
+      if (ch == std::char_traits<char>::eof()) {
+        throw invalid_argument("Unexpected end of binary AIGER file");
+      }
+      if (64u <= shift) {
+        throw invalid_argument("Malformed binary AIGER delta");
+      }
+      x |= static_cast<uint64_t>(ch & 0x7f) << shift;
+      if (!(ch & 0x80)) { return x; }
+      shift += 7u;
+    }
+  }
+
+  circuit_aig
+  __aiger_parse(std::istream &in)
+  {
+    std::string line;
+    if (!std::getline(in, line)) {
+      throw invalid_argument("AIGER header is missing");
+    }
+
+    std::istringstream header(line);
+    std::string format;
+    uint64_t M, I, L, O, A;
+    if (!(header >> format >> M >> I >> L >> O >> A) || (format != "aag" && format != "aig")) {
+      throw invalid_argument("Malformed AIGER header: '" + line + "'");
+    }
+
+    // Optional header extensions (bad state, invariant, justice, fairness)
+    uint64_t ext;
+    while (header >> ext) {
+      if (ext != 0u) {
+        throw invalid_argument("AIGER properties and constraints are not supported");
+      }
+    }
+    if (L != 0u) {
+      throw invalid_argument("AIGER latches (sequential circuits) are not supported");
+    }
+    if (M < I + A) {
+      throw invalid_argument("AIGER header has too few variables");
+    }
+
+    const bool binary = format == "aig";
+    if (binary && M != I + A) {
+      throw invalid_argument("Binary AIGER header must have M = I + L + A");
+    }
+
+    // The variables of an ASCII file may be sparse, i.e. M is not bounded by
+    // the size of the input. Hence, only the I + A variables defined by the
+    // file are stored and, if need be, renamed to be consecutive.
+    const bool sparse = M != I + A;
+    std::unordered_map<uint64_t, uint64_t> dense_of;
+
+    const auto dense_var = [&](const uint64_t v) -> uint64_t {
+      if (!sparse || v == 0u) { return v; }
+      const uint64_t next = dense_of.size() + 1u;
+      return dense_of.emplace(v, next).first->second;
+    };
+
+    circuit_aig res;
+    res.vars.resize(I + A + 1u);
+
+    // Inputs
+    for (uint64_t i = 0u; i < I; ++i) {
+      uint64_t v = i + 1u;
+      if (!binary) {
+        if (!std::getline(in, line)) {
+          throw invalid_argument("Unexpected end of AIGER file");
+        }
+        const uint64_t lit = __aiger_parse_literal(line, M);
+        if (circuit_aig::var_of(lit) == 0u || circuit_aig::is_negated(lit)) {
+          throw invalid_argument("Invalid AIGER input: '" + line + "'");
+        }
+
+        v = dense_var(circuit_aig::var_of(lit));
+        if (res.vars[v].kind != circuit_aig::Undefined) {
+          throw invalid_argument("Invalid AIGER input: '" + line + "'");
+        }
+      }
+      res.vars[v].kind = circuit_aig::Input;
+      res.inputs.push_back(v);
+    }
+
+    // Outputs
+    for (uint64_t o = 0u; o < O; ++o) {
+      if (!std::getline(in, line)) {
+        throw invalid_argument("Unexpected end of AIGER file");
+      }
+      res.outputs.push_back(__aiger_parse_literal(line, M));
+    }
+
+    // And-gates
+    for (uint64_t a = 0u; a < A; ++a) {
+      uint64_t lhs, rhs0, rhs1;
+
+      if (binary) {
+        lhs = 2u * (I + a + 1u);
+
+        const uint64_t delta0 = __aiger_decode(in);
+        const uint64_t delta1 = __aiger_decode(in);
+        if (lhs < delta0 || lhs - delta0 < delta1) {
+          throw invalid_argument("Malformed binary AIGER delta");
+        }
+        rhs0 = lhs - delta0;
+        rhs1 = rhs0 - delta1;
+      } else {
+        if (!std::getline(in, line)) {
+          throw invalid_argument("Unexpected end of AIGER file");
+        }
+        std::istringstream line_in(line);
+        if (!(line_in >> lhs >> rhs0 >> rhs1)
+            || M < circuit_aig::var_of(lhs)
+            || M < circuit_aig::var_of(rhs0)
+            || M < circuit_aig::var_of(rhs1)) {
+          throw invalid_argument("Malformed AIGER and-gate: '" + line + "'");
+        }
+      }
+
+      if (circuit_aig::var_of(lhs) == 0u || circuit_aig::is_negated(lhs)) {
+        throw invalid_argument("Invalid AIGER and-gate for literal " + std::to_string(lhs));
+      }
+
+      const uint64_t v = dense_var(circuit_aig::var_of(lhs));
+      if (res.vars[v].kind != circuit_aig::Undefined) {
+        throw invalid_argument("Invalid AIGER and-gate for literal " + std::to_string(lhs));
+      }
+      res.vars[v] = circuit_aig::var_t{ circuit_aig::And, rhs0, rhs1 };
+    }
+
+    // Rename the fan-ins and outputs to the consecutive variables
+    if (sparse) {
+      const auto dense_lit = [&dense_of](const uint64_t lit) -> uint64_t {
+        const uint64_t v = circuit_aig::var_of(lit);
+        if (v == 0u) { return lit; }
+
+        const auto it = dense_of.find(v);
+        if (it == dense_of.end()) {
+          throw invalid_argument("AIGER literal " + std::to_string(lit) + " is undefined");
+        }
+        return 2u * it->second + (circuit_aig::is_negated(lit) ? 1u : 0u);
+      };
+
+      for (circuit_aig::var_t &var : res.vars) {
+        if (var.kind != circuit_aig::And) { continue; }
+        var.in0 = dense_lit(var.in0);
+        var.in1 = dense_lit(var.in1);
+      }
+      for (uint64_t &o : res.outputs) { o = dense_lit(o); }
+    }
+
+    // The symbol table and comments are ignored.
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // BLIF
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A `.names` block, i.e. a single-output cover.
+  //////////////////////////////////////////////////////////////////////////////
+  struct blif_names
+  {
+    std::vector<std::string> fanins;
+    std::string output;
+    std::vector<pair<std::string, char>> rows;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the next logical line (without comments and with all
+  ///        continuations joined) split into its tokens.
+  //////////////////////////////////////////////////////////////////////////////
+  inline bool
+  __blif_next_line(std::istream &in, std::vector<std::string> &tokens)
+  {
+    tokens.clear();
+
+    std::string line;
+    std::string logical;
+    while (std::getline(in, line)) {
+      const size_t comment = line.find('#');
+      if (comment != std::string::npos) { line.erase(comment); }
+
+      // Trim trailing whitespace to find a continuation
+      while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) {
+        line.pop_back();
+      }
+
+      if (!line.empty() && line.back() == '\\') {
+        line.pop_back();
+        logical += line + " ";
+        continue;
+      }
+      logical += line;
+
+      std::istringstream logical_in(logical);
+      std::string token;
+      while (logical_in >> token) { tokens.push_back(token); }
+
+      if (!tokens.empty()) { return true; }
+      logical.clear();
+    }
+    return false;
+  }
+
+  circuit_aig
+  __blif_parse(std::istream &in)
+  {
+    std::vector<std::string> input_names;
+    std::vector<std::string> output_names;
+    std::vector<blif_names> names;
+
+    std::vector<std::string> tokens;
+    bool has_line = __blif_next_line(in, tokens);
+    while (has_line) {
+      const std::string &cmd = tokens[0];
+
+      if (cmd == ".inputs") {
+        input_names.insert(input_names.end(), tokens.begin() + 1, tokens.end());
+      } else if (cmd == ".outputs") {
+        output_names.insert(output_names.end(), tokens.begin() + 1, tokens.end());
+      } else if (cmd == ".names") {
+        if (tokens.size() < 2u) {
+          throw invalid_argument("BLIF '.names' without an output");
+        }
+        blif_names n;
+        n.fanins.assign(tokens.begin() + 1, tokens.end() - 1);
+        n.output = tokens.back();
+
+        // Cover rows
+        while ((has_line = __blif_next_line(in, tokens)) && tokens[0][0] != '.') {
+          const bool has_plane = !n.fanins.empty();
+          if (tokens.size() != (has_plane ? 2u : 1u)
+              || (has_plane && tokens[0].size() != n.fanins.size())
+              || tokens.back().size() != 1u
+              || (tokens.back()[0] != '0' && tokens.back()[0] != '1')) {
+            throw invalid_argument("Malformed BLIF cover of '" + n.output + "'");
+          }
+          const std::string plane = has_plane ? tokens[0] : "";
+          if (plane.find_first_not_of("01-") != std::string::npos) {
+            throw invalid_argument("Malformed BLIF cover of '" + n.output + "'");
+          }
+          if (!n.rows.empty() && n.rows[0].second != tokens.back()[0]) {
+            throw invalid_argument("BLIF cover of '" + n.output + "' mixes on-set and off-set");
+          }
+          n.rows.push_back({ plane, tokens.back()[0] });
+        }
+        names.push_back(std::move(n));
+        continue;
+      } else if (cmd == ".end" || cmd == ".exdc") {
+        break;
+      } else if (cmd == ".latch" || cmd == ".mlatch" || cmd == ".subckt" || cmd == ".gate") {
+        throw invalid_argument("BLIF '" + cmd + "' is not supported");
+      } else if (cmd[0] != '.') {
+        throw invalid_argument("Unexpected BLIF line starting with '" + cmd + "'");
+      }
+      // Everything else, e.g. '.model', carries no logic.
+
+      has_line = __blif_next_line(in, tokens);
+    }
+
+    // Translate into an AIG (with structural hashing)
+    circuit_aig res;
+
+    std::unordered_map<std::string, uint64_t> literal_of;
+    for (const std::string &i : input_names) {
+      if (literal_of.find(i) != literal_of.end()) {
+        throw invalid_argument("BLIF input '" + i + "' is declared twice");
+      }
+      literal_of[i] = res.add_input();
+    }
+
+    std::unordered_map<std::string, size_t> definition_of;
+    for (size_t i = 0u; i < names.size(); ++i) {
+      if (literal_of.find(names[i].output) != literal_of.end()
+          || definition_of.find(names[i].output) != definition_of.end()) {
+        throw invalid_argument("BLIF signal '" + names[i].output + "' is defined twice");
+      }
+      definition_of[names[i].output] = i;
+    }
+
+    std::map<pair<uint64_t, uint64_t>, uint64_t> and_of;
+    const auto mk_and = [&](uint64_t a, uint64_t b) -> uint64_t {
+      if (a == 0u || b == 0u || a == (b ^ 1u)) { return 0u; }
+      if (a == 1u || a == b) { return b; }
+      if (b == 1u) { return a; }
+
+      if (b < a) { std::swap(a, b); }
+      const auto it = and_of.find({ a, b });
+      if (it != and_of.end()) { return it->second; }
+
+      const uint64_t lit = res.add_and(a, b);
+      and_of[{ a, b }] = lit;
+      return lit;
+    };
+    const auto mk_or = [&](uint64_t a, uint64_t b) -> uint64_t {
+      return mk_and(a ^ 1u, b ^ 1u) ^ 1u;
+    };
+
+    // Depth-first (without recursion) resolve all signals needed for the outputs
+    std::unordered_map<std::string, bool> in_progress;
+    const auto resolve = [&](const std::string &signal) -> uint64_t {
+      std::vector<std::string> stack = { signal };
+
+      while (!stack.empty()) {
+        const std::string s = stack.back();
+        if (literal_of.find(s) != literal_of.end()) { stack.pop_back(); continue; }
+
+        const auto def = definition_of.find(s);
+        if (def == definition_of.end()) {
+          throw invalid_argument("BLIF signal '" + s + "' is undefined");
+        }
+        const blif_names &n = names[def->second];
+
+        bool ready = true;
+        for (const std::string &f : n.fanins) {
+          if (literal_of.find(f) != literal_of.end()) { continue; }
+          if (in_progress[f]) {
+            throw invalid_argument("BLIF has a combinational cycle through '" + f + "'");
+          }
+          stack.push_back(f);
+          ready = false;
+        }
+        in_progress[s] = true;
+        if (!ready) { continue; }
+
+        // Sum of products
+        uint64_t sop = 0u;
+        for (const auto &row : n.rows) {
+          uint64_t cube = 1u;
+          for (size_t j = 0u; j < n.fanins.size(); ++j) {
+            if (row.first[j] == '-') { continue; }
+            const uint64_t lit = literal_of[n.fanins[j]];
+            cube = mk_and(cube, row.first[j] == '1' ? lit : lit ^ 1u);
+          }
+          sop = mk_or(sop, cube);
+        }
+        const bool offset = !n.rows.empty() && n.rows[0].second == '0';
+        literal_of[s] = offset ? sop ^ 1u : sop;
+
+        in_progress[s] = false;
+        stack.pop_back();
+      }
+      return literal_of[signal];
+    };
+
+    for (const std::string &o : output_names) {
+      res.outputs.push_back(resolve(o));
+    }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Variable Order
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Reachable gates (in topological order) and a linear placement of
+  ///        all inputs and gates (from a depth-first traversal).
+  //////////////////////////////////////////////////////////////////////////////
+  struct circuit_traversal
+  {
+    std::vector<uint64_t> gates;
+    std::vector<uint64_t> placement;
+  };
+
+  circuit_traversal
+  __circuit_traverse(const circuit_aig &c)
+  {
+    circuit_traversal res;
+
+    // 0: unvisited, 1: on the stack, 2: done
+    std::vector<uint8_t> state(c.vars.size(), 0u);
+
+    for (const uint64_t o : c.outputs) {
+      std::vector<pair<uint64_t, uint8_t>> stack = { { circuit_aig::var_of(o), 0u } };
+
+      while (!stack.empty()) {
+        auto &[v, next_child] = stack.back();
+        const circuit_aig::var_t &var = c.vars[v];
+
+        if (var.kind == circuit_aig::Undefined) {
+          throw invalid_argument("Circuit variable " + std::to_string(v) + " is undefined");
+        }
+        if (next_child == 0u && state[v] == 2u) { stack.pop_back(); continue; }
+
+        if (var.kind != circuit_aig::And) {
+          if (var.kind == circuit_aig::Input) { res.placement.push_back(v); }
+          state[v] = 2u;
+          stack.pop_back();
+          continue;
+        }
+
+        if (next_child == 0u) { state[v] = 1u; }
+
+        if (next_child < 2u) {
+          const uint64_t child = circuit_aig::var_of(next_child == 0u ? var.in0 : var.in1);
+          next_child++;
+
+          if (state[child] == 1u) {
+            throw invalid_argument("Circuit has a combinational cycle");
+          }
+          if (state[child] == 0u) { stack.push_back({ child, 0u }); }
+          continue;
+        }
+
+        state[v] = 2u;
+        res.gates.push_back(v);
+        res.placement.push_back(v);
+        stack.pop_back();
+      }
+    }
+
+    // Unreachable inputs are placed at the very end
+    for (const uint64_t i : c.inputs) {
+      if (state[i] == 0u) { res.placement.push_back(i); }
+    }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maximum number of iterations of the FORCE heuristic.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t circuit_force_iterations = 32u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Improve a placement with the FORCE heuristic of Aloul, Markov, and
+  ///        Sakallah: each node is moved to the average center of gravity of
+  ///        the gates it is connected to until the total span of all gates
+  ///        does not decrease anymore.
+  //////////////////////////////////////////////////////////////////////////////
+  std::vector<uint64_t>
+  __circuit_force(const circuit_aig &c, const circuit_traversal &t)
+  {
+    std::vector<double> position(c.vars.size(), 0.0);
+    std::vector<double> sum(c.vars.size());
+    std::vector<size_t> count(c.vars.size());
+
+    std::vector<uint64_t> order = t.placement;
+    std::vector<uint64_t> best = order;
+
+    const auto edge_of = [&c](const uint64_t g) {
+      const circuit_aig::var_t &var = c.vars[g];
+      return std::array<uint64_t, 3>{ g, circuit_aig::var_of(var.in0), circuit_aig::var_of(var.in1) };
+    };
+
+    const auto span = [&]() {
+      double res = 0.0;
+      for (const uint64_t g : t.gates) {
+        double lo = position[g], hi = position[g];
+        for (const uint64_t v : edge_of(g)) {
+          if (v == 0u) { continue; }
+          lo = std::min(lo, position[v]);
+          hi = std::max(hi, position[v]);
+        }
+        res += hi - lo;
+      }
+      return res;
+    };
+
+    for (size_t i = 0u; i < order.size(); ++i) { position[order[i]] = static_cast<double>(i); }
+    double best_span = span();
+
+    for (size_t it = 0u; it < circuit_force_iterations; ++it) {
+      std::fill(sum.begin(), sum.end(), 0.0);
+      std::fill(count.begin(), count.end(), 0u);
+
+      for (const uint64_t g : t.gates) {
+        double cog = 0.0;
+        size_t size = 0u;
+        for (const uint64_t v : edge_of(g)) {
+          if (v == 0u) { continue; }
+          cog += position[v];
+          size++;
+        }
+        cog /= static_cast<double>(size);
+
+        for (const uint64_t v : edge_of(g)) {
+          if (v == 0u) { continue; }
+          sum[v] += cog;
+          count[v]++;
+        }
+      }
+      for (const uint64_t v : order) {
+        if (0u < count[v]) { position[v] = sum[v] / static_cast<double>(count[v]); }
+      }
+
+      std::stable_sort(order.begin(), order.end(), [&](const uint64_t a, const uint64_t b) {
+        return position[a] < position[b];
+      });
+      for (size_t i = 0u; i < order.size(); ++i) { position[order[i]] = static_cast<double>(i); }
+
+      const double new_span = span();
+      if (best_span <= new_span) { break; }
+
+      best_span = new_span;
+      best = order;
+    }
+    return best;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Construction of BDDs
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit
+  __bdd_from_circuit(const exec_policy &ep, const circuit_aig &c, const circuit_order o)
+  {
+    if (static_cast<uint64_t>(bdd::max_label) < c.inputs.size()) {
+      throw invalid_argument("Cannot represent that many inputs");
+    }
+
+    const circuit_traversal t = __circuit_traverse(c);
+
+    // Variable order
+    std::vector<bdd::label_type> label_of(c.vars.size(), 0u);
+    {
+      std::vector<uint64_t> placement;
+      switch (o) {
+      case circuit_order::Depth_First:
+        placement = t.placement;
+        break;
+
+      case circuit_order::Force:
+        placement = __circuit_force(c, t);
+        break;
+
+      case circuit_order::Input:
+      default:
+        placement = c.inputs;
+        break;
+      }
+
+      bdd::label_type next_label = 0u;
+      for (const uint64_t v : placement) {
+        if (c.vars[v].kind == circuit_aig::Input) { label_of[v] = next_label++; }
+      }
+    }
+
+    bdd_circuit res;
+    for (const uint64_t i : c.inputs) { res.inputs.push_back(label_of[i]); }
+
+    // Number of gates and outputs that still need each variable
+    std::vector<size_t> refcount(c.vars.size(), 0u);
+    for (const uint64_t g : t.gates) {
+      refcount[circuit_aig::var_of(c.vars[g].in0)]++;
+      refcount[circuit_aig::var_of(c.vars[g].in1)]++;
+    }
+    for (const uint64_t o : c.outputs) {
+      refcount[circuit_aig::var_of(o)]++;
+    }
+
+    std::vector<optional<bdd>> fs(c.vars.size());
+    fs[0] = bdd_false();
+    for (const uint64_t i : c.inputs) {
+      if (0u < refcount[i]) { fs[i] = bdd_ithvar(label_of[i]); }
+    }
+
+    const auto get = [&fs](const uint64_t lit) -> bdd {
+      const bdd &f = fs[circuit_aig::var_of(lit)].value();
+      return circuit_aig::is_negated(lit) ? bdd_not(f) : f;
+    };
+    const auto release = [&fs, &refcount](const uint64_t lit) {
+      const uint64_t v = circuit_aig::var_of(lit);
+      if (v != 0u && --refcount[v] == 0u) { fs[v].reset(); }
+    };
+
+    for (const uint64_t g : t.gates) {
+      const circuit_aig::var_t &var = c.vars[g];
+
+      fs[g].emplace(bdd_and(ep, get(var.in0), get(var.in1)));
+
+      release(var.in0);
+      release(var.in1);
+    }
+
+    for (const uint64_t o : c.outputs) {
+      res.outputs.push_back(get(o));
+      release(o);
+    }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  bdd_circuit bdd_from_aiger(const exec_policy &ep, std::istream &in, const circuit_order o)
+  {
+    return __bdd_from_circuit(ep, __aiger_parse(in), o);
+  }
+
+  bdd_circuit bdd_from_aiger(std::istream &in, const circuit_order o)
+  {
+    return bdd_from_aiger(exec_policy(), in, o);
+  }
+
+  bdd_circuit bdd_from_aiger(const exec_policy &ep, const std::string &file_name, const circuit_order o)
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in.is_open()) {
+      throw runtime_error("Cannot open file '" + file_name + "'");
+    }
+    return bdd_from_aiger(ep, in, o);
+  }
+
+  bdd_circuit bdd_from_aiger(const std::string &file_name, const circuit_order o)
+  {
+    return bdd_from_aiger(exec_policy(), file_name, o);
+  }
+
+  bdd_circuit bdd_from_blif(const exec_policy &ep, std::istream &in, const circuit_order o)
+  {
+    return __bdd_from_circuit(ep, __blif_parse(in), o);
+  }
+
+  bdd_circuit bdd_from_blif(std::istream &in, const circuit_order o)
+  {
+    return bdd_from_blif(exec_policy(), in, o);
+  }
+
+  bdd_circuit bdd_from_blif(const exec_policy &ep, const std::string &file_name, const circuit_order o)
+  {
+    std::ifstream in(file_name);
+    if (!in.is_open()) {
+      throw runtime_error("Cannot open file '" + file_name + "'");
+    }
+    return bdd_from_blif(ep, in, o);
+  }
+
+  bdd_circuit bdd_from_blif(const std::string &file_name, const circuit_order o)
+  {
+    return bdd_from_blif(exec_policy(), file_name, o);
+  }
+}
@@ -0,0 +1,438 @@
+#include <adiar/bdd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <adiar/exception.h>
+#include <adiar/exec_policy.h>
+#include <adiar/functional.h>
+#include <adiar/types.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //  CNF Import
+  // ============
+  //
+  // A CNF in the DIMACS format is read into internal memory. Each clause is
+  // normalised (sorted, duplicate literals removed, tautologies dropped) and
+  // then converted into a BDD with `bdd_or` (i.e. directly with the
+  // node_writer). The clauses are clustered by their top variable, such that
+  // clauses within a cluster share (at least) one variable and lie close to
+  // each other in the variable order. The clusters are finally conjoined based
+  // on the `exec_policy::schedule`.
+  //
+  // If some variables are to be quantified, then a variable is quantified as
+  // soon as it only occurs within a single (intermediate) result. To this end,
+  // we keep track of the number of results that (may) depend on each variable.
+  //
+  // All clauses are kept in internal memory (see the remark on `bdd_from_cnf`).
+  //////////////////////////////////////////////////////////////////////////////
+
+  using cnf_literal = pair<bdd::label_type, bool>;
+  using cnf_clause  = std::vector<cnf_literal>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The clauses of a CNF (each with its literals in descending order).
+  //////////////////////////////////////////////////////////////////////////////
+  struct cnf
+  {
+    bdd::label_type varcount = 0u;
+    std::vector<cnf_clause> clauses;
+    bool has_empty_clause = false;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sort the literals of a clause (descending) and remove duplicates.
+  ///
+  /// \returns Whether the clause is a tautology.
+  //////////////////////////////////////////////////////////////////////////////
+  inline bool
+  __cnf_normalise(cnf_clause &c)
+  {
+    std::sort(c.begin(), c.end(), [](const cnf_literal &a, const cnf_literal &b) {
+      return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+    c.erase(std::unique(c.begin(), c.end()), c.end());
+
+    for (size_t i = 1u; i < c.size(); ++i) {
+      if (c[i-1u].first == c[i].first) { return true; }
+    }
+    return false;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Parse a CNF in the DIMACS format.
+  //////////////////////////////////////////////////////////////////////////////
+  cnf
+  __cnf_parse(std::istream &in)
+  {
+    cnf res;
+    bool has_header = false;
+
+    cnf_clause clause;
+    bool clause_open = false;
+
+    const auto close_clause = [&]() {
+      if (clause.empty()) {
+        res.has_empty_clause = true;
+      } else if (!__cnf_normalise(clause)) {
+        res.clauses.push_back(clause);
+      }
+      clause.clear();
+      clause_open = false;
+    };
+
+    std::string line;
+    while (std::getline(in, line)) {
+      std::istringstream line_in(line);
+
+      std::string token;
+      if (!(line_in >> token)) { continue; }
+
+      // Comment
+      if (token[0] == 'c') { continue; }
+
+      // End marker (used in the SATLIB benchmarks)
+      if (token[0] == '%') { break; }
+
+      // Problem line
+      if (token == "p") {
+        std::string format;
+        uint64_t varcount, clausecount;
+
+        if (has_header || !(line_in >> format >> varcount >> clausecount) || format != "cnf") {
+          throw invalid_argument("Malformed DIMACS problem line: '" + line + "'");
+        }
+        if (static_cast<uint64_t>(bdd::max_label) + 1u < varcount) {
+          throw invalid_argument("Cannot represent that many variables");
+        }
+        res.varcount = static_cast<bdd::label_type>(varcount);
+        res.clauses.reserve(clausecount);
+        has_header = true;
+        continue;
+      }
+
+      if (!has_header) {
+        throw invalid_argument("DIMACS clause given before the problem line");
+      }
+
+      // Clause(s)
+      std::istringstream clause_in(line);
+      int64_t lit;
+      while (clause_in >> lit) {
+        if (lit == 0) {
+          close_clause();
+          continue;
+        }
+
+        const uint64_t var = static_cast<uint64_t>(lit < 0 ? -lit : lit);
+        if (res.varcount < var) {
+          throw invalid_argument("DIMACS literal '" + std::to_string(lit)
+                                 + "' exceeds the number of variables");
+        }
+        clause.push_back({ static_cast<bdd::label_type>(var - 1u), lit < 0 });
+        clause_open = true;
+      }
+      if (!clause_in.eof()) {
+        throw invalid_argument("Malformed DIMACS clause: '" + line + "'");
+      }
+    }
+
+    if (!has_header) {
+      throw invalid_argument("DIMACS problem line is missing");
+    }
+
+    // Be lenient with a missing '0' after the very last clause.
+    if (clause_open) { close_clause(); }
+
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief An intermediate result of the conjunction together with its
+  ///        (sorted) set of variables.
+  //////////////////////////////////////////////////////////////////////////////
+  struct cnf_item
+  {
+    bdd f;
+    std::vector<bdd::label_type> support;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Conjoins all items based on the given schedule while quantifying
+  ///        variables as early as possible.
+  //////////////////////////////////////////////////////////////////////////////
+  class cnf_conjoiner
+  {
+  private:
+    const exec_policy &_ep;
+
+    // Whether a variable ought to be quantified.
+    const std::vector<bool> &_quantify;
+
+    // Number of (current or future) items that depend on each variable.
+    std::vector<size_t> &_occurrences;
+
+    // Whether the conjunction has collapsed to the false terminal.
+    bool _is_false = false;
+
+    // Balanced: stack of items together with the number of clusters within.
+    std::vector<pair<size_t, cnf_item>> _stack;
+
+    // Min_Width: all items ordered by their width.
+    struct width_gt
+    {
+      bool operator() (const cnf_item &a, const cnf_item &b) const
+      { return a.f.width() > b.f.width(); }
+    };
+    std::priority_queue<cnf_item, std::vector<cnf_item>, width_gt> _heap;
+
+  public:
+    cnf_conjoiner(const exec_policy &ep,
+                  const std::vector<bool> &quantify,
+                  std::vector<size_t> &occurrences)
+      : _ep(ep), _quantify(quantify), _occurrences(occurrences)
+    { }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Quantify all variables that only occur within the given item.
+    ////////////////////////////////////////////////////////////////////////////
+    void quantify_local(cnf_item &i)
+    {
+      std::vector<bdd::label_type> local;
+      std::vector<bdd::label_type> rest;
+
+      for (const bdd::label_type x : i.support) {
+        if (_quantify[x] && _occurrences[x] == 1u) {
+          local.push_back(x);
+          _occurrences[x] = 0u;
+        } else {
+          rest.push_back(x);
+        }
+      }
+      if (local.empty()) { return; }
+
+      i.f = bdd_exists(_ep, std::move(i.f), make_generator(local.rbegin(), local.rend()));
+      i.support.swap(rest);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conjoin two items.
+    ////////////////////////////////////////////////////////////////////////////
+    cnf_item combine(const cnf_item &a, const cnf_item &b)
+    {
+      cnf_item res;
+      res.f = bdd_and(_ep, a.f, b.f);
+
+      // Variables in both now occur in one item less.
+      std::vector<bdd::label_type> shared;
+      std::set_intersection(a.support.begin(), a.support.end(),
+                            b.support.begin(), b.support.end(),
+                            std::back_inserter(shared));
+      for (const bdd::label_type x : shared) { _occurrences[x]--; }
+
+      std::set_union(a.support.begin(), a.support.end(),
+                     b.support.begin(), b.support.end(),
+                     std::back_inserter(res.support));
+
+      quantify_local(res);
+      _is_false |= bdd_isfalse(res.f);
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Add another item to the conjunction.
+    ////////////////////////////////////////////////////////////////////////////
+    void push(cnf_item &&i)
+    {
+      if (_is_false) { return; }
+
+      quantify_local(i);
+      if (bdd_isfalse(i.f)) { _is_false = true; return; }
+
+      switch (_ep.schedule_mode()) {
+      case exec_policy::schedule::Min_Width:
+        _heap.push(std::move(i));
+        return;
+
+      case exec_policy::schedule::Balanced:
+      default:
+        _stack.push_back({ 1u, std::move(i) });
+        while (2u <= _stack.size()
+               && _stack[_stack.size()-2u].first == _stack.back().first) {
+          pair<size_t, cnf_item> b = std::move(_stack.back());
+          _stack.pop_back();
+          pair<size_t, cnf_item> a = std::move(_stack.back());
+          _stack.pop_back();
+
+          _stack.push_back({ a.first + b.first, combine(a.second, b.second) });
+          if (_is_false) { return; }
+        }
+        return;
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conjoin all remaining items.
+    ////////////////////////////////////////////////////////////////////////////
+    bdd result()
+    {
+      if (_is_false) { return bdd_false(); }
+
+      // Min_Width
+      while (2u <= _heap.size()) {
+        cnf_item a = _heap.top();
+        _heap.pop();
+        cnf_item b = _heap.top();
+        _heap.pop();
+
+        _heap.push(combine(a, b));
+        if (_is_false) { return bdd_false(); }
+      }
+      if (!_heap.empty()) { return _heap.top().f; }
+
+      // Balanced (combine the remaining, and hence smallest, trees first)
+      while (2u <= _stack.size()) {
+        cnf_item b = std::move(_stack.back().second);
+        _stack.pop_back();
+
+        _stack.back().second = combine(_stack.back().second, b);
+        if (_is_false) { return bdd_false(); }
+      }
+      if (!_stack.empty()) { return _stack.back().second.f; }
+
+      return bdd_true();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  bdd
+  __bdd_from_cnf(const exec_policy &ep,
+                 cnf &&in,
+                 const predicate<bdd::label_type> &vars)
+  {
+    if (in.has_empty_clause) { return bdd_false(); }
+
+    // Cluster the clauses by their top variable (and then by their bottom
+    // variable, such that similar clauses are conjoined first).
+    std::sort(in.clauses.begin(), in.clauses.end(),
+              [](const cnf_clause &a, const cnf_clause &b) {
+                return a.back().first < b.back().first
+                  || (a.back().first == b.back().first && a.front().first < b.front().first);
+              });
+
+    std::vector<bool> quantify(in.varcount, false);
+    for (bdd::label_type x = 0u; x < in.varcount; ++x) {
+      quantify[x] = vars(x);
+    }
+
+    // Derive the support of each cluster and count in how many they occur.
+    std::vector<size_t> occurrences(in.varcount, 0u);
+    std::vector<std::vector<bdd::label_type>> supports;
+
+    for (size_t begin = 0u; begin < in.clauses.size();) {
+      const bdd::label_type top = in.clauses[begin].back().first;
+
+      std::vector<bdd::label_type> support;
+      size_t end = begin;
+      for (; end < in.clauses.size() && in.clauses[end].back().first == top; ++end) {
+        for (const cnf_literal &l : in.clauses[end]) { support.push_back(l.first); }
+      }
+      std::sort(support.begin(), support.end());
+      support.erase(std::unique(support.begin(), support.end()), support.end());
+
+      for (const bdd::label_type x : support) { occurrences[x]++; }
+      supports.push_back(std::move(support));
+
+      begin = end;
+    }
+
+    // Conjoin the clauses of each cluster and then the clusters themselves.
+    // Within a cluster, the clauses are given without their support, i.e.
+    // nothing is quantified before the cluster is complete.
+    const exec_policy cluster_ep = exec_policy(ep).set(exec_policy::schedule::Balanced);
+    const std::vector<bool> cluster_quantify;
+    std::vector<size_t> cluster_occurrences;
+
+    cnf_conjoiner result(ep, quantify, occurrences);
+
+    size_t cluster_idx = 0u;
+    for (size_t begin = 0u; begin < in.clauses.size(); ++cluster_idx) {
+      const bdd::label_type top = in.clauses[begin].back().first;
+
+      cnf_conjoiner cluster(cluster_ep, cluster_quantify, cluster_occurrences);
+
+      for (; begin < in.clauses.size() && in.clauses[begin].back().first == top; ++begin) {
+        const cnf_clause &c = in.clauses[begin];
+
+        cnf_item i;
+        i.f = bdd_or(make_generator(c.begin(), c.end()));
+        cluster.push(std::move(i));
+      }
+
+      cnf_item i;
+      i.f = cluster.result();
+      i.support = std::move(supports[cluster_idx]);
+      result.push(std::move(i));
+    }
+    return result.result();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  bdd bdd_from_cnf(const exec_policy &ep,
+                   std::istream &in,
+                   const predicate<bdd::label_type> &vars)
+  {
+    return __bdd_from_cnf(ep, __cnf_parse(in), vars);
+  }
+
+  bdd bdd_from_cnf(std::istream &in, const predicate<bdd::label_type> &vars)
+  {
+    return bdd_from_cnf(exec_policy(), in, vars);
+  }
+
+  bdd bdd_from_cnf(const exec_policy &ep, std::istream &in)
+  {
+    return bdd_from_cnf(ep, in, [](const bdd::label_type) { return false; });
+  }
+
+  bdd bdd_from_cnf(std::istream &in)
+  {
+    return bdd_from_cnf(exec_policy(), in);
+  }
+
+  bdd bdd_from_cnf(const exec_policy &ep,
+                   const std::string &file_name,
+                   const predicate<bdd::label_type> &vars)
+  {
+    std::ifstream in(file_name);
+    if (!in.is_open()) {
+      throw runtime_error("Cannot open file '" + file_name + "'");
+    }
+    return bdd_from_cnf(ep, in, vars);
+  }
+
+  bdd bdd_from_cnf(const std::string &file_name, const predicate<bdd::label_type> &vars)
+  {
+    return bdd_from_cnf(exec_policy(), file_name, vars);
+  }
+
+  bdd bdd_from_cnf(const exec_policy &ep, const std::string &file_name)
+  {
+    return bdd_from_cnf(ep, file_name, [](const bdd::label_type) { return false; });
+  }
+
+  bdd bdd_from_cnf(const std::string &file_name)
+  {
+    return bdd_from_cnf(exec_policy(), file_name);
+  }
+}
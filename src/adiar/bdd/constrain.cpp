@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <vector>
+
+#include <adiar/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
+
+#include <adiar/internal/bool_op.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/algorithms/prod2.h>
+#include <adiar/internal/data_types/tuple.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // The generalised cofactor is computed as a product of `f` and the care set
+  // `c` where the result at a pair of terminals always is the one of `f`. Hence,
+  // the operator is a projection; whether it projects onto the first or the
+  // second element tells us where `f` is in each request. This stays correct,
+  // even if `prod2` flips the inputs (and the operator) to use random access.
+  const bool_op constrain_op =
+    [](const internal::ptr_uint64 &f, const internal::ptr_uint64 &/*c*/) -> internal::ptr_uint64
+  {
+    return f;
+  };
+
+  class constrain_prod2_policy
+    : public bdd_policy
+    , public internal::prod2_mixed_level_merger<bdd_policy>
+  {
+  private:
+    static size_t __care_idx(const bool_op &op)
+    {
+      return op(bdd::pointer_type(false), bdd::pointer_type(true)) == bdd::pointer_type(false)
+        ? 1u : 0u;
+    }
+
+  public:
+    static __bdd resolve_same_file(const bdd &f, const bdd &c,
+                                   const bool_op &/*op*/)
+    {
+      // Nothing is to be cared for.
+      if (bdd_isfalse(c)) {
+        return bdd_false();
+      }
+
+      // Within `c`, the function `f` is true. Within `~c`, it is false.
+      return bdd_terminal(f.negate == c.negate);
+    }
+
+  public:
+    static __bdd resolve_terminal_root(const bdd &f, const bdd &c,
+                                       const bool_op &/*op*/)
+    {
+      adiar_assert(bdd_isterminal(f) || bdd_isterminal(c));
+
+      if (bdd_isfalse(c)) {
+        return bdd_false();
+      }
+      return f;
+    }
+
+  public:
+    static internal::cut left_cut(const bool_op &op)
+    {
+      const bool incl_false = !internal::can_left_shortcut(op, bdd::pointer_type(false));
+      const bool incl_true = !internal::can_left_shortcut(op, bdd::pointer_type(true));
+
+      return internal::cut(incl_false, incl_true);
+    }
+
+    static internal::cut right_cut(const bool_op &op)
+    {
+      const bool incl_false = !internal::can_right_shortcut(op, bdd::pointer_type(false));
+      const bool incl_true = !internal::can_right_shortcut(op, bdd::pointer_type(true));
+
+      return internal::cut(incl_false, incl_true);
+    }
+
+  private:
+    static internal::tuple<bdd::pointer_type>
+    __resolve_request(const size_t c_idx,
+                      const internal::tuple<bdd::pointer_type> &r)
+    {
+      // Is `f` a terminal? Then the result is `f` regardless of the care set.
+      const size_t f_idx = 1u - c_idx;
+      if (r[f_idx].is_terminal()) {
+        return c_idx == 1u
+          ? internal::tuple<bdd::pointer_type>{ r[0], bdd::pointer_type(true) }
+          : internal::tuple<bdd::pointer_type>{ bdd::pointer_type(true), r[1] };
+      }
+      return r;
+    }
+
+  public:
+    static internal::prod2_rec
+    resolve_request(const bool_op &op,
+                    const internal::tuple<bdd::pointer_type> &r_low,
+                    const internal::tuple<bdd::pointer_type> &r_high)
+    {
+      const size_t c_idx = __care_idx(op);
+
+      // Is one of the branches outside of the care set? Then, the result is
+      // the one of the other branch.
+      if (r_low[c_idx].is_false()) {
+        return __resolve_request(c_idx, r_high);
+      }
+      if (r_high[c_idx].is_false()) {
+        return __resolve_request(c_idx, r_low);
+      }
+
+      return internal::prod2_rec_output {
+        __resolve_request(c_idx, r_low),
+        __resolve_request(c_idx, r_high)
+      };
+    }
+
+    static constexpr bool no_skip = false;
+  };
+
+  __bdd bdd_constrain(const exec_policy &ep, const bdd &f, const bdd &c)
+  {
+    return internal::prod2<constrain_prod2_policy>(ep, f, c, constrain_op);
+  }
+
+  __bdd bdd_constrain(const bdd &f, const bdd &c)
+  {
+    return bdd_constrain(exec_policy(), f, c);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  __bdd bdd_simplify(const exec_policy &ep, const bdd &f, const bdd &c)
+  {
+    if (bdd_isterminal(f) || bdd_isterminal(c)) {
+      return bdd_constrain(ep, f, c);
+    }
+
+    // Quantify all variables of the care set that `f` does not depend on.
+    // Hence, the result cannot depend on any variables outside of `f`'s
+    // support.
+    std::vector<bdd::label_type> f_support;
+    bdd_support(f, [&f_support](const bdd::label_type x) { f_support.push_back(x); });
+    std::sort(f_support.begin(), f_support.end());
+
+    const bdd c_proj = bdd_exists(ep, c, [&f_support](const bdd::label_type x) {
+      return !std::binary_search(f_support.begin(), f_support.end(), x);
+    });
+
+    // As with other implementations of Coudert and Madre's restrict, do not
+    // return a result that is larger than `f` itself.
+    const bdd res = bdd_constrain(ep, f, c_proj);
+    return res.size() <= f.size() ? res : f;
+  }
+
+  __bdd bdd_simplify(const bdd &f, const bdd &c)
+  {
+    return bdd_simplify(exec_policy(), f, c);
+  }
+}
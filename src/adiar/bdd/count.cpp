@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <stdint.h>
+#include <vector>
 
 #include <adiar/bdd.h>
 #include <adiar/bdd/bdd_policy.h>
@@ -8,6 +12,8 @@
 #include <adiar/internal/assert.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/algorithms/count.h>
+#include <adiar/internal/io/file_stream.h>
+#include <adiar/internal/io/levelized_file_stream.h>
 
 namespace adiar
 {
@@ -35,8 +41,16 @@ namespace adiar
   public:
     using data_type = sat_data;
 
+    using result_type = uint64_t;
+
     static constexpr data_type init_data = { 1u, 0u };
 
+    static constexpr size_t
+    memory_usage()
+    {
+      return 0u;
+    }
+
     static constexpr uint64_t
     resolve_false(const data_type &/*d*/,
                   const typename bdd::label_type/*varcount*/)
@@ -76,8 +90,263 @@ namespace adiar
     {
       return { acc.sum, acc.levels_visited + 1u };
     }
+
+    static inline data_type
+    forward(const data_type &d,
+            const internal::node &/*n*/,
+            const bool /*high*/)
+    {
+      return d;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Weighted Model Counting Policy
+  struct wmc_data
+  {
+    /// Weight of all (partial) assignments from the root to the target
+    double weight;
+
+    static constexpr bool sort_on_tiebreak = false;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Arithmetic on weights, either as-is or in log-space.
+  //////////////////////////////////////////////////////////////////////////////
+  template<bool LogSpace>
+  struct wmc_arithmetic
+  {
+    static constexpr double zero = LogSpace ? -std::numeric_limits<double>::infinity() : 0.0;
+    static constexpr double one  = LogSpace ? 0.0 : 1.0;
+
+    static inline double
+    from(const double w)
+    { return LogSpace ? std::log(w) : w; }
+
+    static inline double
+    add(const double a, const double b)
+    {
+      if constexpr (LogSpace) {
+        if (a == zero) { return b; }
+        if (b == zero) { return a; }
+
+        // log(e^a + e^b) without overflow or underflow of e^a and e^b.
+        const double max = std::max(a, b);
+        return max + std::log1p(std::exp(-std::abs(a - b)));
+      } else {
+        return a + b;
+      }
+    }
+
+    static inline double
+    mult(const double a, const double b)
+    { return LogSpace ? a + b : a * b; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sum of weights (accumulated by the count algorithm).
+  //////////////////////////////////////////////////////////////////////////////
+  template<bool LogSpace>
+  struct wmc_sum
+  {
+    double value = wmc_arithmetic<LogSpace>::zero;
+
+    wmc_sum& operator +=(const wmc_sum &o)
+    {
+      value = wmc_arithmetic<LogSpace>::add(value, o.value);
+      return *this;
+    }
   };
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Policy for weighted model counting.
+  ///
+  /// \details The weight of an arc is the weight of the literal it stands for
+  ///          times the total weight, w(x) + w(~x), of all variables in the
+  ///          domain that are skipped by it. Hence, all requests for a node
+  ///          include the weight of all variables above it and can be merged by
+  ///          simply adding them.
+  //////////////////////////////////////////////////////////////////////////////
+  template<bool LogSpace>
+  class wmc_policy : public bdd_policy
+  {
+  private:
+    using arithmetic = wmc_arithmetic<LogSpace>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief All variables (in ascending order).
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<bdd::label_type> _vars;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Weight of the negative and the positive literal of each variable.
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<double> _weights[2];
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Total weight of the variables [i, i+2^k) at `_skip[k][i]`.
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<std::vector<double>> _skip;
+
+  public:
+    using data_type = wmc_data;
+
+    using result_type = wmc_sum<LogSpace>;
+
+    static constexpr data_type init_data = { arithmetic::one };
+
+  public:
+    wmc_policy(const bdd &f, const function<double(bdd::label_type, bool)> &w)
+    {
+      // Variables of the domain (if any) and of f.
+      if (domain_isset()) {
+        internal::file_stream<domain_var> ds(domain_get());
+        while (ds.can_pull()) { _vars.push_back(ds.pull()); }
+      }
+      internal::dd_support(f, [this](const bdd::label_type x) { _vars.push_back(x); });
+
+      std::sort(_vars.begin(), _vars.end());
+      _vars.erase(std::unique(_vars.begin(), _vars.end()), _vars.end());
+
+      // Weights of each literal
+      for (const bdd::label_type x : _vars) {
+        const double w_neg = w(x, false);
+        const double w_pos = w(x, true);
+
+        if constexpr (LogSpace) {
+          if (w_neg < 0.0 || w_pos < 0.0) {
+            throw invalid_argument("Weights must be non-negative in log-space");
+          }
+        }
+
+        _weights[false].push_back(arithmetic::from(w_neg));
+        _weights[true].push_back(arithmetic::from(w_pos));
+      }
+
+      // Total weight of all ranges of length 2^k
+      _skip.push_back({});
+      for (size_t i = 0; i < _vars.size(); ++i) {
+        _skip[0].push_back(arithmetic::add(_weights[false][i], _weights[true][i]));
+      }
+      for (size_t k = 1; (1u << k) <= _vars.size(); ++k) {
+        const size_t half = 1u << (k-1);
+
+        _skip.push_back({});
+        for (size_t i = 0; i + (1u << k) <= _vars.size(); ++i) {
+          _skip[k].push_back(arithmetic::mult(_skip[k-1][i], _skip[k-1][i + half]));
+        }
+      }
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used by the variables, the weights, and the skip table.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t memory_usage() const
+    {
+      size_t res = _vars.capacity() * sizeof(bdd::label_type)
+        + (_weights[false].capacity() + _weights[true].capacity()) * sizeof(double)
+        + _skip.capacity() * sizeof(std::vector<double>);
+
+      for (const std::vector<double> &s : _skip) {
+        res += s.capacity() * sizeof(double);
+      }
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the variable `x`.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t index(const bdd::label_type x) const
+    {
+      const auto it = std::lower_bound(_vars.begin(), _vars.end(), x);
+      adiar_assert(it != _vars.end() && *it == x, "Variable is known");
+      return static_cast<size_t>(it - _vars.begin());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Total weight of the variables with index in [begin, end).
+    ////////////////////////////////////////////////////////////////////////////
+    double skip(size_t begin, const size_t end) const
+    {
+      double res = arithmetic::one;
+      for (size_t k = _skip.size(); 0 < k; --k) {
+        if (begin + (1u << (k-1)) <= end) {
+          res = arithmetic::mult(res, _skip[k-1][begin]);
+          begin += 1u << (k-1);
+        }
+      }
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Total weight of the variables above the root of `f`.
+    ////////////////////////////////////////////////////////////////////////////
+    double skip_root(const bdd &f) const
+    {
+      return skip(0u, bdd_isterminal(f) ? _vars.size() : index(f->first_level()));
+    }
+
+  public:
+    static inline result_type
+    resolve_false(const data_type &/*d*/,
+                  const typename bdd::label_type/*varcount*/)
+    {
+      return { arithmetic::zero };
+    }
+
+    static inline result_type
+    resolve_true(const data_type &d,
+                 const typename bdd::label_type/*varcount*/)
+    {
+      return { d.weight };
+    }
+
+    static inline data_type
+    merge(const data_type &&acc, const data_type &next)
+    {
+      return { arithmetic::add(acc.weight, next.weight) };
+    }
+
+    static inline data_type
+    merge_end(const data_type &&acc)
+    {
+      return acc;
+    }
+
+    inline data_type
+    forward(const data_type &d,
+            const internal::node &n,
+            const bool high) const
+    {
+      const size_t n_idx = index(n.label());
+
+      const internal::node::pointer_type c = high ? n.high() : n.low();
+      const size_t c_idx = c.is_terminal() ? _vars.size() : index(c.label());
+
+      return { arithmetic::mult(arithmetic::mult(d.weight, _weights[high][n_idx]),
+                                skip(n_idx + 1u, c_idx)) };
+    }
+  };
+
+  template<bool LogSpace>
+  double __bdd_wmc(const exec_policy &ep,
+                   const bdd &f,
+                   const function<double(bdd::label_type, bool)> &w)
+  {
+    const wmc_policy<LogSpace> policy(f, w);
+
+    if (bdd_isterminal(f)) {
+      return dd_valueof(f) ? policy.skip_root(f) : wmc_arithmetic<LogSpace>::zero;
+    }
+
+    const wmc_sum<LogSpace> res =
+      internal::count<wmc_policy<LogSpace>>(ep, f, bdd_varcount(f), policy);
+
+    return wmc_arithmetic<LogSpace>::mult(policy.skip_root(f), res.value);
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   size_t bdd_nodecount(const bdd &f)
   {
@@ -122,4 +391,36 @@ namespace adiar
 
   uint64_t bdd_satcount(const bdd &f)
   { return bdd_satcount(exec_policy(), f); };
+
+  double bdd_wmc(const exec_policy &ep,
+                 const bdd &f,
+                 const function<double(bdd::label_type, bool)> &w)
+  { return __bdd_wmc<false>(ep, f, w); }
+
+  double bdd_wmc(const bdd &f, const function<double(bdd::label_type, bool)> &w)
+  { return bdd_wmc(exec_policy(), f, w); }
+
+  double bdd_wmc_log(const exec_policy &ep,
+                     const bdd &f,
+                     const function<double(bdd::label_type, bool)> &w)
+  { return __bdd_wmc<true>(ep, f, w); }
+
+  double bdd_wmc_log(const bdd &f, const function<double(bdd::label_type, bool)> &w)
+  { return bdd_wmc_log(exec_policy(), f, w); }
+
+  double bdd_probability(const exec_policy &ep,
+                         const bdd &f,
+                         const function<double(bdd::label_type)> &p)
+  {
+    return bdd_wmc(ep, f, [&p](const bdd::label_type x, const bool value) {
+      const double p_x = p(x);
+      if (p_x < 0.0 || 1.0 < p_x) {
+        throw invalid_argument("Probabilities must be within [0,1]");
+      }
+      return value ? p_x : 1.0 - p_x;
+    });
+  }
+
+  double bdd_probability(const bdd &f, const function<double(bdd::label_type)> &p)
+  { return bdd_probability(exec_policy(), f, p); }
 }
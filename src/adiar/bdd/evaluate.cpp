@@ -9,6 +9,7 @@
 #include <adiar/internal/cut.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/util.h>
+#include <adiar/internal/algorithms/count.h>
 #include <adiar/internal/algorithms/traverse.h>
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/io/file_stream.h>
@@ -106,6 +107,120 @@ namespace adiar
     return v.get_result();
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  // Batched evaluation as a variant of the Count algorithm: the 64 bit-sliced
+  // assignments are a set of 'lanes' that are split at each node in the ones
+  // going low and the ones going high.
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// Auxiliary data for the Priority Queue in the batched evaluation.
+  //////////////////////////////////////////////////////////////////////////////
+  struct eval_batch_data
+  {
+    /// Assignments (lanes) that reach the target
+    uint64_t lanes;
+
+    static constexpr bool sort_on_tiebreak = false;
+  };
+
+  template<typename PriorityQueue>
+  uint64_t __bdd_eval_batch(const bdd &f,
+                            const function<uint64_t(bdd::label_type)> &xs,
+                            const size_t pq_max_memory,
+                            const size_t pq_max_size)
+  {
+    // Set up output
+    uint64_t result = 0u;
+
+    // Set up input
+    internal::node_stream<> ns(f);
+
+    // Set up cross-level priority queue with a request for the root
+    PriorityQueue eval_pq({f}, pq_max_memory, pq_max_size, internal::stats_count.lpq);
+    eval_pq.push({ {ns.peek().uid()}, {}, { ~static_cast<uint64_t>(0u) } });
+
+    while (!eval_pq.empty()) {
+      eval_pq.setup_next_level();
+
+      const uint64_t level_xs = xs(eval_pq.current_level());
+
+      while (!eval_pq.empty_level()) {
+        // Merge requests for the next node
+        const typename PriorityQueue::value_type request = eval_pq.pull();
+        uint64_t lanes = request.data.lanes;
+
+        while (eval_pq.can_pull() && eval_pq.top().target == request.target) {
+          lanes |= eval_pq.pull().data.lanes;
+        }
+
+        // Skip nodes no assignment reaches
+        while (ns.peek().uid() != request.target.first()) { ns.pull(); }
+        const bdd::node_type n = ns.pull();
+
+        // Split the lanes between the children
+        const uint64_t lanes_low  = lanes & ~level_xs;
+        const uint64_t lanes_high = lanes & level_xs;
+
+        for (const auto& [child, child_lanes] : { std::make_pair(n.low(),  lanes_low),
+                                                  std::make_pair(n.high(), lanes_high) }) {
+          if (child_lanes == 0u) { continue; }
+
+          if (child.is_terminal()) {
+            result |= child.value() ? child_lanes : 0u;
+          } else {
+            eval_pq.push({ {child}, {}, { child_lanes } });
+          }
+        }
+      }
+    }
+
+    return result;
+  }
+
+  uint64_t bdd_eval_batch(const exec_policy &ep,
+                          const bdd &f,
+                          const function<uint64_t(bdd::label_type)> &xs)
+  {
+    if (bdd_isterminal(f)) {
+      return bdd_istrue(f) ? ~static_cast<uint64_t>(0u) : 0u;
+    }
+
+    using data_type = eval_batch_data;
+
+    // Compute amount of memory available for auxiliary data structures after
+    // having opened all streams.
+    const size_t aux_available_memory =
+      internal::memory_available(ep) - internal::node_stream<>::memory_usage();
+
+    const size_t pq_memory_fits =
+      internal::count_priority_queue_t<data_type, ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Internal>
+      ::memory_fits(aux_available_memory);
+
+    const bool internal_only = ep.memory_mode() == exec_policy::memory::Internal;
+    const bool external_only = ep.memory_mode() == exec_policy::memory::External;
+
+    const size_t pq_bound = f.max_2level_cut(internal::cut::Internal);
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if(!external_only && max_pq_size <= internal::no_lookahead_bound()) {
+      return __bdd_eval_batch<internal::count_priority_queue_t<data_type, 0, internal::memory_mode::Internal>>
+        (f, xs, aux_available_memory, max_pq_size);
+    } else if(!external_only && max_pq_size <= pq_memory_fits) {
+      return __bdd_eval_batch<internal::count_priority_queue_t<data_type, ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Internal>>
+        (f, xs, aux_available_memory, max_pq_size);
+    } else {
+      return __bdd_eval_batch<internal::count_priority_queue_t<data_type, ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::External>>
+        (f, xs, aux_available_memory, max_pq_size);
+    }
+  }
+
+  uint64_t bdd_eval_batch(const bdd &f,
+                          const function<uint64_t(bdd::label_type)> &xs)
+  {
+    return bdd_eval_batch(exec_policy(), f, xs);
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   template<typename Visitor>
   class bdd_satX__stack
@@ -1,15 +1,18 @@
 #include <adiar/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
 
 #include <adiar/exec_policy.h>
 
 #include <adiar/internal/io/levelized_file_stream.h>
 #include <adiar/internal/io/levelized_file_writer.h>
 #include <adiar/internal/assert.h>
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/memory.h>
 #include <adiar/internal/util.h>
+#include <adiar/internal/algorithms/depth_first.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/data_types/request.h>
@@ -261,6 +264,8 @@ namespace adiar
       const internal::node::label_type out_label = ite_pq_1.current_level();
       internal::node::id_type out_id = 0;
 
+      internal::level_checkpoint(ep, out_label, ite_pq_1.size(), aw);
+
       // Update max 1-level cut
       out_arcs->max_1level_cut = std::max(out_arcs->max_1level_cut, ite_pq_1.size());
 
@@ -531,38 +536,47 @@ namespace adiar
     if (g.file == h.file) {
       return g.negate == h.negate
         ? __bdd(g)
-        : bdd_xnor(f, g);
+        : bdd_xnor(ep, f, g);
     }
 
     // Resolve being given the same underlying file for conditional and a case
     if (f.file == g.file) {
       return f.negate == g.negate
-        ? bdd_or(f, h)
-        : bdd_and(bdd_not(f), h);
+        ? bdd_or(ep, f, h)
+        : bdd_and(ep, bdd_not(f), h);
     } else if (f.file == h.file) {
       return f.negate == h.negate
-        ? bdd_and(f, g)
-        : bdd_imp(f, g);
+        ? bdd_and(ep, f, g)
+        : bdd_imp(ep, f, g);
     }
 
     // Resolve being given a terminal in one of the cases
     if (bdd_isterminal(g)) {
-      return bdd_apply(dd_valueof(g) ? f : bdd_not(f),
+      return bdd_apply(ep,
+                       dd_valueof(g) ? f : bdd_not(f),
                        h,
                        dd_valueof(g) ? or_op : and_op);
     } else if (bdd_isterminal(h))  {
-      return bdd_apply(f,
+      return bdd_apply(ep,
+                       f,
                        g,
                        dd_valueof(h) ? imp_op : and_op);
     }
 
+    // Resolve small (and non-trivial) inputs with a depth-first algorithm
+    if (!bdd_isterminal(f)
+        && internal::depth_first_fits(ep, f.size() + g.size() + h.size())) {
+      const optional<bdd> res = internal::depth_first_ite<bdd_policy>(ep, f, g, h);
+      if (res) { return res.value(); }
+    }
+
     // Compute amount of memory available for auxiliary data structures after
     // having opened all streams.
     //
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const tpie::memory_size_type aux_available_memory = internal::memory_available()
+    const tpie::memory_size_type aux_available_memory = internal::memory_available(ep)
       // Input streams
       - 3*internal::node_stream<>::memory_usage()
       // Output stream
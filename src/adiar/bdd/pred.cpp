@@ -1,8 +1,11 @@
 #include <adiar/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
 
+#include <adiar/internal/cut.h>
 #include <adiar/internal/io/node_stream.h>
 
 #include <adiar/internal/algorithms/pred.h>
+#include <adiar/internal/algorithms/prod2.h>
 
 namespace adiar
 {
@@ -99,4 +102,163 @@ namespace adiar
   {
     return bdd_unequal(exec_policy(), f, g);
   }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // In a reduced BDD, every internal node represents a non-constant function.
+  // Hence, a pair of a terminal and a node already decides whether the
+  // (sub)functions can be in the relation: no further recursion is needed.
+  class bdd_implies_policy
+    : public bdd_policy
+    , public internal::prod2_mixed_level_merger<bdd_policy>
+  {
+  public:
+    using level_check_t = internal::ignore_levels<internal::cut::Internal, internal::cut::Internal>;
+
+  public:
+    static constexpr size_t lookahead_bound()
+    {
+      return 2;
+    }
+
+  public:
+    static bool resolve_terminals(const bdd::node_type &v1, const bdd::node_type &v2, bool &ret_value)
+    {
+      ret_value = v1.is_false() || v2.is_true();
+      return true;
+    }
+
+  public:
+    static bool resolve_singletons(const bdd::node_type &v1, const bdd::node_type &v2)
+    {
+      return v1.label() == v2.label()
+        && (!v1.low().value()  || v2.low().value())
+        && (!v1.high().value() || v2.high().value());
+    }
+
+  public:
+    template<typename pq_1_t>
+    static bool resolve_request(pq_1_t &pq, const internal::tuple<bdd::pointer_type> &rp)
+    {
+      // Is the left-hand side unsatisfiable or the right-hand side a tautology?
+      // If so, then the implication holds for this pair.
+      if (rp[0].is_false() || rp[1].is_true()) {
+        return false;
+      }
+
+      // Otherwise, is the left-hand side satisfied or the right-hand side
+      // falsified? Since the other (if it is a node) is non-constant, there is
+      // an assignment that contradicts the implication.
+      if (rp[0].is_true() || rp[1].is_false()) {
+        return true;
+      }
+
+      // Otherwise, recurse
+      pq.push({ rp, {} });
+      return false;
+    }
+
+  public:
+    static constexpr bool early_return_value = false;
+    static constexpr bool no_early_return_value = true;
+  };
+
+  bool bdd_implies(const exec_policy &ep, const bdd &f, const bdd &g)
+  {
+    if (f.file == g.file && f.negate == g.negate) {
+      return true;
+    }
+    return internal::comparison_check<bdd_implies_policy>(ep, f, g);
+  }
+
+  bool bdd_implies(const bdd &f, const bdd &g)
+  {
+    return bdd_implies(exec_policy(), f, g);
+  }
+
+  bool bdd_subseteq(const exec_policy &ep, const bdd &f, const bdd &g)
+  {
+    return bdd_implies(ep, f, g);
+  }
+
+  bool bdd_subseteq(const bdd &f, const bdd &g)
+  {
+    return bdd_subseteq(exec_policy(), f, g);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  class bdd_disjoint_policy
+    : public bdd_policy
+    , public internal::prod2_mixed_level_merger<bdd_policy>
+  {
+  public:
+    using level_check_t = internal::ignore_levels<internal::cut::Internal, internal::cut::Internal>;
+
+  public:
+    static constexpr size_t lookahead_bound()
+    {
+      return 2;
+    }
+
+  public:
+    static bool resolve_terminals(const bdd::node_type &v1, const bdd::node_type &v2, bool &ret_value)
+    {
+      ret_value = v1.is_false() || v2.is_false();
+      return true;
+    }
+
+  public:
+    static bool resolve_singletons(const bdd::node_type &v1, const bdd::node_type &v2)
+    {
+      return v1.label() == v2.label()
+        && !(v1.low().value()  && v2.low().value())
+        && !(v1.high().value() && v2.high().value());
+    }
+
+  public:
+    template<typename pq_1_t>
+    static bool resolve_request(pq_1_t &pq, const internal::tuple<bdd::pointer_type> &rp)
+    {
+      // Has either side become unsatisfiable? If so, nothing is shared.
+      if (rp[0].is_false() || rp[1].is_false()) {
+        return false;
+      }
+
+      // Otherwise, is either side satisfied? Since the other (if it is a node)
+      // is non-constant, there is an assignment satisfying both.
+      if (rp[0].is_true() || rp[1].is_true()) {
+        return true;
+      }
+
+      // Otherwise, recurse
+      pq.push({ rp, {} });
+      return false;
+    }
+
+  public:
+    static constexpr bool early_return_value = false;
+    static constexpr bool no_early_return_value = true;
+  };
+
+  bool bdd_disjoint(const exec_policy &ep, const bdd &f, const bdd &g)
+  {
+    if (f.file == g.file) {
+      return f.negate != g.negate || bdd_isfalse(f);
+    }
+    return internal::comparison_check<bdd_disjoint_policy>(ep, f, g);
+  }
+
+  bool bdd_disjoint(const bdd &f, const bdd &g)
+  {
+    return bdd_disjoint(exec_policy(), f, g);
+  }
+
+  bool bdd_intersects(const exec_policy &ep, const bdd &f, const bdd &g)
+  {
+    return !bdd_disjoint(ep, f, g);
+  }
+
+  bool bdd_intersects(const bdd &f, const bdd &g)
+  {
+    return bdd_intersects(exec_policy(), f, g);
+  }
 }
@@ -5,6 +5,7 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/bool_op.h>
+#include <adiar/internal/algorithms/depth_first.h>
 #include <adiar/internal/algorithms/quantify.h>
 #include <adiar/internal/data_types/arc.h>
 #include <adiar/internal/data_types/node.h>
@@ -75,6 +76,10 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////
   __bdd bdd_exists(const exec_policy &ep, const bdd &f, bdd::label_type var)
   {
+    if (!bdd_isterminal(f) && internal::depth_first_fits(ep, f.size())) {
+      const optional<bdd> res = internal::depth_first_quantify<bdd_policy>(ep, f, var, or_op);
+      if (res) { return res.value(); }
+    }
     return internal::quantify<bdd_quantify_policy>(ep, f, var, or_op);
   }
 
@@ -135,6 +140,10 @@ namespace adiar
 
   __bdd bdd_forall(const exec_policy &ep, const bdd &f, bdd::label_type var)
   {
+    if (!bdd_isterminal(f) && internal::depth_first_fits(ep, f.size())) {
+      const optional<bdd> res = internal::depth_first_quantify<bdd_policy>(ep, f, var, and_op);
+      if (res) { return res.value(); }
+    }
     return internal::quantify<bdd_quantify_policy>(ep, f, var, and_op);
   }
 
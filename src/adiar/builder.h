@@ -1,6 +1,11 @@
 #ifndef ADIAR_BUILDER_H
 #define ADIAR_BUILDER_H
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
 #include <adiar/exception.h>
 #include <adiar/bdd/bdd_policy.h>
 #include <adiar/zdd/zdd_policy.h>
@@ -29,18 +34,6 @@ namespace adiar
   ///
   /// \{
 
-  /// \cond
-  //////////////////////////////////////////////////////////////////////////////
-  /// \brief Shared information between the builder and its pointers.
-  ///
-  /// \see builder buider_ptr
-  //////////////////////////////////////////////////////////////////////////////
-  struct builder_shared
-  {
-
-  };
-  /// \endcond
-
   template<typename dd_policy>
   class builder;
 
@@ -59,20 +52,22 @@ namespace adiar
   private:
     ///////////////////////////////////////////////////////////////////////////////
     /// \brief The unique identifier of a prior node.
+    ///
+    /// \details If the parent builder canonicalises its nodes, then the
+    ///          identifier of a node is only temporary until its level is done.
     ///////////////////////////////////////////////////////////////////////////////
     // TODO: rename to 'ptr ptr' when using complement edges
     /*const*/ internal::node::uid_type uid;
 
     ///////////////////////////////////////////////////////////////////////////////
-    /// \brief Unique shared reference for the parent builder object.
+    /// \brief Index of the node within the parent builder (if `uid` is a node).
     ///////////////////////////////////////////////////////////////////////////////
-    /*const*/ shared_ptr<const builder_shared> builder_ref;
+    /*const*/ size_t handle = 0u;
 
     ///////////////////////////////////////////////////////////////////////////////
-    /// \brief Reference for this specific 'uid' recording whether it is a child
-    ///        of a node created later than itself.
+    /// \brief Identifier of the parent builder's current phase (zero if none).
     ///////////////////////////////////////////////////////////////////////////////
-    /*const*/ shared_ptr<bool> unreferenced = make_shared<bool>(true);
+    /*const*/ uint64_t builder_id = 0u;
 
   public:
     ////////////////////////////////////////////////////////////////////////////
@@ -107,11 +102,14 @@ namespace adiar
     ///
     /// \param p  Unique identifier of one of Adiar's nodes.
     ///
-    /// \param sp Reference (read-only) to the builder's shared information.
+    /// \param h  Index of the node within the builder.
+    ///
+    /// \param id Identifier of the builder's current phase.
     ////////////////////////////////////////////////////////////////////////////
     builder_ptr(const internal::node::uid_type &p,
-                const shared_ptr<const builder_shared> &sp)
-      : uid(p), builder_ref(sp)
+                const size_t h,
+                const uint64_t id)
+      : uid(p), handle(h), builder_id(id)
     { }
   };
 
@@ -135,6 +133,19 @@ namespace adiar
   /// \details Nodes should be added bottom-up. Each added node returns a
   ///          builder_ptr so that it can be used as a child for other nodes.
   ///
+  ///          If the builder canonicalises, then the nodes of each level are
+  ///          kept in an (internal memory) hash table until the level is done.
+  ///          This way, duplicate nodes are merged and the nodes are written in
+  ///          the canonical order, i.e. the resulting decision diagram is
+  ///          reduced. Otherwise, each node is immediately written to disk.
+  ///
+  /// \remark  Since a builder_ptr may be used as a child at any later point,
+  ///          a canonicalising builder also keeps the final identifier of
+  ///          \e every node created so far in internal memory, i.e. its memory
+  ///          usage is linear in the size of the whole decision diagram (8
+  ///          bytes per node) rather than only in the width of its widest
+  ///          level.
+  ///
   /// \tparam dd_policy Logic related to the specific type of decision diagram
   ///                   to construct.
   ///////////////////////////////////////////////////////////////////////////////
@@ -149,6 +160,21 @@ namespace adiar
     /////////////////////////////////////////////////////////////////////////////
     using node_type = typename dd_policy::node_type;
 
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of pointers within the nodes.
+    /////////////////////////////////////////////////////////////////////////////
+    using pointer_type = typename node_type::pointer_type;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Marker for an empty slot in 'level_slots'.
+    /////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t empty_slot = 0u;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether to merge duplicate nodes and output them canonically.
+    /////////////////////////////////////////////////////////////////////////////
+    const bool canonicalising;
+
     /////////////////////////////////////////////////////////////////////////////
     /// \brief File containing all prior pushed nodes.
     /////////////////////////////////////////////////////////////////////////////
@@ -185,15 +211,52 @@ namespace adiar
     size_t unref_nodes;
 
     /////////////////////////////////////////////////////////////////////////////
-    /// \brief Unique struct for this builder's current phase.
+    /// \brief Identifier of this builder's current phase.
+    /////////////////////////////////////////////////////////////////////////////
+    uint64_t builder_id = 0u;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether each node (by its handle) is yet unreferenced.
     /////////////////////////////////////////////////////////////////////////////
-    shared_ptr<builder_shared> builder_ref;
+    std::vector<bool> unreferenced;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief The final uid of each node (by its handle) if canonicalising.
+    ///
+    /// \details This grows with every node created (not only with the current
+    ///          level), since any prior builder_ptr may still be used as a
+    ///          child.
+    /////////////////////////////////////////////////////////////////////////////
+    std::vector<typename node_type::uid_type> uids;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Nodes of the current level (with temporary identifiers) if
+    ///        canonicalising.
+    /////////////////////////////////////////////////////////////////////////////
+    std::vector<node_type> level_nodes;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Handle of the first node on the current level.
+    /////////////////////////////////////////////////////////////////////////////
+    size_t level_handle;
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Hash slots of `index + 1` into 'level_nodes' (open addressing
+    ///        with linear probing).
+    /////////////////////////////////////////////////////////////////////////////
+    std::vector<size_t> level_slots;
 
   public:
     /////////////////////////////////////////////////////////////////////////////
     /// \brief Constructor.
+    ///
+    /// \param canonicalise Whether to merge duplicate nodes and output the
+    ///                     result in its canonical form. This requires space
+    ///                     for the widest level in internal memory together
+    ///                     with the final identifier of each node created.
     /////////////////////////////////////////////////////////////////////////////
-    builder() noexcept
+    explicit builder(const bool canonicalise = false) noexcept
+      : canonicalising(canonicalise)
     { }
 
     /////////////////////////////////////////////////////////////////////////////
@@ -220,8 +283,9 @@ namespace adiar
     /// \remark This will apply the first reduction rule associated with the
     ///         specific type of decision diagram, e.g. not construct a "don’t
     ///         care" node for \ref bdd but instead just return its child. The
-    ///         builder cannot apply the second reduction rule, i.e. merging of
-    ///         duplicate nodes, so that is still left up to you to do.
+    ///         second reduction rule, i.e. merging of duplicate nodes, is only
+    ///         applied if the builder canonicalises. Otherwise, that is still
+    ///         left up to you to do.
     ///
     /// \throws invalid_argument If a node is malformed or not added in
     ///                          bottom-up order.
@@ -235,7 +299,7 @@ namespace adiar
       attach_if_needed();
 
       // Check validity of input
-      if(low.builder_ref != builder_ref || high.builder_ref != builder_ref) {
+      if(low.builder_id != builder_id || high.builder_id != builder_id) {
         throw invalid_argument("Cannot use pointers from a different builder");
       }
       if(label > dd_policy::max_label) {
@@ -253,12 +317,16 @@ namespace adiar
 
       // Update label and ID if necessary
       if(label < current_label) {
+        flush_level();
         current_label = label;
         current_id = dd_policy::max_id;
       }
 
       // Create potential node
-      const node_type n(label, current_id, low.uid, high.uid);
+      const pointer_type low_uid  = resolve(low);
+      const pointer_type high_uid = resolve(high);
+
+      const node_type n(label, current_id, low_uid, high_uid);
 
       // Check whether this node is 'redundant'
       const typename node_type::uid_type res_uid = dd_policy::reduction_rule(n);
@@ -268,28 +336,37 @@ namespace adiar
         terminal_val = res_uid.value();
       }
 
-      if(res_uid == low.uid) { return low; }
-      if(res_uid == high.uid) { return high; }
+      if(res_uid == low_uid) { return low; }
+      if(res_uid == high_uid) { return high; }
+
+      // Check whether this node is a duplicate (if canonicalising)
+      if (canonicalising) {
+        const size_t slot = find_slot(n);
+
+        if (level_slots[slot] != empty_slot) {
+          const size_t idx = level_slots[slot] - 1u;
+          return make_ptr(level_nodes[idx].uid(), level_handle + idx);
+        }
+        level_nodes.push_back(n);
+        level_slots[slot] = level_nodes.size();
+
+        uids.push_back(n.uid());
+        grow_slots_if_needed();
+      } else {
+        // Push node to file
+        nw.push(n);
+      }
 
-      // Push node to file
-      nw.push(n);
+      const size_t handle = unreferenced.size();
+      unreferenced.push_back(true);
       unref_nodes++;
       current_id--;
 
       // Update count of unreferenced nodes
-      bool& low_unref = *low.unreferenced;
-      if(low_unref && !low.uid.is_terminal()) {
-        low_unref = false;
-        unref_nodes--;
-      }
-
-      bool& high_unref = *high.unreferenced;
-      if(high_unref && !high.uid.is_terminal()) {
-        high_unref = false;
-        unref_nodes--;
-      }
+      mark_referenced(low);
+      mark_referenced(high);
 
-      return make_ptr(res_uid);
+      return make_ptr(res_uid, handle);
     }
 
     /////////////////////////////////////////////////////////////////////////////
@@ -411,6 +488,7 @@ namespace adiar
     typename dd_policy::dd_type build()
     {
       attach_if_needed();
+      flush_level();
 
       if(!nw.has_pushed()) {
         if(created_terminal) {
@@ -460,9 +538,10 @@ namespace adiar
         created_terminal = false;
         terminal_val     = false;
         unref_nodes      = 0;
+        level_handle     = 0;
 
-        // Initialise shared builder reference.
-        builder_ref      = make_shared<builder_shared>();
+        // Obtain a fresh identifier, invalidating all prior pointers.
+        builder_id       = next_builder_id();
       }
     }
 
@@ -473,14 +552,128 @@ namespace adiar
     {
       nw.detach();
       nf.reset();
+
+      // Release all memory (but the hash table's slots for the next phase)
+      std::vector<bool>().swap(unreferenced);
+      std::vector<typename node_type::uid_type>().swap(uids);
+      level_nodes.clear();
+      std::fill(level_slots.begin(), level_slots.end(), empty_slot);
     }
 
     /////////////////////////////////////////////////////////////////////////////
     /// \brief Create a builder_ptr with 'this' builder as its parent.
     /////////////////////////////////////////////////////////////////////////////
-    builder_ptr<dd_policy> make_ptr(const typename node_type::pointer_type &p) noexcept
+    builder_ptr<dd_policy> make_ptr(const pointer_type &p, const size_t handle = 0u) noexcept
     {
-      return builder_ptr<dd_policy>(p, builder_ref);
+      return builder_ptr<dd_policy>(p, handle, builder_id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief A fresh identifier for a builder's phase (never zero).
+    /////////////////////////////////////////////////////////////////////////////
+    static uint64_t next_builder_id() noexcept
+    {
+      static std::atomic<uint64_t> counter(0u);
+      return ++counter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief The final uid of a pointer's target.
+    ///
+    /// \pre The level of `p` is done, i.e. it is not the current level.
+    /////////////////////////////////////////////////////////////////////////////
+    pointer_type resolve(const builder_ptr<dd_policy> &p) const
+    {
+      if (!canonicalising || p.uid.is_terminal()) { return p.uid; }
+
+      adiar_assert(p.handle < level_handle, "Node must be on a finished level");
+      return uids[p.handle];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Record that the target of `p` has a parent.
+    /////////////////////////////////////////////////////////////////////////////
+    void mark_referenced(const builder_ptr<dd_policy> &p)
+    {
+      if (p.uid.is_terminal()) { return; }
+
+      std::vector<bool>::reference p_unref = unreferenced[p.handle];
+      if (p_unref) {
+        p_unref = false;
+        unref_nodes--;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Slot of the node with the same children as `n` or the empty slot
+    ///        where it is to be placed.
+    /////////////////////////////////////////////////////////////////////////////
+    size_t find_slot(const node_type &n)
+    {
+      if (level_slots.empty()) {
+        level_slots.resize(64u, empty_slot);
+      }
+
+      const size_t mask = level_slots.size() - 1u;
+      size_t slot = internal::reduce_node_children_hash()(n) & mask;
+
+      while (level_slots[slot] != empty_slot) {
+        const node_type &m = level_nodes[level_slots[slot] - 1u];
+        if (m.low() == n.low() && m.high() == n.high()) { break; }
+        slot = (slot + 1u) & mask;
+      }
+      return slot;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Double the number of slots when the load factor exceeds 1/2.
+    /////////////////////////////////////////////////////////////////////////////
+    void grow_slots_if_needed()
+    {
+      if (2u * level_nodes.size() <= level_slots.size()) { return; }
+
+      level_slots.assign(2u * level_slots.size(), empty_slot);
+      for (size_t idx = 0u; idx < level_nodes.size(); ++idx) {
+        level_slots[find_slot(level_nodes[idx])] = idx + 1u;
+      }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    /// \brief Write the nodes of the current level in their canonical order (if
+    ///        canonicalising).
+    /////////////////////////////////////////////////////////////////////////////
+    void flush_level()
+    {
+      if (!canonicalising) { return; }
+
+      // Clear the hash table's slots by finding them again.
+      const size_t mask = level_slots.size() - 1u;
+      for (size_t idx = 0u; idx < level_nodes.size(); ++idx) {
+        size_t slot = internal::reduce_node_children_hash()(level_nodes[idx]) & mask;
+        while (level_slots[slot] != idx + 1u) { slot = (slot + 1u) & mask; }
+        level_slots[slot] = empty_slot;
+      }
+
+      // Sort the nodes (by their children) and give them their final uid.
+      std::vector<size_t> order(level_nodes.size());
+      for (size_t idx = 0u; idx < order.size(); ++idx) { order[idx] = idx; }
+
+      internal::reduce_node_children_lt lt;
+      std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+        return lt(level_nodes[a], level_nodes[b]);
+      });
+
+      typename dd_policy::id_type out_id = dd_policy::max_id;
+      for (const size_t idx : order) {
+        const node_type &n = level_nodes[idx];
+        const node_type out(n.label(), out_id--, n.low(), n.high());
+
+        nw.push(out);
+        uids[level_handle + idx] = out.uid();
+      }
+
+      level_handle += level_nodes.size();
+      level_nodes.clear();
     }
   };
 
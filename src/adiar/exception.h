@@ -51,6 +51,36 @@ namespace adiar
   /// \brief System runtime errors with an associated error code.
   ////////////////////////////////////////////////////////////////////////////
   using system_error = std::system_error;
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief An operation was cancelled via the `exec_policy::cancellation`
+  ///        token of its execution policy.
+  ////////////////////////////////////////////////////////////////////////////
+  class operation_cancelled : public runtime_error
+  {
+  public:
+    using runtime_error::runtime_error;
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief An operation did not finish before the `exec_policy::deadline` of
+  ///        its execution policy.
+  ////////////////////////////////////////////////////////////////////////////
+  class deadline_exceeded : public runtime_error
+  {
+  public:
+    using runtime_error::runtime_error;
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief An operation has output more arcs than the `exec_policy::arc_budget`
+  ///        of its execution policy allows.
+  ////////////////////////////////////////////////////////////////////////////
+  class arc_budget_exceeded : public runtime_error
+  {
+  public:
+    using runtime_error::runtime_error;
+  };
 }
 
 #endif // ADIAR_EXCEPTION_H
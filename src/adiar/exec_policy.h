@@ -1,6 +1,17 @@
 #ifndef ADIAR_EXEC_POLICY_H
 #define ADIAR_EXEC_POLICY_H
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include <adiar/exception.h>
+
 namespace adiar
 {
   //////////////////////////////////////////////////////////////////////////////
@@ -111,8 +122,395 @@ namespace adiar
       Singleton
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Whether Adiar should use its levelized (I/O-efficient)
+    ///          algorithms or a conventional depth-first algorithm.
+    ///
+    /// \details Adiar's levelized algorithms have a considerable constant
+    ///          overhead: each operation creates temporary files and auxiliary
+    ///          data structures and has to run a bottom-up Reduce sweep. For
+    ///          very small decision diagrams, this dominates the running time.
+    ///          Here, a depth-first and memoised algorithm with a local unique
+    ///          node table is much faster. This table is later written as a
+    ///          canonical diagram to disk.
+    ///
+    /// \remark  If any of the other settings are not `Auto`, then `Auto` will
+    ///          assume you want to run a specific variant of the levelized
+    ///          algorithms.
+    ///
+    /// \warning Using `Depth_First` may lead to crashes if an input or output
+    ///          is too large!
+    ///
+    /// \see bdd_apply bdd_ite bdd_exists bdd_forall
+    ////////////////////////////////////////////////////////////////////////////
+    enum class engine
+    {
+      /** Use \em depth-first algorithms when all inputs are small enough. */
+      Auto,
+      /** Always use \em depth-first algorithms (if available). */
+      Depth_First,
+      /** Always use \em levelized algorithms */
+      Levelized
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Order in which many decision diagrams are combined.
+    ///
+    /// \details When many diagrams are conjoined, e.g. the clauses of a CNF,
+    ///          then the order of the operations dictates the size of all
+    ///          intermediate results. A `Balanced` schedule combines the
+    ///          diagrams pairwise as in a balanced binary tree, i.e. with only
+    ///          a logarithmic number of intermediate results at any time. The
+    ///          `Min_Width` schedule always combines the two (current) diagrams
+    ///          with the smallest width, but keeps all of them at once.
+    ///
+    /// \see bdd_from_cnf
+    ////////////////////////////////////////////////////////////////////////////
+    enum class schedule
+    {
+      /** Combine the diagrams in a balanced binary tree. */
+      Balanced,
+      /** Combine the two diagrams with the smallest width. */
+      Min_Width
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Upper bound on the amount of memory (in bytes) an operation may
+    ///          use for its auxiliary data structures.
+    ///
+    /// \details By default, each operation sizes its data structures based on
+    ///          all memory (still) available to Adiar. With a budget, one can
+    ///          run multiple operations side by side or keep an operation
+    ///          within the bounds of its internal memory variant. The smaller
+    ///          of the budget and the available memory is used.
+    ///
+    /// \remark  The budget also covers the (few) input and output streams of
+    ///          an operation. Hence, it cannot be smaller than the memory Adiar
+    ///          requires to be initialized with.
+    ////////////////////////////////////////////////////////////////////////////
+    class memory_budget
+    {
+    private:
+      size_t _bytes;
+
+    public:
+      /** Value for an unlimited budget */
+      static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+      /** Smallest possible budget (same as the `minimum_memory` of Adiar) */
+      static constexpr size_t minimum = 128u * 1024u * 1024u;
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Budget of the given number of bytes.
+      ///
+      /// \throws invalid_argument If `bytes` is less than `minimum`.
+      ////////////////////////////////////////////////////////////////////////
+      explicit constexpr memory_budget(const size_t bytes = unlimited)
+        : _bytes(bytes)
+      {
+        if (bytes < minimum) {
+          throw invalid_argument("Memory budget must be at least 128 MiB");
+        }
+      }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Number of bytes of this budget.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr size_t bytes() const
+      { return _bytes; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for equality of budgets.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr bool operator ==(const memory_budget &o) const
+      { return this->_bytes == o._bytes; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for inequality of budgets.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr bool operator !=(const memory_budget &o) const
+      { return !(*this == o); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Callback to report on the progress of an operation.
+    ///
+    /// \details The callback is invoked each time a sweep of an operation moves
+    ///          on to the next level. Its arguments are (1) the level, (2) the
+    ///          number of elements in the levelized priority queue, and (3) the
+    ///          number of bytes written to the sweep's output.
+    ///
+    /// \remark  The callback is run on the thread of the operation itself.
+    ////////////////////////////////////////////////////////////////////////////
+    class progress
+    {
+    public:
+      /** Type of the callback function */
+      using function_type = std::function<void(size_t, size_t, size_t)>;
+
+    private:
+      function_type _f;
+
+    public:
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief No callback.
+      ////////////////////////////////////////////////////////////////////////
+      progress() = default;
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Report the progress to the given callback function.
+      ////////////////////////////////////////////////////////////////////////
+      explicit progress(const function_type &f)
+        : _f(f)
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Whether a callback is set.
+      ////////////////////////////////////////////////////////////////////////
+      explicit operator bool() const
+      { return static_cast<bool>(_f); }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Report the progress (if a callback is set).
+      ////////////////////////////////////////////////////////////////////////
+      void operator ()(size_t level, size_t pq_size, size_t bytes) const
+      { if (_f) { _f(level, pq_size, bytes); } }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Token to (cooperatively) cancel an operation.
+    ///
+    /// \details All copies of a token share the same state. Hence, one can keep
+    ///          a copy of the token and call `cancel()` on it from another
+    ///          thread. The operation is then aborted with an
+    ///          `operation_cancelled` exception the next time one of its sweeps
+    ///          moves on to the next level. All of its temporary files are
+    ///          removed as part of unwinding the stack.
+    ///
+    /// \remark  A token can be shared by multiple operations, e.g. all
+    ///          operations of a single job.
+    ////////////////////////////////////////////////////////////////////////////
+    class cancellation
+    {
+    private:
+      std::shared_ptr<std::atomic<bool>> _flag;
+
+      explicit cancellation(std::nullptr_t)
+        : _flag(nullptr)
+      { }
+
+    public:
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A new (not yet cancelled) token.
+      ////////////////////////////////////////////////////////////////////////
+      cancellation()
+        : _flag(std::make_shared<std::atomic<bool>>(false))
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A token that cannot be cancelled.
+      ////////////////////////////////////////////////////////////////////////
+      static cancellation none()
+      { return cancellation(nullptr); }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Request all operations with this token to be cancelled.
+      ////////////////////////////////////////////////////////////////////////
+      void cancel() const
+      { if (_flag) { _flag->store(true, std::memory_order_relaxed); } }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Whether `cancel()` has been called on this token.
+      ////////////////////////////////////////////////////////////////////////
+      bool is_cancelled() const
+      { return _flag && _flag->load(std::memory_order_relaxed); }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Whether `cancel()` can have an effect on this token, i.e. it
+      ///        is not `none()`.
+      ////////////////////////////////////////////////////////////////////////
+      bool is_cancellable() const
+      { return static_cast<bool>(_flag); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Point in (wall) time at which an operation should be aborted.
+    ///
+    /// \details The deadline is checked each time a sweep of an operation moves
+    ///          on to the next level. If it has passed, the operation is
+    ///          aborted with a `deadline_exceeded` exception.
+    ///
+    /// \remark  Since the deadline is a point in time, the same policy (and
+    ///          hence deadline) can be used for an entire sequence of
+    ///          operations.
+    ////////////////////////////////////////////////////////////////////////////
+    class deadline
+    {
+    public:
+      /** Clock used for the deadline */
+      using clock_type = std::chrono::steady_clock;
+
+      /** Type of the point in time */
+      using time_point = clock_type::time_point;
+
+    private:
+      time_point _time;
+
+    public:
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief No deadline.
+      ////////////////////////////////////////////////////////////////////////
+      deadline()
+        : _time(time_point::max())
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Deadline at the given point in time.
+      ////////////////////////////////////////////////////////////////////////
+      explicit deadline(const time_point &t)
+        : _time(t)
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Deadline after the given duration from now.
+      ////////////////////////////////////////////////////////////////////////
+      template<typename Rep, typename Period>
+      explicit deadline(const std::chrono::duration<Rep, Period> &d)
+        : _time(clock_type::now() + std::chrono::duration_cast<clock_type::duration>(d))
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The point in time of the deadline.
+      ////////////////////////////////////////////////////////////////////////
+      const time_point& time() const
+      { return _time; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Whether this is an actual deadline.
+      ////////////////////////////////////////////////////////////////////////
+      bool is_set() const
+      { return _time != time_point::max(); }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Whether the deadline has passed.
+      ////////////////////////////////////////////////////////////////////////
+      bool has_passed() const
+      { return is_set() && _time <= clock_type::now(); }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for equality of deadlines.
+      ////////////////////////////////////////////////////////////////////////
+      bool operator ==(const deadline &o) const
+      { return this->_time == o._time; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for inequality of deadlines.
+      ////////////////////////////////////////////////////////////////////////
+      bool operator !=(const deadline &o) const
+      { return !(*this == o); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Upper bound on the number of (unreduced) arcs a single sweep of
+    ///          an operation may output.
+    ///
+    /// \details The number of arcs written by a top-down sweep, e.g. the
+    ///          product construction of `bdd_apply`, is checked each time it
+    ///          moves on to the next level. If it exceeds the budget, the
+    ///          operation is aborted with an `arc_budget_exceeded` exception.
+    ///          Hence, an operation that blows up can be stopped early, i.e.
+    ///          before it has consumed all of the disk.
+    ////////////////////////////////////////////////////////////////////////////
+    class arc_budget
+    {
+    private:
+      size_t _arcs;
+
+    public:
+      /** Value for an unlimited budget */
+      static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Budget of the given number of arcs.
+      ////////////////////////////////////////////////////////////////////////
+      explicit constexpr arc_budget(const size_t arcs = unlimited)
+        : _arcs(arcs)
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Number of arcs of this budget.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr size_t arcs() const
+      { return _arcs; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for equality of budgets.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr bool operator ==(const arc_budget &o) const
+      { return this->_arcs == o._arcs; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for inequality of budgets.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr bool operator !=(const arc_budget &o) const
+      { return !(*this == o); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Number of threads an operation may use.
+    ///
+    /// \details Currently, only the counting operations, e.g. `bdd_satcount`,
+    ///          `bdd_pathcount`, and `zdd_size`, make use of multiple threads.
+    ///          Each thread has its own priority queue and, hence, its own
+    ///          share of the memory. All other operations (and all operations
+    ///          if Adiar is compiled with statistics) are single-threaded.
+    ////////////////////////////////////////////////////////////////////////////
+    class threads
+    {
+    private:
+      size_t _count;
+
+    public:
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Use the given number of threads (default is 1).
+      ////////////////////////////////////////////////////////////////////////
+      explicit constexpr threads(const size_t count = 1u)
+        : _count(std::max<size_t>(count, 1u))
+      { }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Number of threads.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr size_t count() const
+      { return _count; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for equality of the number of threads.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr bool operator ==(const threads &o) const
+      { return this->_count == o._count; }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Check for inequality of the number of threads.
+      ////////////////////////////////////////////////////////////////////////
+      constexpr bool operator !=(const threads &o) const
+      { return !(*this == o); }
+    };
+
     // TODO: Move Nested Sweeping constants/strategies in here too...
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether `T` is one of the above options of an `exec_policy`.
+    ////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static constexpr bool is_option =
+      std::is_same_v<T, access>    || std::is_same_v<T, memory>
+      || std::is_same_v<T, quantify> || std::is_same_v<T, engine>
+      || std::is_same_v<T, schedule> || std::is_same_v<T, memory_budget>
+      || std::is_same_v<T, deadline> || std::is_same_v<T, arc_budget>
+      || std::is_same_v<T, threads>  || std::is_same_v<T, progress>
+      || std::is_same_v<T, cancellation>;
+
   private:
     // TODO: Merge all enums into a single 64 bit integer to safe on space?
 
@@ -131,6 +529,46 @@ namespace adiar
     ////////////////////////////////////////////////////////////////////////////
     quantify _quantify_alg = quantify::Auto;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `engine` (default `Auto`).
+    ////////////////////////////////////////////////////////////////////////////
+    engine _engine_mode = engine::Auto;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `schedule` (default `Balanced`).
+    ////////////////////////////////////////////////////////////////////////////
+    schedule _schedule_mode = schedule::Balanced;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `memory_budget` (default unlimited).
+    ////////////////////////////////////////////////////////////////////////////
+    memory_budget _memory_budget = memory_budget();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `deadline` (default none).
+    ////////////////////////////////////////////////////////////////////////////
+    deadline _deadline = deadline();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `arc_budget` (default unlimited).
+    ////////////////////////////////////////////////////////////////////////////
+    arc_budget _arc_budget = arc_budget();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen number of `threads` (default 1).
+    ////////////////////////////////////////////////////////////////////////////
+    threads _threads = threads();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `progress` callback (default none).
+    ////////////////////////////////////////////////////////////////////////////
+    progress _progress = progress();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen `cancellation` token (default none).
+    ////////////////////////////////////////////////////////////////////////////
+    cancellation _cancellation = cancellation::none();
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Default constructor with all options set to their default value.
@@ -168,6 +606,62 @@ namespace adiar
       : _quantify_alg(qm)
     { }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from `engine` enum.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const engine &em)
+      : _engine_mode(em)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from `schedule` enum.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const schedule &sc)
+      : _schedule_mode(sc)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from a `memory_budget`.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const memory_budget &mb)
+      : _memory_budget(mb)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from a `deadline`.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const deadline &d)
+      : _deadline(d)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from an `arc_budget`.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const arc_budget &ab)
+      : _arc_budget(ab)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from a number of `threads`.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const threads &t)
+      : _threads(t)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from a `progress` callback.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const progress &p)
+      : _progress(p)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from a `cancellation` token.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy(const cancellation &c)
+      : _cancellation(c)
+    { }
+
     // TODO: constructor with defaults for a specific 'version number'?
 
   public:
@@ -200,16 +694,73 @@ namespace adiar
     const quantify& quantify_alg() const
     { return _quantify_alg; }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen engine.
+    ////////////////////////////////////////////////////////////////////////////
+    const engine& engine_mode() const
+    { return _engine_mode; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen schedule.
+    ////////////////////////////////////////////////////////////////////////////
+    const schedule& schedule_mode() const
+    { return _schedule_mode; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen memory budget.
+    ////////////////////////////////////////////////////////////////////////////
+    const memory_budget& memory_limit() const
+    { return _memory_budget; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen deadline.
+    ////////////////////////////////////////////////////////////////////////////
+    const deadline& time_limit() const
+    { return _deadline; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen arc budget.
+    ////////////////////////////////////////////////////////////////////////////
+    const arc_budget& arc_limit() const
+    { return _arc_budget; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen number of threads.
+    ////////////////////////////////////////////////////////////////////////////
+    const threads& thread_count() const
+    { return _threads; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen progress callback.
+    ////////////////////////////////////////////////////////////////////////////
+    const progress& progress_callback() const
+    { return _progress; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Chosen cancellation token.
+    ////////////////////////////////////////////////////////////////////////////
+    const cancellation& cancellation_token() const
+    { return _cancellation; }
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Check for equality of settings.
+    ///
+    /// \remark The `progress` callback and the `cancellation` token are not
+    ///         settings and hence not compared.
     ////////////////////////////////////////////////////////////////////////////
     bool operator ==(const exec_policy& ep) const
     {
       // Order based from the most generic to the most specific setting.
-      return this->memory_mode()  == ep.memory_mode()
-          && this->access_mode()  == ep.access_mode()
-          && this->quantify_alg() == ep.quantify_alg()
+      return this->memory_mode()   == ep.memory_mode()
+          && this->access_mode()   == ep.access_mode()
+          && this->quantify_alg()  == ep.quantify_alg()
+          && this->engine_mode()   == ep.engine_mode()
+          && this->schedule_mode() == ep.schedule_mode()
+          && this->memory_limit()  == ep.memory_limit()
+          && this->time_limit()    == ep.time_limit()
+          && this->arc_limit()     == ep.arc_limit()
+          && this->thread_count()  == ep.thread_count()
         ;
     }
 
@@ -275,52 +826,163 @@ namespace adiar
       exec_policy ep = *this;
       return ep.set(qs);
     }
-  };
 
-  /// \}
-  //////////////////////////////////////////////////////////////////////////////
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the engine.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const engine &em)
+    {
+      this->_engine_mode = em;
+      return *this;
+    }
 
-  //////////////////////////////////////////////////////////////////////////////
-  /// \brief Operator overload to support lifting enum values to `exec_policy`.
-  //////////////////////////////////////////////////////////////////////////////
-  inline exec_policy operator &(const exec_policy::access &am,
-                                const exec_policy::memory &mm)
-  { return exec_policy(am) & mm; }
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the engine changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const engine& em)
+    {
+      exec_policy ep = *this;
+      return ep.set(em);
+    }
 
-  //////////////////////////////////////////////////////////////////////////////
-  /// \brief Operator overload to support lifting enum values to `exec_policy`.
-  //////////////////////////////////////////////////////////////////////////////
-  inline exec_policy operator &(const exec_policy::memory &mm,
-                                const exec_policy::access &am)
-  { return exec_policy(mm) & am; }
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the schedule.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const schedule &sc)
+    {
+      this->_schedule_mode = sc;
+      return *this;
+    }
 
-  //////////////////////////////////////////////////////////////////////////////
-  /// \brief Operator overload to support lifting enum values to `exec_policy`.
-  //////////////////////////////////////////////////////////////////////////////
-  inline exec_policy operator &(const exec_policy::access &am,
-                                const exec_policy::quantify &qs)
-  { return exec_policy(am) & qs; }
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the schedule changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const schedule& sc)
+    {
+      exec_policy ep = *this;
+      return ep.set(sc);
+    }
 
-  //////////////////////////////////////////////////////////////////////////////
-  /// \brief Operator overload to support lifting enum values to `exec_policy`.
-  //////////////////////////////////////////////////////////////////////////////
-  inline exec_policy operator &(const exec_policy::quantify &qs,
-                                const exec_policy::access &am)
-  { return exec_policy(qs) & am; }
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the memory budget.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const memory_budget &mb)
+    {
+      this->_memory_budget = mb;
+      return *this;
+    }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the memory budget changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const memory_budget& mb)
+    {
+      exec_policy ep = *this;
+      return ep.set(mb);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the deadline.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const deadline &d)
+    {
+      this->_deadline = d;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the deadline changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const deadline& d)
+    {
+      exec_policy ep = *this;
+      return ep.set(d);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the arc budget.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const arc_budget &ab)
+    {
+      this->_arc_budget = ab;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the arc budget changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const arc_budget& ab)
+    {
+      exec_policy ep = *this;
+      return ep.set(ab);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const threads &t)
+    {
+      this->_threads = t;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the number of threads changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const threads& t)
+    {
+      exec_policy ep = *this;
+      return ep.set(t);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the progress callback.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const progress &p)
+    {
+      this->_progress = p;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the progress callback changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const progress& p)
+    {
+      exec_policy ep = *this;
+      return ep.set(p);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the cancellation token.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy& set(const cancellation &c)
+    {
+      this->_cancellation = c;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the cancellation token changed.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy operator &(const cancellation& c)
+    {
+      exec_policy ep = *this;
+      return ep.set(c);
+    }
+  };
+
+  /// \}
   //////////////////////////////////////////////////////////////////////////////
-  /// \brief Operator overload to support lifting enum values to `exec_policy`.
-  //////////////////////////////////////////////////////////////////////////////
-  inline exec_policy operator &(const exec_policy::memory &mm,
-                                const exec_policy::quantify &qs)
-  { return exec_policy(mm) & qs; }
 
   //////////////////////////////////////////////////////////////////////////////
-  /// \brief Operator overload to support lifting enum values to `exec_policy`.
+  /// \brief Operator overload to support lifting any two options to an
+  ///        `exec_policy`.
   //////////////////////////////////////////////////////////////////////////////
-  inline exec_policy operator &(const exec_policy::quantify &qs,
-                                const exec_policy::memory &mm)
-  { return exec_policy(qs) & mm; }
+  template <typename A, typename B,
+            typename = std::enable_if_t<exec_policy::is_option<A> && exec_policy::is_option<B>>>
+  inline exec_policy operator &(const A &a, const B &b)
+  { return exec_policy(a) & b; }
 }
 
 #endif // ADIAR_EXEC_POLICY_H
@@ -1,13 +1,21 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_BUILD_H
 #define ADIAR_INTERNAL_ALGORITHMS_BUILD_H
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include <adiar/exception.h>
+#include <adiar/functional.h>
 #include <adiar/types.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/data_types/uid.h>
 #include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/file.h>
 #include <adiar/internal/io/file_stream.h>
+#include <adiar/internal/io/file_writer.h>
 #include <adiar/internal/io/node_writer.h>
 #include <adiar/internal/io/shared_file_ptr.h>
 
@@ -309,6 +317,292 @@ namespace adiar::internal
       return make_optional<value_type>();
     }
   };
+
+  //////////////////////////////////////////////////////////////////////////////
+  //  Linear Constraints
+  // ====================
+  //
+  // Builds the decision diagram for `lower <= sum a_i x_i <= upper` (with
+  // non-negative coefficients a_i) bottom-up and directly in its canonical
+  // form. Each node is identified by the remaining budget r, i.e. `upper`
+  // minus the sum of the coefficients of the variables set to true above it.
+  // The budgets that are reachable from the root are first derived top-down.
+  // Then, on each level (bottom-up) the nodes for all reachable budgets are
+  // created, duplicates are merged, and they are output in canonical order.
+  //
+  // With the sum S of the coefficients of a level and all levels below it, the
+  // budget r is satisfied by the remaining variables if their sum is within
+  // [r - (upper - lower), r] ∩ [0, S]. Hence, all budgets larger than
+  // S + (upper - lower) are equivalent (unsatisfiable) and so are all budgets
+  // within [S, upper - lower] (always satisfied). Each budget is replaced by a
+  // single representative of these intervals, such that a level has at most
+  // min(2^i, S + (upper - lower) + 2) many budgets. These are kept in internal
+  // memory.
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A variable and its coefficient in a linear constraint.
+  //////////////////////////////////////////////////////////////////////////////
+  struct linear_term
+  {
+    ptr_uint64::label_type label;
+    uint64_t coeff;
+
+    /// Sum of the coefficients of this and all terms below (saturated)
+    uint64_t suffix;
+
+    linear_term operator! () const
+    { return *this; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sum of `a` and `b` (saturated at the maximum value).
+  //////////////////////////////////////////////////////////////////////////////
+  inline uint64_t
+  linear_sat_add(const uint64_t a, const uint64_t b)
+  {
+    return std::numeric_limits<uint64_t>::max() - a < b
+      ? std::numeric_limits<uint64_t>::max()
+      : a + b;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Representative of the budget `r` on a level with the (suffix) sum
+  ///        `suffix` of coefficients and the given `slack = upper - lower`.
+  ///
+  /// \details This is monotone in `r`, i.e. it preserves the order of budgets.
+  //////////////////////////////////////////////////////////////////////////////
+  inline uint64_t
+  linear_budget(const uint64_t r, const uint64_t suffix, const uint64_t slack)
+  {
+    const uint64_t unsat = linear_sat_add(suffix, slack);
+    if (unsat < r) { return linear_sat_add(unsat, 1u); }
+    if (suffix <= r && r <= slack) { return suffix; }
+    return r;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Builds the decision diagram for `lower <= sum a_i x_i <= upper`.
+  ///
+  /// \param terms Generator of (label, coefficient) pairs in \em descending
+  ///              order of their label.
+  ///
+  /// \throws invalid_argument If the labels are not given in strictly
+  ///                          descending order or are too large.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  typename DdPolicy::dd_type
+  build_linear(const generator<pair<typename DdPolicy::label_type, uint64_t>> &terms,
+               const uint64_t lower,
+               const uint64_t upper)
+  {
+    using node_type    = typename DdPolicy::node_type;
+    using pointer_type = typename DdPolicy::pointer_type;
+    using label_type   = typename DdPolicy::label_type;
+
+    // Obtain all terms (bottom-up)
+    shared_file<linear_term> terms_file;
+    {
+      file_writer<linear_term> tw(terms_file);
+
+      optional<label_type> prev_label;
+      uint64_t suffix = 0u;
+      for (auto t = terms(); t; t = terms()) {
+        const label_type label = t.value().first;
+
+        if (DdPolicy::max_label < label) {
+          throw invalid_argument("Cannot represent that large a label");
+        }
+        if (prev_label && prev_label.value() <= label) {
+          throw invalid_argument("Labels not given in strictly decreasing order");
+        }
+        suffix = linear_sat_add(suffix, t.value().second);
+        tw << linear_term{ label, t.value().second, suffix };
+        prev_label = label;
+      }
+    }
+
+    // Without any variables, the sum is 0. Notice, if 'upper < lower' then
+    // 'lower' cannot be 0.
+    if (terms_file->size() == 0u || upper < lower) {
+      return build_terminal<DdPolicy>(lower == 0u);
+    }
+
+    const uint64_t slack = upper - lower;
+
+    // Derive the reachable budgets of each level (top-down)
+    shared_file<uint64_t> budgets_file;
+    shared_file<size_t> widths_file;
+    uint64_t root_budget;
+    {
+      file_writer<uint64_t> bw(budgets_file);
+      file_writer<size_t> ww(widths_file);
+
+      file_stream<linear_term, true> ts(terms_file);
+
+      root_budget = linear_budget(upper, ts.peek().suffix, slack);
+
+      std::vector<uint64_t> budgets = { root_budget };
+      std::vector<uint64_t> next_budgets;
+
+      while (true) {
+        for (const uint64_t r : budgets) { bw << r; }
+        ww << budgets.size();
+
+        const linear_term t = ts.pull();
+        if (!ts.can_pull()) { break; }
+
+        const uint64_t next_suffix = ts.peek().suffix;
+
+        // Merge the budgets for 'false' with the (sorted) ones for 'true'. Both
+        // stay sorted when replaced by their representative on the next level.
+        next_budgets.clear();
+        auto true_begin = std::lower_bound(budgets.begin(), budgets.end(), t.coeff);
+
+        auto lo_it = budgets.begin();
+        auto hi_it = true_begin;
+        while (lo_it != budgets.end() || hi_it != budgets.end()) {
+          const bool take_hi = hi_it != budgets.end()
+            && (lo_it == budgets.end() || *hi_it - t.coeff < *lo_it);
+          const uint64_t r = linear_budget(take_hi ? *(hi_it++) - t.coeff : *(lo_it++),
+                                           next_suffix, slack);
+
+          if (next_budgets.empty() || next_budgets.back() != r) {
+            next_budgets.push_back(r);
+          }
+        }
+        budgets.swap(next_budgets);
+      }
+    }
+
+    // Build all nodes (bottom-up)
+    shared_levelized_file<node_type> nf;
+    {
+      node_writer nw(nf);
+
+      file_stream<linear_term> ts(terms_file);
+      file_stream<uint64_t, true> bs(budgets_file);
+      file_stream<size_t, true> ws(widths_file);
+
+      // Budget and the resulting function of the level below.
+      std::vector<pair<uint64_t, pointer_type>> below;
+      bool below_is_bottom = true;
+      uint64_t below_suffix = 0u;
+
+      const auto lookup = [&](const uint64_t r_raw) -> pointer_type {
+        if (below_is_bottom) { return pointer_type(r_raw <= slack); }
+
+        const uint64_t r = linear_budget(r_raw, below_suffix, slack);
+        const auto it = std::lower_bound(below.begin(), below.end(), r,
+                                         [](const pair<uint64_t, pointer_type> &p,
+                                            const uint64_t &x) {
+                                           return p.first < x;
+                                         });
+        adiar_assert(it != below.end() && it->first == r,
+                     "Budget must be reachable on the level below");
+        return it->second;
+      };
+
+      std::vector<pair<uint64_t, pointer_type>> current;
+      std::vector<node_type> candidates;
+      std::vector<size_t> candidates_idx;
+      std::vector<size_t> order;
+
+      while (ts.can_pull()) {
+        const linear_term t = ts.pull();
+
+        // Obtain this level's budgets in ascending order
+        const size_t width = ws.pull();
+        current.resize(width);
+        for (size_t i = width; 0u < i; --i) {
+          current[i-1u] = make_pair(bs.pull(), pointer_type(false));
+        }
+
+        // Create all nodes (with temporary identifiers)
+        candidates.clear();
+        candidates_idx.clear();
+
+        for (size_t i = 0u; i < width; ++i) {
+          const uint64_t r = current[i].first;
+
+          const pointer_type low  = lookup(r);
+          const pointer_type high = t.coeff <= r ? lookup(r - t.coeff) : pointer_type(false);
+
+          const node_type n(t.label, DdPolicy::max_id, low, high);
+          const typename node_type::uid_type res = DdPolicy::reduction_rule(n);
+
+          if (res != n.uid()) {
+            current[i].second = res;
+          } else {
+            candidates.push_back(n);
+            candidates_idx.push_back(i);
+          }
+        }
+
+        // Output the unique nodes in canonical order
+        order.resize(candidates.size());
+        for (size_t i = 0u; i < order.size(); ++i) { order[i] = i; }
+
+        std::sort(order.begin(), order.end(), [&](const size_t a, const size_t b) {
+          const node_type &na = candidates[a];
+          const node_type &nb = candidates[b];
+          return na.high() > nb.high() || (na.high() == nb.high() && na.low() > nb.low());
+        });
+
+        typename DdPolicy::id_type out_id = DdPolicy::max_id;
+        for (size_t i = 0u; i < order.size(); ++i) {
+          const node_type &n = candidates[order[i]];
+
+          const bool is_duplicate = 0u < i
+            && candidates[order[i-1u]].low()  == n.low()
+            && candidates[order[i-1u]].high() == n.high();
+
+          if (!is_duplicate) {
+            nw.push(node_type(t.label, out_id--, n.low(), n.high()));
+          }
+          current[candidates_idx[order[i]]].second =
+            pointer_type(t.label, out_id + 1u);
+        }
+
+        below.swap(current);
+        below_is_bottom = false;
+        below_suffix = t.suffix;
+      }
+
+      // The root is the function for the budget 'upper' (i.e. nothing spent)
+      adiar_assert(below.size() == 1u && below[0].first == root_budget,
+                   "Only the initial budget is reachable at the top");
+
+      if (below[0].second.is_terminal()) {
+        adiar_assert(!nw.has_pushed(), "No node is reachable from a terminal root");
+        return build_terminal<DdPolicy>(below[0].second.value());
+      }
+    }
+    return nf;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Builds the decision diagram for `lower <= sum x_i <= upper`.
+  ///
+  /// \param vars Generator of labels in \em descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  typename DdPolicy::dd_type
+  build_linear(const generator<typename DdPolicy::label_type> &vars,
+               const uint64_t lower,
+               const uint64_t upper)
+  {
+    using label_type = typename DdPolicy::label_type;
+
+    const generator<pair<label_type, uint64_t>> terms =
+      [&vars]() -> optional<pair<label_type, uint64_t>> {
+        const optional<label_type> x = vars();
+        if (!x) { return make_optional<pair<label_type, uint64_t>>(); }
+        return make_pair(x.value(), static_cast<uint64_t>(1u));
+      };
+
+    return build_linear<DdPolicy>(terms, lower, upper);
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_BUILD_H
@@ -1,8 +1,16 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_COUNT_H
 #define ADIAR_INTERNAL_ALGORITHMS_COUNT_H
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <stdint.h>
+#include <thread>
+#include <vector>
 
+#include <adiar/exception.h>
 #include <adiar/exec_policy.h>
 
 #include <adiar/internal/assert.h>
@@ -10,6 +18,7 @@
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
 #include <adiar/internal/data_types/uid.h>
 #include <adiar/internal/data_types/request.h>
+#include <adiar/internal/io/levelized_file_stream.h>
 #include <adiar/internal/io/node_stream.h>
 
 namespace adiar::internal
@@ -22,6 +31,13 @@ namespace adiar::internal
   // its paths.
   //
   // Examples of uses are `bdd_pathcount` and `bdd_satcount`.
+  //
+  // All requests for nodes on the same level are independent of each other.
+  // Hence, if multiple threads are available, then the nodes are partitioned
+  // between multiple workers, each with its own priority queue for the requests
+  // to its nodes. The workers process each level in chunks of nodes and only
+  // synchronise at the end of a chunk to hand over the requests they have
+  // forwarded to the nodes of the others.
   //////////////////////////////////////////////////////////////////////////////
 
   //////////////////////////////////////////////////////////////////////////////
@@ -65,8 +81,16 @@ namespace adiar::internal
   public:
     using data_type = path_data;
 
+    using result_type = uint64_t;
+
     static constexpr data_type init_data = { 1u };
 
+    static constexpr size_t
+    memory_usage()
+    {
+      return 0u;
+    }
+
     static constexpr uint64_t
     resolve_false(const data_type &/*d*/,
                   const typename DdPolicy::label_type/*varcount*/)
@@ -95,37 +119,400 @@ namespace adiar::internal
     {
       return acc;
     }
+
+    static inline data_type
+    forward(const data_type &d,
+            const node &/*n*/,
+            const bool /*high*/)
+    {
+      return d;
+    }
   };
 
   //////////////////////////////////////////////////////////////////////////////
-  template<typename Policy, typename PriorityQueue>
-  inline uint64_t
-  __count_resolve(PriorityQueue &count_pq,
-                  const typename Policy::pointer_type &target,
+  /// \brief Buffer of requests with the same interface as a priority queue.
+  ///
+  /// \details The requests are written to consecutive slots starting at the
+  ///          given address, i.e. the caller has to provide room for them.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Data>
+  class count_outbox
+  {
+  private:
+    count_request<Data> *_begin;
+    count_request<Data> *_end;
+
+  public:
+    count_outbox(count_request<Data> *begin)
+      : _begin(begin), _end(begin)
+    { }
+
+    void push(const count_request<Data> &r)
+    { *(_end++) = r; }
+
+    const count_request<Data>* begin() const
+    { return _begin; }
+
+    const count_request<Data>* end() const
+    { return _end; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Threads that together with the calling thread run a task for each
+  ///        chunk of a parallel count.
+  ///
+  /// \details The threads are created once and live until the pool is
+  ///          destructed, i.e. for the entire sweep.
+  //////////////////////////////////////////////////////////////////////////////
+  class count_worker_pool
+  {
+  private:
+    std::vector<std::thread> _threads;
+
+    std::mutex _mutex;
+    std::condition_variable _run_cv;
+    std::condition_variable _done_cv;
+
+    std::function<void(size_t)> _task;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of tasks run so far.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t _generation = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of workers (including the calling thread) of the current
+    ///        task and how many of them still are running.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t _active = 0u;
+    size_t _running = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief First exception thrown by a thread during the current task.
+    ////////////////////////////////////////////////////////////////////////////
+    std::exception_ptr _exception;
+
+    bool _stop = false;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Start a pool for `workers` workers, i.e. with `workers - 1`
+    ///        threads in addition to the calling one.
+    ////////////////////////////////////////////////////////////////////////////
+    count_worker_pool(const size_t workers)
+    {
+      _threads.reserve(workers - 1u);
+      for (size_t w = 1u; w < workers; ++w) {
+        _threads.emplace_back([this, w]() { this->__loop(w); });
+      }
+    }
+
+    count_worker_pool(const count_worker_pool &) = delete;
+
+    ~count_worker_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+      }
+      _run_cv.notify_all();
+      for (std::thread &t : _threads) { t.join(); }
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Run `task(w)` for each worker `w` in `[0, active)`, where the
+    ///        calling thread is worker 0, and wait for all of them to finish.
+    ///
+    /// \details If any of the workers throws an exception, then (the first of)
+    ///          it is rethrown on the calling thread after all have finished.
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Task>
+    void run(const size_t active, const Task &task)
+    {
+      adiar_assert(0u < active && active <= _threads.size() + 1u,
+                   "Number of active workers must fit the pool");
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _task = task;
+        _active = active;
+        _running = active - 1u;
+        _exception = nullptr;
+        _generation++;
+      }
+      _run_cv.notify_all();
+
+      std::exception_ptr exception;
+      try {
+        task(0u);
+      } catch (...) {
+        exception = std::current_exception();
+      }
+
+      std::unique_lock<std::mutex> lock(_mutex);
+      _done_cv.wait(lock, [this]() { return _running == 0u; });
+
+      if (!exception) { exception = _exception; }
+      _exception = nullptr;
+
+      if (exception) { std::rethrow_exception(exception); }
+    }
+
+  private:
+    void __loop(const size_t w)
+    {
+      size_t seen = 0u;
+
+      std::unique_lock<std::mutex> lock(_mutex);
+      while (true) {
+        _run_cv.wait(lock, [this, &seen]() { return _stop || _generation != seen; });
+        if (_stop) { return; }
+
+        seen = _generation;
+        if (_active <= w) { continue; }
+
+        lock.unlock();
+        std::exception_ptr exception;
+        try {
+          _task(w);
+        } catch (...) {
+          exception = std::current_exception();
+        }
+        lock.lock();
+
+        if (exception && !_exception) { _exception = exception; }
+        if (--_running == 0u) { _done_cv.notify_one(); }
+      }
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Policy, typename Queue>
+  inline typename Policy::result_type
+  __count_resolve(const Policy &policy,
+                  Queue &queue,
+                  const node &n,
+                  const bool high,
                   const typename Policy::data_type &data,
                   const typename Policy::label_type varcount)
   {
+    const typename Policy::pointer_type target = high ? n.high() : n.low();
+    const typename Policy::data_type target_data = policy.forward(data, n, high);
+
     if (target.is_false()) {
-      return Policy::resolve_false(data, varcount);
+      return policy.resolve_false(target_data, varcount);
     }
     if (target.is_true()) {
-      return Policy::resolve_true(data, varcount);
+      return policy.resolve_true(target_data, varcount);
     }
-    count_pq.push({ {target}, {}, data });
-    return 0u;
+    queue.push({ {target}, {}, target_data });
+    return typename Policy::result_type();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maximum number of nodes a worker of a parallel count processes
+  ///        before it hands over the requests it has forwarded.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t count_parallel_chunk = 1u << 16;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Minimum width of a level for its nodes to be processed by multiple
+  ///        threads. Narrower levels are processed by the calling thread alone.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t count_parallel_grain = 1u << 10;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Memory used by each worker of a parallel count in addition to its
+  ///        priority queue.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Policy>
+  size_t count_parallel_memory(const size_t workers)
+  {
+    // A node stream, the requests forwarded for a chunk of nodes (at most two
+    // per node), these requests sorted by the worker they are for, and the
+    // bounds of the latter.
+    return node_stream<>::memory_usage()
+      + 2u * 2u * count_parallel_chunk * sizeof(count_request<typename Policy::data_type>)
+      + (workers + 1u) * sizeof(size_t);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The worker of a parallel count that owns the node `p` points to.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Pointer>
+  inline size_t
+  __count_owner(const Pointer &p, const size_t workers)
+  {
+    return p.id() % workers;
   }
 
   template<typename Policy, typename PriorityQueue>
-  uint64_t __count(const typename Policy::dd_type &dd,
+  typename Policy::result_type
+  __count_parallel(const Policy &policy,
+                   const typename Policy::dd_type &dd,
                    const typename Policy::label_type varcount,
+                   const size_t workers,
                    const size_t pq_max_memory,
                    const size_t pq_max_size)
+  {
+    using data_type    = typename Policy::data_type;
+    using result_type  = typename Policy::result_type;
+    using request_type = count_request<data_type>;
+
+    // Set up the levels to synchronise on
+    level_info_stream<> ls(dd);
+
+    // Set up a node stream and a priority queue for each worker. The worker
+    // 'w' owns the nodes with 'id % workers == w', i.e. its priority queue only
+    // contains the requests for these nodes.
+    const internal::dd dds[1] = { dd };
+
+    std::vector<unique_ptr<node_stream<>>> streams;
+    streams.reserve(workers);
+
+    std::vector<unique_ptr<PriorityQueue>> pqs;
+    pqs.reserve(workers);
+
+    for (size_t w = 0u; w < workers; ++w) {
+      streams.push_back(adiar::make_unique<node_stream<>>(dd));
+      pqs.push_back(adiar::make_unique<PriorityQueue>(dds, pq_max_memory, pq_max_size, stats_count.lpq));
+    }
+
+    // Request for the root
+    {
+      const node root = streams[0u]->peek();
+
+      pqs[__count_owner(root.uid(), workers)]->push({ {root.uid()}, {}, policy.init_data });
+    }
+
+    // Requests forwarded by each worker (and the same sorted by the worker they
+    // are for). The requests of 'w' for 'v' are [bounds[w][v-1], bounds[w][v]).
+    std::vector<std::vector<request_type>> forwarded(workers, std::vector<request_type>(2u * count_parallel_chunk));
+    std::vector<std::vector<request_type>> sorted(workers, std::vector<request_type>(2u * count_parallel_chunk));
+    std::vector<std::vector<size_t>> bounds(workers, std::vector<size_t>(workers + 1u));
+
+    std::vector<result_type> results(workers, result_type());
+
+    // Whether each worker is done with the current level (not 'bool' since the
+    // workers write to it concurrently).
+    std::vector<char> level_done(workers, false);
+
+    ptr_uint64::label_type level = ptr_uint64::max_label;
+
+    // Merge and forward the requests for (at most) a chunk of nodes of worker
+    // 'w' on the current level.
+    const auto forward = [&](const size_t w) {
+      PriorityQueue &pq = *pqs[w];
+      node_stream<> &ns = *streams[w];
+
+      count_outbox<data_type> outbox(forwarded[w].data());
+
+      for (size_t i = 0u; i < count_parallel_chunk && !pq.empty_level(); ++i) {
+        // Skip the nodes of the other workers
+        while (__count_owner(ns.peek().uid(), workers) != w) { ns.pull(); }
+
+        // Assuming there are no dead nodes, we should visit every node of dd
+        const node n = ns.pull();
+
+        adiar_assert(pq.top().target == n.uid(),
+                     "Decision Diagram includes dead nodes");
+
+        data_type data = pq.pull().data;
+
+        while (pq.can_pull() && pq.top().target == n.uid()) {
+          data = policy.merge(std::move(data), pq.pull().data);
+        }
+
+        data = policy.merge_end(std::move(data));
+
+        results[w] += __count_resolve(policy, outbox, n, false, data, varcount);
+        results[w] += __count_resolve(policy, outbox, n, true,  data, varcount);
+      }
+
+      level_done[w] = pq.empty_level();
+
+      // Sort the forwarded requests by the worker they are for. Afterwards,
+      // 'bounds[w][v]' is the end of the requests for 'v'.
+      std::vector<size_t> &b = bounds[w];
+      std::fill(b.begin(), b.end(), 0u);
+
+      for (const request_type &r : outbox) { b[__count_owner(r.target.first(), workers) + 1u]++; }
+      for (size_t v = 1u; v < workers; ++v) { b[v] += b[v-1u]; }
+      for (const request_type &r : outbox) { sorted[w][b[__count_owner(r.target.first(), workers)]++] = r; }
+    };
+
+    // Push the requests forwarded to the nodes of worker 'v'.
+    const auto receive = [&](const size_t v) {
+      PriorityQueue &pq = *pqs[v];
+
+      for (size_t w = 0u; w < workers; ++w) {
+        const size_t begin = v == 0u ? 0u : bounds[w][v-1u];
+        const size_t end   = bounds[w][v];
+
+        for (size_t i = begin; i < end; ++i) { pq.push(sorted[w][i]); }
+      }
+    };
+
+    const auto setup_and_forward = [&](const size_t w) {
+      pqs[w]->setup_next_level(level);
+      forward(w);
+    };
+
+    count_worker_pool pool(workers);
+
+    const auto run = [&](const bool parallel, const auto &task) {
+      if (parallel) {
+        pool.run(workers, task);
+      } else {
+        for (size_t w = 0u; w < workers; ++w) { task(w); }
+      }
+    };
+
+    // Go through the levels of all workers in lockstep
+    while (ls.can_pull()) {
+      const level_info li = ls.pull();
+      level = li.level();
+
+      const bool parallel = count_parallel_grain <= li.width();
+
+      run(parallel, setup_and_forward);
+      run(parallel, receive);
+
+      while (std::any_of(level_done.begin(), level_done.end(), [](const char d) { return !d; })) {
+        run(parallel, forward);
+        run(parallel, receive);
+      }
+    }
+
+    adiar_assert(std::all_of(pqs.begin(), pqs.end(), [](const unique_ptr<PriorityQueue> &pq) { return pq->empty(); }),
+                 "All requests have been processed");
+
+    // Combine the output of all workers
+    result_type result = result_type();
+    for (const result_type &r : results) { result += r; }
+
+    return result;
+  }
+
+  template<typename Policy, typename PriorityQueue>
+  typename Policy::result_type
+  __count(const Policy &policy,
+          const typename Policy::dd_type &dd,
+          const typename Policy::label_type varcount,
+          const size_t workers,
+          const size_t pq_max_memory,
+          const size_t pq_max_size)
   {
     adiar_assert(!dd->is_terminal(),
                  "Count Algorithm does not support terminal case");
 
+    if (1u < workers) {
+      return __count_parallel<Policy, PriorityQueue>
+        (policy, dd, varcount, workers, pq_max_memory, pq_max_size);
+    }
+
     // Set up output
-    uint64_t result = 0u;
+    typename Policy::result_type result = typename Policy::result_type();
 
     // Set up input
     node_stream<> ns(dd);
@@ -135,7 +522,7 @@ namespace adiar::internal
     {
       const node root = ns.peek();
 
-      count_pq.push({ {root.uid()}, {}, Policy::init_data });
+      count_pq.push({ {root.uid()}, {}, policy.init_data });
     }
 
     // Take out the rest of the nodes and process them one by one
@@ -154,24 +541,32 @@ namespace adiar::internal
         typename Policy::data_type data = request.data;
 
         while (count_pq.can_pull() && count_pq.top().target == n.uid()) {
-          data = Policy::merge(std::move(data), count_pq.pull().data);
+          data = policy.merge(std::move(data), count_pq.pull().data);
         }
 
-        data = Policy::merge_end(std::move(data));
+        data = policy.merge_end(std::move(data));
 
         // Forward requests for children of 'n'
-        result += __count_resolve<Policy>(count_pq, n.low(),  data, varcount);
-        result += __count_resolve<Policy>(count_pq, n.high(), data, varcount);
+        result += __count_resolve(policy, count_pq, n, false, data, varcount);
+        result += __count_resolve(policy, count_pq, n, true,  data, varcount);
       }
     }
 
     return result;
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Accumulate a count along all paths of a decision diagram.
+  ///
+  /// \param policy Instance of the policy, e.g. with the weights for a weighted
+  ///               count (default is `Policy()`).
+  //////////////////////////////////////////////////////////////////////////////
   template<typename Policy>
-  uint64_t count(const exec_policy &ep,
-                 const typename Policy::dd_type &dd,
-                 const typename Policy::label_type varcount)
+  typename Policy::result_type
+  count(const exec_policy &ep,
+        const typename Policy::dd_type &dd,
+        const typename Policy::label_type varcount,
+        const Policy &policy = Policy())
   {
     adiar_assert(!dd_isterminal(dd),
                  "Count algorithm does not work on terminal-only edge case");
@@ -183,7 +578,27 @@ namespace adiar::internal
     // structures and check whether we can run them with a faster internal
     // memory variant.
 
-    const size_t aux_available_memory = memory_available() - node_stream<>::memory_usage();
+#ifdef ADIAR_STATS
+    // The statistics are not thread-safe.
+    const size_t workers = 1u;
+#else
+    const size_t workers = ep.thread_count().count();
+#endif
+
+    // The memory of the streams, the buffers of the workers, and the tables of
+    // the policy (e.g. the weights for `bdd_wmc`) is not available.
+    const size_t used_memory = policy.memory_usage()
+      + (1u < workers
+         ? level_info_stream<>::memory_usage() + workers * count_parallel_memory<Policy>(workers)
+         : node_stream<>::memory_usage());
+
+    if (memory_available(ep) < used_memory) {
+      throw out_of_range("Not enough memory for the tables of this count");
+    }
+
+    // The remaining memory is shared equally between the priority queues of
+    // all workers.
+    const size_t aux_available_memory = (memory_available(ep) - used_memory) / workers;
 
     const size_t pq_memory_fits =
       count_priority_queue_t<typename Policy::data_type, ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(aux_available_memory);
@@ -202,7 +617,7 @@ namespace adiar::internal
       return __count<Policy, count_priority_queue_t<typename Policy::data_type,
                                                     0,
                                                     memory_mode::Internal>>
-        (dd, varcount, aux_available_memory, max_pq_size);
+        (policy, dd, varcount, workers, aux_available_memory, max_pq_size);
     } else if(!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_count.lpq.internal += 1u;
@@ -210,7 +625,7 @@ namespace adiar::internal
       return __count<Policy, count_priority_queue_t<typename Policy::data_type,
                                                     ADIAR_LPQ_LOOKAHEAD,
                                                     memory_mode::Internal>>
-        (dd, varcount, aux_available_memory, max_pq_size);
+        (policy, dd, varcount, workers, aux_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_count.lpq.external += 1u;
@@ -218,7 +633,7 @@ namespace adiar::internal
       return __count<Policy, count_priority_queue_t<typename Policy::data_type,
                                                     ADIAR_LPQ_LOOKAHEAD,
                                                     memory_mode::External>>
-        (dd, varcount, aux_available_memory, max_pq_size);
+        (policy, dd, varcount, workers, aux_available_memory, max_pq_size);
     }
   }
 }
@@ -0,0 +1,6 @@
+#include "depth_first.h"
+
+namespace adiar::internal
+{
+  statistics::depth_first_t stats_depth_first;
+}
@@ -0,0 +1,604 @@
+#ifndef ADIAR_INTERNAL_ALGORITHMS_DEPTH_FIRST_H
+#define ADIAR_INTERNAL_ALGORITHMS_DEPTH_FIRST_H
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <adiar/bool_op.h>
+#include <adiar/exec_policy.h>
+#include <adiar/statistics.h>
+#include <adiar/types.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/dd.h>
+#include <adiar/internal/algorithms/build.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/ptr.h>
+#include <adiar/internal/data_types/tuple.h>
+#include <adiar/internal/io/node_file.h>
+#include <adiar/internal/io/node_stream.h>
+#include <adiar/internal/io/node_writer.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //  Depth-first Engine
+  // ====================
+  //
+  // Conventional depth-first and memoised algorithms on a local (internal
+  // memory) unique node table. For tiny decision diagrams, the constant
+  // overhead of the levelized algorithms (temporary files, levelized priority
+  // queues, and the bottom-up Reduce sweep) dominates the running time. Here,
+  // the inputs are instead copied into a local unique table, the operation is
+  // computed recursively, and the result is written as a canonical
+  // `levelized_file<node>`.
+  //
+  // If the local unique table grows beyond its budget, then the computation is
+  // abandoned such that the caller can fall back to the levelized algorithm.
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// Struct to hold statistics
+  extern statistics::depth_first_t stats_depth_first;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maximum total number of input nodes for `exec_policy::engine::Auto`
+  ///        to pick the depth-first engine.
+  ///
+  /// \details A node takes up 24 bytes, while its entries in the unique table
+  ///          and the memoisation tables take up another ~100 bytes. With this
+  ///          threshold, the entire computation (usually) stays within the L2
+  ///          cache.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t depth_first_threshold = 1024u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Maximum number of nodes in the local unique table (relative to the
+  ///        inputs' size) before `exec_policy::engine::Auto` abandons the
+  ///        depth-first engine.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t depth_first_budget_factor = 8u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the depth-first engine should be used for inputs with a
+  ///        total of `inputs_size` many nodes.
+  //////////////////////////////////////////////////////////////////////////////
+  inline bool
+  depth_first_fits(const exec_policy &ep, const size_t inputs_size)
+  {
+    switch (ep.engine_mode()) {
+    case exec_policy::engine::Depth_First:
+      return true;
+
+    case exec_policy::engine::Levelized:
+      return false;
+
+    case exec_policy::engine::Auto:
+    default:
+      // Other settings pin a specific variant of the levelized algorithms.
+      if (ep.access_mode()  != exec_policy::access::Auto
+          || ep.memory_mode()  != exec_policy::memory::Auto
+          || ep.quantify_alg() != exec_policy::quantify::Auto) {
+        return false;
+      }
+      // The recursion has no levels in-between which to report on progress or
+      // to check for cancellation, the deadline, or the arc budget.
+      if (ep.progress_callback() || ep.cancellation_token().is_cancellable()
+          || ep.time_limit().is_set()
+          || ep.arc_limit() != exec_policy::arc_budget()) {
+        return false;
+      }
+      return inputs_size <= depth_first_threshold;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Exception thrown when the local unique table exceeds its budget.
+  //////////////////////////////////////////////////////////////////////////////
+  struct depth_first_overflow
+  { };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Hash function for pointers within the local unique table.
+  //////////////////////////////////////////////////////////////////////////////
+  struct depth_first_ptr_hash
+  {
+    inline size_t operator() (const ptr_uint64 &p) const
+    {
+      constexpr uint64_t prime = 0x9E3779B97F4A7C15u;
+
+      const uint64_t h = p.is_node()
+        ? (static_cast<uint64_t>(p.label()) << 40) ^ static_cast<uint64_t>(p.id())
+        : ~static_cast<uint64_t>(p.value());
+
+      return static_cast<size_t>(h * prime);
+    }
+
+    template<uint8_t Cardinality>
+    inline size_t operator() (const tuple<ptr_uint64, Cardinality> &t) const
+    {
+      size_t h = 0u;
+      for (size_t i = 0u; i < Cardinality; ++i) {
+        h = (h << 7) ^ (h >> 3) ^ (*this)(t[i]);
+      }
+      return h;
+    }
+
+    inline size_t operator() (const node &n) const
+    {
+      return (static_cast<size_t>(n.label()) << 1) ^ (*this)(n.children());
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Local (internal memory) unique node table with depth-first and
+  ///        memoised operations on its nodes.
+  ///
+  /// \details Pointers into the table are `ptr_uint64` with the node's label
+  ///          and its index in the table as its identifier. Hence, the
+  ///          reduction rules and the comparators on pointers can be used as
+  ///          is.
+  ///
+  /// \tparam DdPolicy Decision diagram policy to provide the reduction rules.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  class depth_first_engine
+  {
+  public:
+    using dd_type       = typename DdPolicy::dd_type;
+    using node_type     = typename DdPolicy::node_type;
+    using pointer_type  = typename DdPolicy::pointer_type;
+    using label_type    = typename DdPolicy::label_type;
+    using children_type = typename node_type::children_type;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief All nodes of the table, indexed by their id.
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<node_type> _nodes;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Unique table from (label, low, high) to the pointer of the node.
+    ////////////////////////////////////////////////////////////////////////////
+    std::unordered_map<node_type, pointer_type, depth_first_ptr_hash> _unique;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum number of nodes allowed in the unique table.
+    ////////////////////////////////////////////////////////////////////////////
+    const size_t _budget;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create an empty unique table for at most `budget` many nodes.
+    ////////////////////////////////////////////////////////////////////////////
+    depth_first_engine(const size_t budget)
+      : _budget(std::min<size_t>(budget, DdPolicy::max_id))
+    {
+      const size_t expected_size = std::min<size_t>(_budget, depth_first_threshold);
+      _nodes.reserve(expected_size);
+      _unique.reserve(expected_size);
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of nodes in the unique table.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t size() const
+    { return _nodes.size(); }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the node with the given pointer.
+    ///
+    /// \pre `p.is_node()`
+    ////////////////////////////////////////////////////////////////////////////
+    const node_type& deref(const pointer_type &p) const
+    {
+      adiar_assert(p.is_node());
+      adiar_assert(p.id() < _nodes.size());
+      return _nodes[p.id()];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the (possibly suppressed) node with the given label and
+    ///        children.
+    ///
+    /// \throws depth_first_overflow If the budget is exceeded.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type make_node(const label_type label,
+                           const pointer_type &low,
+                           const pointer_type &high)
+    {
+      const node_type key(label, 0u, low, high);
+
+      const pointer_type rr_res = DdPolicy::reduction_rule(key);
+      if (rr_res != key.uid()) { return rr_res; }
+
+      const auto lookup = _unique.find(key);
+      if (lookup != _unique.end()) { return lookup->second; }
+
+      if (_budget <= _nodes.size()) { throw depth_first_overflow(); }
+
+      const pointer_type res(label, _nodes.size());
+      _nodes.push_back(node_type(res, low, high));
+      _unique.insert({ key, res });
+
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Copy a decision diagram into the unique table.
+    ///
+    /// \returns Pointer to the root of `f` within the unique table.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type import(const dd_type &f)
+    {
+      node_stream<true> ns(f);
+
+      // Map from nodes in `f` to their copy in the unique table.
+      std::unordered_map<pointer_type, pointer_type, depth_first_ptr_hash> copies;
+
+      pointer_type root = pointer_type::nil();
+      while (ns.can_pull()) {
+        const node_type n = ns.pull();
+
+        if (n.is_terminal()) {
+          root = n.uid();
+          break;
+        }
+
+        const pointer_type low  = n.low().is_node()  ? copies.at(n.low())  : n.low();
+        const pointer_type high = n.high().is_node() ? copies.at(n.high()) : n.high();
+
+        root = make_node(n.label(), low, high);
+        copies.insert({ n.uid(), root });
+      }
+      return root;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Write the decision diagram rooted in `root` to a (canonical)
+    ///        levelized node file.
+    ////////////////////////////////////////////////////////////////////////////
+    shared_levelized_file<node_type> export_to_file(const pointer_type &root) const
+    {
+      if (root.is_terminal()) {
+        return build_terminal<DdPolicy>(root.value());
+      }
+
+      // Collect all reachable nodes level by level.
+      std::map<label_type, std::vector<pointer_type>> levels;
+      {
+        std::vector<bool> visited(_nodes.size(), false);
+        std::vector<pointer_type> stack = { root };
+        visited[root.id()] = true;
+
+        while (!stack.empty()) {
+          const pointer_type p = stack.back();
+          stack.pop_back();
+
+          levels[p.label()].push_back(p);
+
+          const node_type &n = deref(p);
+          for (const pointer_type &c : { n.low(), n.high() }) {
+            if (c.is_node() && !visited[c.id()]) {
+              visited[c.id()] = true;
+              stack.push_back(c);
+            }
+          }
+        }
+      }
+
+      // Write levels bottom-up, where the nodes on each level are sorted such
+      // that the output is canonical.
+      std::unordered_map<pointer_type, pointer_type, depth_first_ptr_hash> out_ptrs;
+
+      shared_levelized_file<node_type> nf;
+      {
+        node_writer nw(nf);
+
+        std::vector<node_type> level_nodes;
+        for (auto level = levels.rbegin(); level != levels.rend(); ++level) {
+          level_nodes.clear();
+
+          for (const pointer_type &p : level->second) {
+            const node_type &n = deref(p);
+
+            const pointer_type low  = n.low().is_node()  ? out_ptrs.at(n.low())  : n.low();
+            const pointer_type high = n.high().is_node() ? out_ptrs.at(n.high()) : n.high();
+
+            // Abuse the id to remember the original node.
+            level_nodes.push_back(node_type(level->first, p.id(), low, high));
+          }
+
+          std::sort(level_nodes.begin(), level_nodes.end(),
+                    [](const node_type &a, const node_type &b) {
+                      return a.high() > b.high()
+                        || (a.high() == b.high() && a.low() > b.low());
+                    });
+
+          typename DdPolicy::id_type out_id = DdPolicy::max_id;
+          for (const node_type &n : level_nodes) {
+            const node_type out_node(level->first, out_id--, n.low(), n.high());
+            out_ptrs.insert({ pointer_type(level->first, n.id()), out_node.uid() });
+            nw << out_node;
+          }
+        }
+      }
+      return nf;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The level of `p` where terminals are placed below all nodes.
+    ////////////////////////////////////////////////////////////////////////////
+    static label_type __level(const pointer_type &p)
+    {
+      return p.is_node() ? p.label() : DdPolicy::max_label + 1u;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The children of `p` when seen from the given `level`.
+    ////////////////////////////////////////////////////////////////////////////
+    children_type __cofactors(const pointer_type &p, const label_type level) const
+    {
+      if (p.is_node() && p.label() == level) {
+        return deref(p).children();
+      }
+      return DdPolicy::reduction_rule_inv(p);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the terminal `p` stays the same on every level, i.e.
+    ///        whether it is safe to shortcut on it.
+    ////////////////////////////////////////////////////////////////////////////
+    static bool __is_shortcutable(const pointer_type &p)
+    {
+      const children_type cs = DdPolicy::reduction_rule_inv(p);
+      return cs[0] == p && cs[1] == p;
+    }
+
+    using apply_memo_t =
+      std::unordered_map<tuple<pointer_type, 2>, pointer_type, depth_first_ptr_hash>;
+
+    pointer_type __apply(apply_memo_t &memo,
+                         const pointer_type &p,
+                         const pointer_type &q,
+                         const bool_op &op)
+    {
+      // Resolve terminal cases
+      if (p.is_terminal() && q.is_terminal()) {
+        return op(p, q);
+      }
+      if (p.is_terminal() && __is_shortcutable(p)) {
+        const pointer_type res_F = op(p, pointer_type(false));
+        const pointer_type res_T = op(p, pointer_type(true));
+        if (res_F == res_T) { return res_F; }
+      }
+      if (q.is_terminal() && __is_shortcutable(q)) {
+        const pointer_type res_F = op(pointer_type(false), q);
+        const pointer_type res_T = op(pointer_type(true), q);
+        if (res_F == res_T) { return res_F; }
+      }
+
+      // Look up prior result
+      const tuple<pointer_type, 2> key = { p, q };
+      const auto lookup = memo.find(key);
+      if (lookup != memo.end()) { return lookup->second; }
+
+      // Recurse
+      const label_type level = std::min(__level(p), __level(q));
+
+      const children_type p_cs = __cofactors(p, level);
+      const children_type q_cs = __cofactors(q, level);
+
+      const pointer_type low  = __apply(memo, p_cs[false], q_cs[false], op);
+      const pointer_type high = __apply(memo, p_cs[true],  q_cs[true],  op);
+
+      const pointer_type res = make_node(level, low, high);
+      memo.insert({ key, res });
+      return res;
+    }
+
+    using ite_memo_t =
+      std::unordered_map<tuple<pointer_type, 3>, pointer_type, depth_first_ptr_hash>;
+
+    pointer_type __ite(ite_memo_t &memo,
+                       const pointer_type &f,
+                       const pointer_type &g,
+                       const pointer_type &h)
+    {
+      // Resolve terminal cases
+      if (f.is_terminal()) { return f.value() ? g : h; }
+      if (g == h)          { return g; }
+
+      // Look up prior result
+      const tuple<pointer_type, 3> key = { f, g, h };
+      const auto lookup = memo.find(key);
+      if (lookup != memo.end()) { return lookup->second; }
+
+      // Recurse
+      const label_type level = std::min({ __level(f), __level(g), __level(h) });
+
+      const children_type f_cs = __cofactors(f, level);
+      const children_type g_cs = __cofactors(g, level);
+      const children_type h_cs = __cofactors(h, level);
+
+      const pointer_type low  = __ite(memo, f_cs[false], g_cs[false], h_cs[false]);
+      const pointer_type high = __ite(memo, f_cs[true],  g_cs[true],  h_cs[true]);
+
+      const pointer_type res = make_node(level, low, high);
+      memo.insert({ key, res });
+      return res;
+    }
+
+    using quantify_memo_t =
+      std::unordered_map<pointer_type, pointer_type, depth_first_ptr_hash>;
+
+    pointer_type __quantify(quantify_memo_t &memo,
+                            apply_memo_t &apply_memo,
+                            const pointer_type &p,
+                            const label_type var,
+                            const bool_op &op)
+    {
+      // Resolve terminal cases and nodes below the variable
+      if (p.is_terminal() || var < p.label()) { return p; }
+
+      // Look up prior result
+      const auto lookup = memo.find(p);
+      if (lookup != memo.end()) { return lookup->second; }
+
+      // Recurse
+      const node_type &n = deref(p);
+
+      const pointer_type res = n.label() == var
+        ? __apply(apply_memo, n.low(), n.high(), op)
+        : make_node(n.label(),
+                    __quantify(memo, apply_memo, n.low(),  var, op),
+                    __quantify(memo, apply_memo, n.high(), var, op));
+
+      memo.insert({ p, res });
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Product construction of `p` and `q` with the given operator.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type apply(const pointer_type &p,
+                       const pointer_type &q,
+                       const bool_op &op)
+    {
+      apply_memo_t memo;
+      return __apply(memo, p, q, op);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief If-Then-Else of `f`, `g`, and `h`.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type ite(const pointer_type &f,
+                     const pointer_type &g,
+                     const pointer_type &h)
+    {
+      ite_memo_t memo;
+      return __ite(memo, f, g, h);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Quantification of `var` in `p` with the given operator.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type quantify(const pointer_type &p,
+                          const label_type var,
+                          const bool_op &op)
+    {
+      quantify_memo_t memo;
+      apply_memo_t apply_memo;
+      return __quantify(memo, apply_memo, p, var, op);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Size of the local unique table for the given inputs.
+  //////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  __depth_first_budget(const exec_policy &ep, const size_t inputs_size)
+  {
+    return ep.engine_mode() == exec_policy::engine::Depth_First
+      ? std::numeric_limits<size_t>::max()
+      : depth_first_budget_factor * std::max<size_t>(inputs_size, depth_first_threshold);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Depth-first product construction of two decision diagrams.
+  ///
+  /// \returns The reduced result or nothing if the budget was exceeded.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  optional<typename DdPolicy::dd_type>
+  depth_first_apply(const exec_policy &ep,
+                    const typename DdPolicy::dd_type &f,
+                    const typename DdPolicy::dd_type &g,
+                    const bool_op &op)
+  {
+#ifdef ADIAR_STATS
+    stats_depth_first.runs += 1u;
+#endif
+    try {
+      depth_first_engine<DdPolicy> engine(__depth_first_budget(ep, f.size() + g.size()));
+
+      const typename DdPolicy::pointer_type f_root = engine.import(f);
+      const typename DdPolicy::pointer_type g_root = engine.import(g);
+
+      return typename DdPolicy::dd_type(engine.export_to_file(engine.apply(f_root, g_root, op)));
+    } catch (const depth_first_overflow &) {
+#ifdef ADIAR_STATS
+      stats_depth_first.fallbacks += 1u;
+#endif
+      return make_optional<typename DdPolicy::dd_type>();
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Depth-first If-Then-Else of three decision diagrams.
+  ///
+  /// \returns The reduced result or nothing if the budget was exceeded.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  optional<typename DdPolicy::dd_type>
+  depth_first_ite(const exec_policy &ep,
+                  const typename DdPolicy::dd_type &f,
+                  const typename DdPolicy::dd_type &g,
+                  const typename DdPolicy::dd_type &h)
+  {
+#ifdef ADIAR_STATS
+    stats_depth_first.runs += 1u;
+#endif
+    try {
+      depth_first_engine<DdPolicy> engine(__depth_first_budget(ep, f.size() + g.size() + h.size()));
+
+      const typename DdPolicy::pointer_type f_root = engine.import(f);
+      const typename DdPolicy::pointer_type g_root = engine.import(g);
+      const typename DdPolicy::pointer_type h_root = engine.import(h);
+
+      return typename DdPolicy::dd_type(engine.export_to_file(engine.ite(f_root, g_root, h_root)));
+    } catch (const depth_first_overflow &) {
+#ifdef ADIAR_STATS
+      stats_depth_first.fallbacks += 1u;
+#endif
+      return make_optional<typename DdPolicy::dd_type>();
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Depth-first quantification of a single variable.
+  ///
+  /// \returns The reduced result or nothing if the budget was exceeded.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  optional<typename DdPolicy::dd_type>
+  depth_first_quantify(const exec_policy &ep,
+                       const typename DdPolicy::dd_type &f,
+                       const typename DdPolicy::label_type var,
+                       const bool_op &op)
+  {
+#ifdef ADIAR_STATS
+    stats_depth_first.runs += 1u;
+#endif
+    try {
+      depth_first_engine<DdPolicy> engine(__depth_first_budget(ep, f.size()));
+
+      const typename DdPolicy::pointer_type f_root = engine.import(f);
+
+      return typename DdPolicy::dd_type(engine.export_to_file(engine.quantify(f_root, var, op)));
+    } catch (const depth_first_overflow &) {
+#ifdef ADIAR_STATS
+      stats_depth_first.fallbacks += 1u;
+#endif
+      return make_optional<typename DdPolicy::dd_type>();
+    }
+  }
+}
+
+#endif // ADIAR_INTERNAL_ALGORITHMS_DEPTH_FIRST_H
@@ -4,6 +4,7 @@
 #include <adiar/exec_policy.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/dd_func.h>
@@ -238,6 +239,8 @@ namespace adiar::internal
       const typename intercut_policy::label_type out_label = intercut_pq.current_level();
       typename intercut_policy::id_type out_id = 0;
 
+      level_checkpoint(ep, out_label, intercut_pq.size(), aw);
+
       const bool hit_level = out_label == l;
 
       // Forward to next label to cut on after this level
@@ -342,7 +345,7 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const tpie::memory_size_type aux_available_memory = memory_available()
+    const tpie::memory_size_type aux_available_memory = memory_available(ep)
       // Input stream
       - node_stream<>::memory_usage()
       // Output stream
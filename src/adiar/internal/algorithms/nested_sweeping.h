@@ -6,6 +6,7 @@
 
 #include <adiar/exec_policy.h>
 
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/memory.h>
@@ -1212,7 +1213,7 @@ namespace adiar::internal
       //////////////////////////////////////////////////////////////////////////
       template<typename nesting_policy, typename inner_pq_t, typename outer_pq_t>
       inline void
-      up(const exec_policy &/*ep*/,
+      up(const exec_policy &ep,
          const arc_stream<> &outer_arcs,
          outer_pq_t &outer_pq,
          node_writer &outer_writer,
@@ -1248,6 +1249,8 @@ namespace adiar::internal
           adiar_assert(!decorated_pq.has_current_level() || level == decorated_pq.current_level(),
                        "level and priority queue should be in sync");
 
+          level_checkpoint(ep, level, decorated_pq.size(), outer_writer.size() * sizeof(node));
+
           if (nesting_policy::reduce_strategy == nested_sweeping::Never_Canonical ||
               (nesting_policy::reduce_strategy == nested_sweeping::Final_Canonical && !is_last_inner)) {
 #ifdef ADIAR_STATS
@@ -1406,7 +1409,7 @@ namespace adiar::internal
 
     // Outer Up Sweep: Instantiate the (levelized) priority queue and other
     // Reduce state variables, e.g. i-level cuts.
-    adiar_assert(outer_pq_memory + outer_roots_memory + inner_memory < memory_available(),
+    adiar_assert(outer_pq_memory + outer_roots_memory + inner_memory < memory_available(ep),
                  "Enough memory should be left priority queue and inner sweep");
 
     using outer_pq_t = nested_sweeping::outer::up__pq_t<outer_look_ahead, outer_mem_mode>;
@@ -1462,6 +1465,8 @@ namespace adiar::internal
       adiar_assert(next_inner == inner_iter_t::end || next_inner <= outer_level.level(),
                    "next_inner level should (if it exists) be above current level (inclusive).");
 
+      level_checkpoint(ep, outer_level.level(), outer_pq.size(), outer_writer.size() * sizeof(node));
+
       // -----------------------------------------------------------------------
       // CASE Unnested Level with no nested sweep above:
       //   Reduce this level (without decorators).
@@ -1812,7 +1817,7 @@ namespace adiar::internal
     //
     // Here, we still need to keep in mind, that the available memory needs to
     // be distributed across (up to) four priority queues!
-    const size_t total_memory = memory_available();
+    const size_t total_memory = memory_available(ep);
 
     const size_t outer_memory = total_memory / 2;
     const size_t inner_memory = total_memory - outer_memory;
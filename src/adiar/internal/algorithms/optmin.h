@@ -202,7 +202,7 @@ namespace adiar::internal
     // structures and check whether we can run them with a faster internal
     // memory variant.
 
-    const size_t aux_available_memory = memory_available() - node_stream<>::memory_usage();
+    const size_t aux_available_memory = memory_available(ep) - node_stream<>::memory_usage();
 
     const size_t pq_memory_fits =
         optmin_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
@@ -3,6 +3,10 @@
 
 #include <adiar/exec_policy.h>
 
+#include <adiar/internal/assert.h>
+#include <adiar/internal/block_size.h>
+#include <adiar/internal/cnl.h>
+#include <adiar/internal/cut.h>
 #include <adiar/internal/dd.h>
 #include <adiar/internal/algorithms/prod2.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
@@ -12,6 +16,8 @@
 #include <adiar/internal/data_types/tuple.h>
 #include <adiar/internal/io/levelized_file.h>
 #include <adiar/internal/io/levelized_file_stream.h>
+#include <adiar/internal/io/node_random_access.h>
+#include <adiar/internal/io/node_stream.h>
 
 namespace adiar::internal
 {
@@ -73,6 +79,80 @@ namespace adiar::internal
   using comparison_priority_queue_2_t =
     priority_queue<mem_mode, pred_request<1>, request_second_lt<pred_request<1>>>;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Ordering of requests for `__comparison_check_ra`, i.e. primarily on
+  ///        their level and secondly lexicographically starting with the
+  ///        `idx`th target (the one read from a stream).
+  //////////////////////////////////////////////////////////////////////////////
+  template<size_t idx>
+  struct comparison_ra_lt
+  {
+    inline bool operator()(const pred_request<0> &a, const pred_request<0> &b)
+    {
+      const ptr_uint64::label_type label_a = a.target.first().label();
+      const ptr_uint64::label_type label_b = b.target.first().label();
+
+      return label_a < label_b
+        || (label_a == label_b && (a.target[idx] < b.target[idx]
+                                   || (a.target[idx] == b.target[idx]
+                                       && a.target[1u-idx] < b.target[1u-idx])));
+    }
+  };
+
+  template<size_t ra_idx, size_t look_ahead, memory_mode mem_mode>
+  using comparison_priority_queue_ra_t =
+    levelized_node_priority_queue<pred_request<0>, comparison_ra_lt<1u-ra_idx>,
+                                  look_ahead,
+                                  mem_mode,
+                                  2u,
+                                  0u>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Level checking policy for `comparison_check` that never terminates
+  ///        early, where the priority queues are bounded by the product of the
+  ///        inputs' cuts of type `ct_0` and `ct_1`.
+  //////////////////////////////////////////////////////////////////////////////
+  template<cut::type ct_0, cut::type ct_1>
+  class ignore_levels
+  {
+  public:
+    static size_t pq1_upper_bound(const shared_levelized_file<node> &in_0,
+                                  const shared_levelized_file<node> &in_1)
+    {
+      const safe_size_t max_2level_cut_0 = in_0->max_2level_cut[ct_0];
+      const safe_size_t max_2level_cut_1 = in_1->max_2level_cut[ct_1];
+
+      return to_size(max_2level_cut_0 * max_2level_cut_1);
+    }
+
+    static size_t pq2_upper_bound(const shared_levelized_file<node> &in_0,
+                                  const shared_levelized_file<node> &in_1)
+    {
+      const safe_size_t max_1level_cut_0 = in_0->max_1level_cut[ct_0];
+      const safe_size_t max_1level_cut_1 = in_1->max_1level_cut[ct_1];
+
+      return to_size(max_1level_cut_0 * max_1level_cut_1);
+    }
+
+    static constexpr size_t memory_usage()
+    {
+      return 0u;
+    }
+
+  public:
+    ignore_levels(const shared_levelized_file<node> &/*f0*/,
+                  const shared_levelized_file<node> &/*f1*/)
+    { /* do nothing */ }
+
+    void next_level(ptr_uint64::label_type /* level */)
+    { /* do nothing */ }
+
+    bool on_step()
+    { return false; }
+
+    static constexpr bool termination_value = false;
+  };
+
   template<typename comp_policy, typename pq_1_t, typename pq_2_t>
   bool __comparison_check(const shared_levelized_file<node> &f0,
                           const shared_levelized_file<node> &f1,
@@ -187,6 +267,175 @@ namespace adiar::internal
     return comp_policy::no_early_return_value;
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Variant of `__comparison_check` where the nodes of the `ra_idx`th
+  ///        input are obtained with random access; this removes the need for
+  ///        the secondary priority queue.
+  ///
+  /// \pre The `ra_idx`th input is canonical.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename comp_policy, size_t ra_idx, typename pq_t>
+  bool __comparison_check_ra(const shared_levelized_file<node> &f0,
+                             const shared_levelized_file<node> &f1,
+                             const bool negate0,
+                             const bool negate1,
+                             const tpie::memory_size_type pq_memory,
+                             const size_t max_pq_size)
+  {
+    constexpr size_t pq_idx = 1u - ra_idx;
+
+    // Set up input
+    node_stream<> in_nodes_pq(pq_idx == 0 ? f0 : f1, pq_idx == 0 ? negate0 : negate1);
+    node_random_access<> in_nodes_ra(ra_idx == 0 ? f0 : f1, ra_idx == 0 ? negate0 : negate1);
+
+    node v_pq = in_nodes_pq.pull();
+
+    node v_ra;
+    if (in_nodes_ra.root().is_terminal()) {
+      v_ra = node(in_nodes_ra.root().value());
+    } else {
+      in_nodes_ra.setup_next_level(in_nodes_ra.root().label());
+      v_ra = in_nodes_ra.at(in_nodes_ra.root());
+    }
+
+    const node &v0 = pq_idx == 0 ? v_pq : v_ra;
+    const node &v1 = pq_idx == 0 ? v_ra : v_pq;
+
+    // Edge-case for terminals
+    if (v0.is_terminal() || v1.is_terminal()) {
+      bool ret_value;
+      if (comp_policy::resolve_terminals(v0, v1, ret_value)) {
+        return ret_value;
+      }
+    }
+
+    if (v0.low().is_terminal() && v0.high().is_terminal() &&
+        v1.low().is_terminal() && v1.high().is_terminal()) {
+      return comp_policy::resolve_singletons(v0, v1);
+    }
+
+    // Set up cross-level priority queue
+    pq_t comparison_pq({f0, f1}, pq_memory, max_pq_size, stats_equality.lpq);
+    comparison_pq.push({ { v0.uid(), v1.uid() }, {} });
+
+    // Initialise level checking
+    typename comp_policy::level_check_t level_checker(f0,f1);
+
+    while (!comparison_pq.empty()) {
+      // Set up next level
+      comparison_pq.setup_next_level();
+
+      const ptr_uint64::label_type level = comparison_pq.current_level();
+      level_checker.next_level(level);
+
+      if (!in_nodes_ra.has_current_level() || in_nodes_ra.current_level() < level) {
+        in_nodes_ra.setup_next_level(level);
+      }
+
+      while (!comparison_pq.empty_level()) {
+        const pred_request_2 req = { comparison_pq.pull().target,
+                                     { {{ node::pointer_type::nil(), node::pointer_type::nil() }} } };
+
+        // Skip all remaining requests to the same node
+        while (comparison_pq.can_pull() && (comparison_pq.top().target == req.target)) {
+          comparison_pq.pull();
+        }
+
+        if (level_checker.on_step()) {
+          return level_checker.termination_value;
+        }
+
+        // Seek request partially in stream
+        const typename comp_policy::pointer_type t_pq = req.target[pq_idx];
+        if (t_pq.is_node() && t_pq.label() == level) {
+          while (v_pq.uid() < t_pq && in_nodes_pq.can_pull()) {
+            v_pq = in_nodes_pq.pull();
+          }
+
+          adiar_assert(v_pq.uid() == t_pq, "Must have found correct node in stream");
+        }
+
+        // Obtain node by random access (if it is on this level)
+        const typename comp_policy::pointer_type t_ra = req.target[ra_idx];
+        if (t_ra.is_node() && t_ra.label() == level) {
+          v_ra = in_nodes_ra.at(t_ra);
+        }
+
+        // Obtain children or root for both nodes (depending on level)
+        const tuple<typename comp_policy::children_type, 2> children =
+          comp_policy::merge(req, req.target.first(), v0, v1);
+
+        // Create pairing of product children and obtain new recursion targets
+        const tuple<typename comp_policy::pointer_type> rec_pair_0 =
+          { children[0][false], children[1][false] };
+
+        const tuple<typename comp_policy::pointer_type> rec_pair_1 =
+          { children[0][true], children[1][true] };
+
+        // Forward pairing and return early if possible
+        if (comp_policy::resolve_request(comparison_pq, rec_pair_0)
+            || comp_policy::resolve_request(comparison_pq, rec_pair_1)) {
+          return comp_policy::early_return_value;
+        }
+      }
+    }
+
+    return comp_policy::no_early_return_value;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Set up and run `__comparison_check_ra` with random access on the
+  ///        `ra_idx`th input.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename comp_policy, size_t ra_idx>
+  bool comparison_check_ra(const exec_policy &ep,
+                           const shared_levelized_file<node> &f0,
+                           const shared_levelized_file<node> &f1,
+                           const bool negate0,
+                           const bool negate1)
+  {
+    const size_t pq_available_memory = memory_available(ep)
+      // Input stream
+      - node_stream<>::memory_usage()
+      // Random access
+      - node_random_access<>::memory_usage((ra_idx == 0 ? f0 : f1)->width)
+      // Level checker policy
+      - comp_policy::level_check_t::memory_usage();
+
+    const size_t pq_memory_fits =
+      comparison_priority_queue_ra_t<ra_idx, ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(pq_available_memory);
+
+    const bool internal_only = ep.memory_mode() == exec_policy::memory::Internal;
+    const bool external_only = ep.memory_mode() == exec_policy::memory::External;
+
+    const size_t pq_bound = comp_policy::level_check_t::pq1_upper_bound(f0, f1);
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if(!external_only && max_pq_size <= no_lookahead_bound(comp_policy::lookahead_bound())) {
+#ifdef ADIAR_STATS
+      stats_equality.lpq.unbucketed += 1u;
+#endif
+      return __comparison_check_ra<comp_policy, ra_idx,
+                                   comparison_priority_queue_ra_t<ra_idx, 0, memory_mode::Internal>>
+        (f0, f1, negate0, negate1, pq_available_memory, max_pq_size);
+    } else if(!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_equality.lpq.internal += 1u;
+#endif
+      return __comparison_check_ra<comp_policy, ra_idx,
+                                   comparison_priority_queue_ra_t<ra_idx, ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>
+        (f0, f1, negate0, negate1, pq_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_equality.lpq.external += 1u;
+#endif
+      return __comparison_check_ra<comp_policy, ra_idx,
+                                   comparison_priority_queue_ra_t<ra_idx, ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>
+        (f0, f1, negate0, negate1, pq_available_memory, max_pq_size);
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// Behaviour can be changed with the 'comp_policy'.
   ///
@@ -213,13 +462,28 @@ namespace adiar::internal
                         const bool negate0,
                         const bool negate1)
   {
+    // Use random access if requested or the narrowest canonical input fits into
+    // a single block.
+    const size_t nodes_per_block = get_block_size() / sizeof(node);
+
+    const size_t width_0 = f0->canonical ? f0->width : node::max_id;
+    const size_t width_1 = f1->canonical ? f1->width : node::max_id;
+
+    if (ep.access_mode() == exec_policy::access::Random_Access
+        || (ep.access_mode() == exec_policy::access::Auto
+            && std::min(width_0, width_1) <= nodes_per_block)) {
+      return width_1 <= width_0
+        ? comparison_check_ra<comp_policy, 1>(ep, f0, f1, negate0, negate1)
+        : comparison_check_ra<comp_policy, 0>(ep, f0, f1, negate0, negate1);
+    }
+
     // Compute amount of memory available for auxiliary data structures after
     // having opened all streams.
     //
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const size_t aux_available_memory = memory_available()
+    const size_t aux_available_memory = memory_available(ep)
       // Input
       - 2*node_stream<>::memory_usage()
       // Level checker policy
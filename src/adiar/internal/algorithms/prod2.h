@@ -8,6 +8,7 @@
 #include <adiar/internal/assert.h>
 #include <adiar/internal/block_size.h>
 #include <adiar/internal/bool_op.h>
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/dd.h>
@@ -351,6 +352,8 @@ namespace adiar::internal
       typename Policy::label_type out_label = prod_pq.current_level();
       typename Policy::id_type out_id = 0;
 
+      level_checkpoint(ep, out_label, prod_pq.size(), aw);
+
       in_nodes_ra.setup_next_level(out_label);
 
       // Update maximum 1-level cut
@@ -478,6 +481,8 @@ namespace adiar::internal
       const typename Policy::label_type out_label = prod_pq_1.current_level();
       typename Policy::id_type out_id = 0;
 
+      level_checkpoint(ep, out_label, prod_pq_1.size(), aw);
+
       // Update max 1-level cut
       out_arcs->max_1level_cut = std::max(out_arcs->max_1level_cut, prod_pq_1.size());
 
@@ -705,7 +710,7 @@ namespace adiar::internal
     stats_prod2.ra.max_width = std::max(stats_prod2.ra.max_width, in_ra.width());
 #endif
 
-    const size_t pq_available_memory = memory_available()
+    const size_t pq_available_memory = memory_available(ep)
       // Input stream
       - node_stream<>::memory_usage()
       // Random access
@@ -762,7 +767,7 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const size_t aux_available_memory = memory_available()
+    const size_t aux_available_memory = memory_available(ep)
       // Input streams
       - 2*node_stream<>::memory_usage()
       // Output stream
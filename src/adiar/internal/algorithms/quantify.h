@@ -10,6 +10,7 @@
 #include <adiar/internal/assert.h>
 #include <adiar/internal/bool_op.h>
 #include <adiar/internal/block_size.h>
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/unreachable.h>
@@ -187,6 +188,8 @@ namespace adiar::internal
       const typename quantify_policy::label_type out_label = quantify_pq_1.current_level();
       typename quantify_policy::id_type out_id = 0;
 
+      level_checkpoint(ep, out_label, quantify_pq_1.size(), aw);
+
       // TODO: move quantification test out here instead
 
       const bool should_quantify = policy_impl.should_quantify(out_label);
@@ -442,7 +445,7 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const size_t aux_available_memory = memory_available()
+    const size_t aux_available_memory = memory_available(ep)
       // Input stream
       - node_stream_t::memory_usage()
       // Output stream
@@ -4,6 +4,7 @@
 #include <adiar/exec_policy.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/memory.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
@@ -143,33 +144,242 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////
   // Reduction Rule 2 sorting (and back again)
-  struct reduce_node_children_lt
+  struct reduce_uid_lt
   {
-    bool operator()(const node &a, const node &b)
+    bool operator()(const mapping &a, const mapping &b)
     {
-      // TODO (Attributed Edges):
-      //     Use the 'flag' bit on children to mark attributed edges. Currently,
-      //     we use this flag to mark whether Reduction Rule 1 was applied to
-      //     some node across some arc.
-      const ptr_uint64 a_high = unflag(a.high());
-      const ptr_uint64 a_low = unflag(a.low());
+      return a.old_uid > b.old_uid;
+    }
+  };
 
-      const ptr_uint64 b_high = unflag(b.high());
-      const ptr_uint64 b_low = unflag(b.low());
+  //////////////////////////////////////////////////////////////////////////////
+  // Radix sorting of the above
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Radix sort key equivalent to `reduce_queue_lt`.
+  //////////////////////////////////////////////////////////////////////////////
+  template<>
+  struct radix_sort_key<reduce_arc, reduce_queue_lt>
+  {
+    static constexpr size_t words = 1u;
 
-      return a_high > b_high || (a_high == b_high && a_low > b_low)
+    static inline uint64_t word(const reduce_arc &a, const size_t /*w*/)
+    {
+      return ~a.source()._raw;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Radix sort key equivalent to `reduce_node_children_lt`.
+  //////////////////////////////////////////////////////////////////////////////
+  template<>
+  struct radix_sort_key<node, reduce_node_children_lt>
+  {
 #ifndef NDEBUG
-        || (a_high == b_high && a_low == b_low && a.uid() > b.uid())
+    static constexpr size_t words = 3u;
+#else
+    static constexpr size_t words = 2u;
 #endif
-        ;
+
+    static inline uint64_t word(const node &n, const size_t w)
+    {
+      switch (w) {
+      case 0u:  return ~unflag(n.high())._raw;
+      case 1u:  return ~unflag(n.low())._raw;
+      default:  return ~static_cast<const ptr_uint64&>(n.uid())._raw;
+      }
     }
   };
 
-  struct reduce_uid_lt
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Radix sort key equivalent to `reduce_uid_lt`.
+  //////////////////////////////////////////////////////////////////////////////
+  template<>
+  struct radix_sort_key<mapping, reduce_uid_lt>
   {
-    bool operator()(const mapping &a, const mapping &b)
+    static constexpr size_t words = 1u;
+
+    static inline uint64_t word(const mapping &m, const size_t /*w*/)
     {
-      return a.old_uid > b.old_uid;
+      return ~static_cast<const ptr_uint64&>(m.old_uid)._raw;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Internal memory table to apply Reduction Rule 2 on a single level
+  ///        without sorting all of its nodes twice.
+  ///
+  /// \details Nodes are to be inserted in the order they are pulled from the
+  ///          priority queue, i.e. in descending order of their uid. Duplicates
+  ///          are found with an open-addressing (linear probing) hash table on
+  ///          their (unflagged) children. Only the unique nodes are afterwards
+  ///          sorted with `reduce_node_children_lt` to derive the very same
+  ///          (canonical) identifiers as the sorting-based variant. Since the
+  ///          insertion order already is the order of the internal arcs, the
+  ///          mappings can be pulled without sorting them back again.
+  //////////////////////////////////////////////////////////////////////////////
+  class reduce_rule2_table
+  {
+  private:
+    using index_type = size_t;
+
+    static constexpr index_type empty_slot = 0u;
+
+    /// \brief Unique nodes (indexed by order of their first occurrence).
+    tpie::array<node> _unique;
+
+    /// \brief Hash slots of `index + 1` into `_unique`. Reused afterwards to
+    ///        store the sorted order of `_unique`.
+    tpie::array<index_type> _slots;
+
+    /// \brief Uid of each inserted node.
+    tpie::array<node::uid_type> _old_uids;
+
+    /// \brief Index into `_unique` of each inserted node.
+    tpie::array<index_type> _unique_idx;
+
+    size_t _unique_size = 0u;
+    size_t _size = 0u;
+    size_t _front_idx = 0u;
+
+    reduce_node_children_hash _hash;
+    reduce_node_children_lt _lt;
+
+  private:
+    static size_t slots_for(const size_t no_elements)
+    {
+      // Power of two with a load factor of at most 1/2.
+      size_t ret = 2u;
+      while (ret < 2u * no_elements) { ret <<= 1; }
+      return ret;
+    }
+
+  public:
+    static tpie::memory_size_type
+    memory_usage(tpie::memory_size_type no_elements)
+    {
+      return tpie::array<node>::memory_usage(no_elements)
+        + tpie::array<index_type>::memory_usage(slots_for(no_elements))
+        + tpie::array<node::uid_type>::memory_usage(no_elements)
+        + tpie::array<index_type>::memory_usage(no_elements);
+    }
+
+    static tpie::memory_size_type
+    memory_fits(tpie::memory_size_type memory_bytes)
+    {
+      // Upper bound on the memory per element (with at most four slots each).
+      constexpr size_t element_bytes =
+        sizeof(node) + 4u * sizeof(index_type) + sizeof(node::uid_type) + sizeof(index_type);
+
+      tpie::memory_size_type ret = memory_bytes / element_bytes;
+      while (0 < ret && memory_bytes < memory_usage(ret)) { ret -= 1; }
+
+      adiar_assert(memory_usage(ret) <= memory_bytes,
+                   "memory_fits and memory_usage should agree.");
+      return ret;
+    }
+
+  public:
+    reduce_rule2_table(size_t no_elements)
+      : _unique(no_elements),
+        _slots(slots_for(no_elements), empty_slot),
+        _old_uids(no_elements),
+        _unique_idx(no_elements)
+    { }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Insert a node (in descending order of uids).
+    ///
+    /// \returns Whether no node with the same children has been inserted
+    ///          before, i.e. whether `n` is not removed by Reduction Rule 2.
+    ////////////////////////////////////////////////////////////////////////////
+    bool insert(const node &n)
+    {
+      adiar_assert(_size < _old_uids.size(), "Must be instantiated with enough space");
+      adiar_assert(_size == 0u || n.uid() < _old_uids[_size-1],
+                   "Nodes are inserted in descending order");
+
+      const node::pointer_type n_low  = unflag(n.low());
+      const node::pointer_type n_high = unflag(n.high());
+
+      const size_t mask = _slots.size() - 1u;
+      size_t slot = _hash(n) & mask;
+
+      while (_slots[slot] != empty_slot) {
+        const node &m = _unique[_slots[slot] - 1u];
+        if (unflag(m.low()) == n_low && unflag(m.high()) == n_high) {
+          _old_uids[_size] = n.uid();
+          _unique_idx[_size] = _slots[slot] - 1u;
+          _size += 1u;
+          return false;
+        }
+        slot = (slot + 1u) & mask;
+      }
+
+      _unique[_unique_size] = n;
+      _slots[slot] = ++_unique_size;
+
+      _old_uids[_size] = n.uid();
+      _unique_idx[_size] = _unique_size - 1u;
+      _size += 1u;
+      return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the unique nodes in the canonical order.
+    ////////////////////////////////////////////////////////////////////////////
+    void sort()
+    {
+      for (index_type i = 0u; i < _unique_size; ++i) { _slots[i] = i; }
+
+      tpie::parallel_sort(_slots.begin(), _slots.begin() + _unique_size,
+                          [this](const index_type a, const index_type b) {
+                            return this->_lt(this->_unique[a], this->_unique[b]);
+                          });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of unique nodes.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t unique_size() const
+    { return _unique_size; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The `i`th unique node in the canonical order (with the flags of
+    ///        its first occurrence).
+    ////////////////////////////////////////////////////////////////////////////
+    const node& unique(const size_t i) const
+    {
+      adiar_assert(i < _unique_size);
+      return _unique[_slots[i]];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Replace the `i`th unique node in the canonical order with its
+    ///        reduced output.
+    ////////////////////////////////////////////////////////////////////////////
+    void set_unique(const size_t i, const node &n)
+    {
+      adiar_assert(i < _unique_size);
+      _unique[_slots[i]] = n;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether there are more mappings to pull.
+    ////////////////////////////////////////////////////////////////////////////
+    bool can_pull() const
+    { return _front_idx < _size; }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Pull the next mapping (in descending order of the old uid).
+    ////////////////////////////////////////////////////////////////////////////
+    mapping pull()
+    {
+      adiar_assert(can_pull());
+      const mapping ret = { _old_uids[_front_idx], _unique[_unique_idx[_front_idx]].uid() };
+      _front_idx += 1u;
+      return ret;
     }
   };
 
@@ -250,6 +460,188 @@ namespace adiar::internal
                            node_writer &out_writer,
                            const bool terminal_val);
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Merge the Reduction Rule 1 and 2 mappings of a level and forward
+  ///        them to the parents in the priority queue.
+  ///
+  /// \returns The terminal value of the last Reduction Rule 1 mapping (if any)
+  ///
+  /// \see __reduce_level
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename arc_stream_t,
+            typename pq_t,
+            typename red2_t>
+  inline bool
+  __reduce_level__forward(arc_stream_t &arcs,
+                          pq_t &reduce_pq,
+                          tpie::file_stream<mapping> &red1_mapping,
+                          red2_t &red2_mapping)
+  {
+    // Merging of red1_mapping and red2_mapping
+    mapping next_red1 = { node::uid_type(), node::uid_type() }; // <-- dummy value
+    bool has_next_red1 = red1_mapping.is_open() && red1_mapping.size() > 0;
+    if (has_next_red1) {
+      red1_mapping.seek(0);
+      next_red1 = red1_mapping.read();
+    }
+
+    mapping next_red2 = { node::uid_type(), node::uid_type() }; // <-- dummy value
+    bool has_next_red2 = red2_mapping.can_pull();
+    if (has_next_red2) {
+      next_red2 = red2_mapping.pull();
+    }
+
+    // Pass all the mappings to Q
+    while (has_next_red1 || has_next_red2) {
+      // Find the mapping with largest old_uid
+      const bool is_red1_current = !has_next_red2
+        || (has_next_red1 && next_red1.old_uid > next_red2.old_uid);
+
+      const mapping current_map = is_red1_current ? next_red1 : next_red2;
+
+      adiar_assert(!arcs.can_pull_internal()
+                   || current_map.old_uid == arcs.peek_internal().target(),
+                   "Mapping forwarded in sync with internal arcs");
+
+      // Find all arcs that have the target that match the current mapping's old_uid
+      while (arcs.can_pull_internal() && current_map.old_uid == arcs.peek_internal().target()) {
+        // The out_idx is included in arc.source() pulled from the internal arcs.
+        const ptr_uint64 s = arcs.pull_internal().source();
+
+        // If Reduction Rule 1 was used, then tell the parents to add to the global cut.
+        const ptr_uint64 t = is_red1_current
+          ? flag(current_map.new_uid)
+          : static_cast<ptr_uint64>(current_map.new_uid);
+
+        adiar_assert(t.is_terminal() || t.out_idx() == false, "Created target is without an index");
+        reduce_pq.push(arc(s,t));
+      }
+
+      // Update the mapping that was used
+      if (is_red1_current) {
+        has_next_red1 = red1_mapping.can_read();
+        if (has_next_red1) {
+          next_red1 = red1_mapping.read();
+        }
+      } else {
+        has_next_red2 = red2_mapping.can_pull();
+        if (has_next_red2) {
+          next_red2 = red2_mapping.pull();
+        }
+      }
+    }
+
+    return next_red1.new_uid.is_terminal() && next_red1.new_uid.value();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Reduce a single level with Reduction Rule 2 applied via hashing
+  ///        in internal memory.
+  ///
+  /// \details Produces the very same output as `__reduce_level` but only the
+  ///          unique nodes need to be sorted.
+  ///
+  /// \returns width of output level
+  ///
+  /// \see reduce_rule2_table
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename dd_policy,
+            typename pq_t,
+            typename arc_stream_t>
+  size_t
+  __reduce_level__hash(arc_stream_t &arcs,
+                       const typename dd_policy::label_type label,
+                       pq_t &reduce_pq,
+                       node_writer &out_writer,
+                       const size_t unreduced_width)
+  {
+    // Temporary file for Reduction Rule 1 mappings (opened later if need be)
+    tpie::file_stream<mapping> red1_mapping;
+
+    // Hash table to find Reduction Rule 2 mappings
+    reduce_rule2_table red2_mapping(unreduced_width);
+
+    // Pull out all nodes from reduce_pq and terminal_arcs for this level
+    while ((arcs.can_pull_terminal() && arcs.peek_terminal().source().label() == label)
+            || reduce_pq.can_pull()) {
+      const arc e_high = __reduce_get_next(reduce_pq, arcs);
+      const arc e_low  = __reduce_get_next(reduce_pq, arcs);
+
+      const node n = node_of(e_low, e_high);
+      adiar_assert(n.label() == label, "Label is for desired level");
+
+      // Apply Reduction rule 1
+      const node::pointer_type reduction_rule_ret = dd_policy::reduction_rule(n);
+      if (reduction_rule_ret != n.uid()) {
+        if (!red1_mapping.is_open()) { red1_mapping.open(); }
+#ifdef ADIAR_STATS
+        stats_reduce.removed_by_rule_1 += 1u;
+#endif
+        red1_mapping.write({ n.uid(), reduction_rule_ret });
+      } else if (!red2_mapping.insert(n)) {
+        // Apply Reduction rule 2
+#ifdef ADIAR_STATS
+        stats_reduce.removed_by_rule_2 += 1u;
+#endif
+      }
+    }
+
+    // Count number of arcs that cross this level
+    cuts_t local_1level_cut   = {{ 0u, 0u, 0u, 0u }};
+    cuts_t tainted_1level_cut = {{ 0u, 0u, 0u, 0u }};
+
+    __reduce_cut_add(local_1level_cut,
+                     reduce_pq.size_without_terminals(),
+                     reduce_pq.terminals(false) + arcs.unread_terminals(false),
+                     reduce_pq.terminals(true) + arcs.unread_terminals(true));
+
+    // Sort the unique nodes and output them in canonical order
+    red2_mapping.sort();
+
+    typename dd_policy::id_type out_id = dd_policy::max_id;
+
+    for (size_t i = 0u; i < red2_mapping.unique_size(); ++i) {
+      const node next_node = red2_mapping.unique(i);
+
+      adiar_assert(0 <= out_id, "Should still have more ids left");
+      const node out_node = node(label, out_id--, unflag(next_node.low()), unflag(next_node.high()));
+      out_writer.unsafe_push(out_node);
+
+      __reduce_cut_add(next_node.low().is_flagged()  ? tainted_1level_cut : local_1level_cut,
+                       out_node.low());
+      __reduce_cut_add(next_node.high().is_flagged() ? tainted_1level_cut : local_1level_cut,
+                       out_node.high());
+
+      red2_mapping.set_unique(i, out_node);
+    }
+
+    // Add number of nodes to level information, if any nodes were pushed to the output.
+    const size_t reduced_width = dd_policy::max_id - out_id;
+    if (reduced_width > 0) {
+      out_writer.unsafe_push(level_info(label, reduced_width));
+    }
+
+    // Forward all mappings to the parents in Q
+    const bool terminal_value =
+      __reduce_level__forward<>(arcs, reduce_pq, red1_mapping, red2_mapping);
+
+    // Move on to the next level
+    red1_mapping.close();
+
+    // Update with new possible maximum 1-level cut (the one below the current level)
+    out_writer.unsafe_max_1level_cut(local_1level_cut);
+
+    // Add the tainted edges
+    out_writer.unsafe_inc_1level_cut(tainted_1level_cut);
+
+    __reduce_level__epilogue<>(arcs, label, reduce_pq, out_writer, terminal_value);
+
+    adiar_assert(reduced_width <= unreduced_width,
+                 "Reduction should only ever remove nodes");
+
+    return reduced_width;
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Reduce a single level
   ///
@@ -350,59 +742,9 @@ namespace adiar::internal
     // Sort mappings for Reduction rule 2 back in order of arcs.internal
     red2_mapping.sort();
 
-    // Merging of red1_mapping and red2_mapping
-    mapping next_red1 = { node::uid_type(), node::uid_type() }; // <-- dummy value
-    bool has_next_red1 = red1_mapping.is_open() && red1_mapping.size() > 0;
-    if (has_next_red1) {
-      red1_mapping.seek(0);
-      next_red1 = red1_mapping.read();
-    }
-
-    mapping next_red2 = { node::uid_type(), node::uid_type() }; // <-- dummy value
-    bool has_next_red2 = red2_mapping.can_pull();
-    if (has_next_red2) {
-      next_red2 = red2_mapping.pull();
-    }
-
-    // Pass all the mappings to Q
-    while (has_next_red1 || has_next_red2) {
-      // Find the mapping with largest old_uid
-      const bool is_red1_current = !has_next_red2
-        || (has_next_red1 && next_red1.old_uid > next_red2.old_uid);
-
-      const mapping current_map = is_red1_current ? next_red1 : next_red2;
-
-      adiar_assert(!arcs.can_pull_internal()
-                   || current_map.old_uid == arcs.peek_internal().target(),
-                   "Mapping forwarded in sync with internal arcs");
-
-      // Find all arcs that have the target that match the current mapping's old_uid
-      while (arcs.can_pull_internal() && current_map.old_uid == arcs.peek_internal().target()) {
-        // The out_idx is included in arc.source() pulled from the internal arcs.
-        const ptr_uint64 s = arcs.pull_internal().source();
-
-        // If Reduction Rule 1 was used, then tell the parents to add to the global cut.
-        const ptr_uint64 t = is_red1_current
-          ? flag(current_map.new_uid)
-          : static_cast<ptr_uint64>(current_map.new_uid);
-
-        adiar_assert(t.is_terminal() || t.out_idx() == false, "Created target is without an index");
-        reduce_pq.push(arc(s,t));
-      }
-
-      // Update the mapping that was used
-      if (is_red1_current) {
-        has_next_red1 = red1_mapping.can_read();
-        if (has_next_red1) {
-          next_red1 = red1_mapping.read();
-        }
-      } else {
-        has_next_red2 = red2_mapping.can_pull();
-        if (has_next_red2) {
-          next_red2 = red2_mapping.pull();
-        }
-      }
-    }
+    // Forward all mappings to the parents in Q
+    const bool terminal_value =
+      __reduce_level__forward<>(arcs, reduce_pq, red1_mapping, red2_mapping);
 
     // Move on to the next level
     red1_mapping.close();
@@ -413,7 +755,6 @@ namespace adiar::internal
     // Add the tainted edges
     out_writer.unsafe_inc_1level_cut(tainted_1level_cut);
 
-    const bool terminal_value = next_red1.new_uid.is_terminal() && next_red1.new_uid.value();
     __reduce_level__epilogue<>(arcs, label, reduce_pq, out_writer, terminal_value);
 
     adiar_assert(reduced_width <= unreduced_width,
@@ -483,7 +824,8 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////
   template<typename dd_policy, typename pq_t>
   shared_levelized_file<typename dd_policy::node_type>
-  __reduce(const shared_levelized_file<arc> &in_file,
+  __reduce(const exec_policy &ep,
+           const shared_levelized_file<arc> &in_file,
            const size_t lpq_memory,
            const size_t sorters_memory)
   {
@@ -548,6 +890,7 @@ namespace adiar::internal
     // Initialize (levelized) priority queue and run Reduce algorithm
     pq_t reduce_pq({in_file}, lpq_memory, in_file->max_1level_cut);
 
+    const size_t internal_hash_can_fit = reduce_rule2_table::memory_fits(sorters_memory);
     const size_t internal_sorter_can_fit = internal_sorter<node>::memory_fits(sorters_memory / 2);
 
     // Process bottom-up each level
@@ -560,8 +903,13 @@ namespace adiar::internal
       adiar_assert(!reduce_pq.has_current_level() || level == reduce_pq.current_level(),
                    "level and priority queue should be in sync");
 
+      level_checkpoint(ep, level, reduce_pq.size(), out_writer.size() * sizeof(node));
+
       const size_t unreduced_width = current_level_info.width();
-      if(unreduced_width <= internal_sorter_can_fit) {
+      if(unreduced_width <= internal_hash_can_fit) {
+        __reduce_level__hash<dd_policy>
+          (arcs, level, reduce_pq, out_writer, unreduced_width);
+      } else if(unreduced_width <= internal_sorter_can_fit) {
         __reduce_level<dd_policy, internal_sorter>
           (arcs, level, reduce_pq, out_writer, sorters_memory, unreduced_width);
       } else {
@@ -602,7 +950,7 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const size_t aux_available_memory = memory_available()
+    const size_t aux_available_memory = memory_available(input._policy)
       // Input streams
       - arc_stream<>::memory_usage()
       - level_info_stream<>::memory_usage()
@@ -627,19 +975,19 @@ namespace adiar::internal
       stats_reduce.lpq.unbucketed += 1u;
 #endif
       return __reduce<dd_policy, reduce_priority_queue<0, memory_mode::Internal>>
-        (in_file, pq_memory, sorters_memory);
+        (input._policy, in_file, pq_memory, sorters_memory);
     } else if(!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_reduce.lpq.internal += 1u;
 #endif
       return __reduce<dd_policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>
-        (in_file, pq_memory, sorters_memory);
+        (input._policy, in_file, pq_memory, sorters_memory);
     } else {
 #ifdef ADIAR_STATS
       stats_reduce.lpq.external += 1u;
 #endif
       return __reduce<dd_policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>
-        (in_file, pq_memory, sorters_memory);
+        (input._policy, in_file, pq_memory, sorters_memory);
     }
   }
 }
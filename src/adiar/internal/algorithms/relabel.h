@@ -0,0 +1,57 @@
+#ifndef ADIAR_INTERNAL_ALGORITHMS_RELABEL_H
+#define ADIAR_INTERNAL_ALGORITHMS_RELABEL_H
+
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/node_stream.h>
+#include <adiar/internal/io/node_writer.h>
+#include <adiar/internal/io/shared_file_ptr.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //  Relabel Algorithm
+  // ===================
+  //
+  // Replaces every label of a Decision Diagram with another one. If the
+  // mapping is strictly monotone, then the order of all levels (and of all
+  // nodes within them) is kept. Hence, the new file can be written while
+  // reading the old one in a single linear scan.
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Copy of `dd` where every label `x` is replaced by `m(x)`.
+  ///
+  /// \pre `m` is strictly monotone on the levels of `dd` and does not produce
+  ///      a label larger than `DdPolicy::max_label`.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy, typename LabelMap>
+  typename DdPolicy::dd_type
+  relabel(const typename DdPolicy::dd_type &dd, const LabelMap &m)
+  {
+    using node_type    = typename DdPolicy::node_type;
+    using pointer_type = typename DdPolicy::pointer_type;
+
+    if (dd_isterminal(dd)) { return dd; }
+
+    const auto relabel_ptr = [&m](const pointer_type &p) {
+      return p.is_terminal() ? p : pointer_type(m(p.label()), p.id());
+    };
+
+    shared_levelized_file<node_type> nf;
+    {
+      node_writer nw(nf);
+      node_stream<true> ns(dd);
+
+      while (ns.can_pull()) {
+        const node_type n = ns.pull();
+        nw.push(node_type(m(n.label()), n.id(),
+                          relabel_ptr(n.low()),
+                          relabel_ptr(n.high())));
+      }
+    }
+    return typename DdPolicy::dd_type(nf);
+  }
+}
+
+#endif // ADIAR_INTERNAL_ALGORITHMS_RELABEL_H
@@ -6,6 +6,7 @@
 #include <adiar/exec_policy.h>
 #include <adiar/types.h>
 
+#include <adiar/internal/checkpoint.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/dd.h>
@@ -112,6 +113,8 @@ namespace adiar::internal
       const typename SelectPolicy::label_type level = select_pq.current_level();
       typename SelectPolicy::id_type level_size = 0;
 
+      level_checkpoint(ep, level, select_pq.size(), aw);
+
       const assignment a = amgr.assignment_for_level(level);
 
       // Update max 1-level cut
@@ -203,7 +206,7 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
-    const tpie::memory_size_type aux_available_memory = memory_available()
+    const tpie::memory_size_type aux_available_memory = memory_available(ep)
       - node_stream<>::memory_usage() - arc_writer::memory_usage();
 
     const tpie::memory_size_type pq_memory_fits =
@@ -4,7 +4,9 @@
 #include <adiar/internal/assert.h>
 #include <adiar/internal/dd.h>
 #include <adiar/internal/data_types/uid.h>
+#include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/levelized_file_stream.h>
 #include <adiar/internal/io/node_file.h>
 #include <adiar/internal/io/node_stream.h>
 
@@ -18,10 +20,73 @@ namespace adiar::internal
   // follow along and pick whereto go.
   //////////////////////////////////////////////////////////////////////////////
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Traversal of a canonical Decision Diagram, seeking directly to each
+  ///        visited node.
+  ///
+  /// \details In a canonical file, the nodes of each level have consecutive
+  ///          identifiers from `max_id` downwards. Hence, the index of a node
+  ///          within the file is derived from its level's offset, which in turn
+  ///          is derived from the widths in the (much smaller) level
+  ///          information. This reads only O(L/B + D) blocks rather than the
+  ///          entire file, where L is the number of levels and D is the length
+  ///          of the traversed path.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Dd, typename Visitor>
+  void __traverse_seek(const Dd &dd, Visitor &visitor)
+  {
+    node_stream<> in_nodes(dd);
+    level_info_stream<> in_levels(dd);
+
+    // Number of nodes in the file and on the levels above 'curr_level'.
+    const size_t nodes = dd->size();
+    size_t nodes_above = 0u;
+
+    level_info curr_level = in_levels.pull();
+
+    typename Dd::node_type n      = in_nodes.pull();
+    typename Dd::pointer_type tgt = n.uid();
+
+    while (!tgt.is_terminal() && !tgt.is_nil()) {
+      if (n.uid() != tgt) {
+        // Move the level index forward to the target's level
+        while (curr_level.level() < tgt.label()) {
+          nodes_above += curr_level.width();
+          curr_level = in_levels.pull();
+        }
+
+        adiar_assert(curr_level.level() == tgt.label(),
+                     "Invalid uid chasing; fell out of Decision Diagram");
+
+        // Nodes of a level are stored from 'max_id' downwards.
+        const size_t level_offset = nodes - nodes_above - curr_level.width();
+        in_nodes.seek_index(level_offset + (Dd::pointer_type::max_id - tgt.id()));
+
+        n = in_nodes.pull();
+      }
+
+      adiar_assert(n.uid() == tgt,
+                   "Invalid uid chasing; fell out of Decision Diagram");
+
+      tgt = visitor.visit(n);
+
+      adiar_assert((tgt == n.low()) || (tgt == n.high()) || (tgt.is_nil()),
+                   "Visitor pointer should be a child or nil");
+    }
+    if (!tgt.is_nil()) {
+      visitor.visit(tgt.value());
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   template<typename Dd, typename Visitor>
   void traverse(const Dd &dd, Visitor &visitor)
   {
+    if (dd->canonical && !dd->is_terminal()) {
+      __traverse_seek(dd, visitor);
+      return;
+    }
+
     node_stream<> in_nodes(dd);
 
     typename Dd::node_type n      = in_nodes.pull();
@@ -0,0 +1,74 @@
+#ifndef ADIAR_INTERNAL_CHECKPOINT_H
+#define ADIAR_INTERNAL_CHECKPOINT_H
+
+#include <cstddef>
+#include <string>
+
+#include <adiar/exception.h>
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/data_types/arc.h>
+#include <adiar/internal/io/arc_writer.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Checkpoint in-between two levels of a sweep: report the progress
+  ///        and abort if the operation has been cancelled or its deadline has
+  ///        passed.
+  ///
+  /// \param ep      Execution policy of the operation.
+  ///
+  /// \param level   The level the sweep moves on to.
+  ///
+  /// \param pq_size Number of elements in the sweep's levelized priority queue.
+  ///
+  /// \param bytes   Number of bytes written to the sweep's output.
+  ///
+  /// \throws operation_cancelled If the cancellation token of `ep` has been
+  ///                             cancelled.
+  ///
+  /// \throws deadline_exceeded   If the deadline of `ep` has passed.
+  //////////////////////////////////////////////////////////////////////////////
+  inline void
+  level_checkpoint(const exec_policy &ep,
+                   const size_t level,
+                   const size_t pq_size,
+                   const size_t bytes)
+  {
+    if (ep.cancellation_token().is_cancelled()) {
+      throw operation_cancelled("Operation was cancelled at level "
+                                + std::to_string(level));
+    }
+    if (ep.time_limit().has_passed()) {
+      throw deadline_exceeded("Operation passed its deadline at level "
+                              + std::to_string(level));
+    }
+    ep.progress_callback()(level, pq_size, bytes);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Checkpoint in-between two levels of a sweep that outputs arcs. On
+  ///        top of the above, the operation is also aborted if it has output
+  ///        more arcs than its budget allows.
+  ///
+  /// \throws arc_budget_exceeded If more arcs have been written to `aw` than
+  ///                             the arc budget of `ep`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline void
+  level_checkpoint(const exec_policy &ep,
+                   const size_t level,
+                   const size_t pq_size,
+                   const arc_writer &aw)
+  {
+    const size_t arcs = aw.size();
+    if (ep.arc_limit().arcs() < arcs) {
+      throw arc_budget_exceeded("Operation output "
+                                + std::to_string(arcs) + " arcs before level "
+                                + std::to_string(level));
+    }
+    level_checkpoint(ep, level, pq_size, arcs * sizeof(arc));
+  }
+}
+
+#endif // ADIAR_INTERNAL_CHECKPOINT_H
@@ -111,6 +111,27 @@ namespace adiar::internal
       return min_level;
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the width of the next level, i.e. the sum of its width in
+    ///        each file. This is 0, if the files do not provide any widths.
+    ///
+    /// \pre `can_pull() == true`
+    ////////////////////////////////////////////////////////////////////////////
+    size_t peek_width()
+    {
+      adiar_assert(can_pull(), "Cannot peek past end of all streams");
+
+      const level_type min_level = peek();
+
+      size_t width = 0u;
+      for (const unique_ptr<stream_t> &level_info_stream : _level_streams) {
+        if (level_info_stream->can_pull() && level_of(level_info_stream->peek()) == min_level) {
+          width += width_of(level_info_stream->peek());
+        }
+      }
+      return width;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Obtain the next level and go to the next.
     ///
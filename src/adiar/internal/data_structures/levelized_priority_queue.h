@@ -1,16 +1,21 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
 
+#include <algorithm>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/dd.h>
 #include <adiar/internal/memory.h>
 #include <adiar/internal/data_structures/level_merger.h>
 #include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_structures/radix_heap.h>
 #include <adiar/internal/data_structures/sorter.h>
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/io/temp_dir.h>
 #include <adiar/statistics.h>
 
 namespace adiar::internal
@@ -47,11 +52,17 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////
   /// The preprocessor variable ADIAR_LPQ_LOOKAHEAD can be used to change the
-  /// number of buckets used by the levelized priority queue (if the number of
-  /// elements are larger than the `no_lookahead_bound`).
+  /// (maximum) number of buckets used by the levelized priority queue (if the
+  /// number of elements are larger than the `no_lookahead_bound`).
+  ///
+  /// The queue uses between two and `LookAhead + 1` buckets depending on the
+  /// width of the upcoming levels (and, in internal memory, on how many buckets
+  /// the given memory can hold). Since the memory is only computed for the
+  /// read-only and one pushable bucket, a larger maximum does not cost anything
+  /// when its buckets are not used.
   //////////////////////////////////////////////////////////////////////////////
 #ifndef ADIAR_LPQ_LOOKAHEAD
-#define ADIAR_LPQ_LOOKAHEAD 1u
+#define ADIAR_LPQ_LOOKAHEAD 4u
 #endif
 
   //////////////////////////////////////////////////////////////////////////////
@@ -79,8 +90,9 @@ namespace adiar::internal
   /// \tparam Comp Sorting comparator to use in the inner queue buckets
   ///                      and for merging
   ///
-  /// \tparam LookAhead   The number of levels (ahead of the current)
-  ///                      explicitly handle with a sorting algorithm
+  /// \tparam LookAhead   The maximum number of levels (ahead of the current)
+  ///                      explicitly handle with a sorting algorithm. Fewer
+  ///                      levels are used, if the upcoming levels are wide.
   ///
   /// \tparam LevelFile Type of the files to obtain the relevant levels from
   ///
@@ -131,9 +143,13 @@ namespace adiar::internal
     using sorter_t = sorter<mem_mode, value_type, value_comp_type>;
 
     ////////////////////////////////////////////////////////////////////////////
-    /// \brief Type of the overflow priority queue.
+    /// \brief Type of the overflow priority queue. In internal memory, this
+    ///        exploits that levels are only pushed to in increasing order.
     ////////////////////////////////////////////////////////////////////////////
-    using priority_queue_t = priority_queue<MemoryMode, value_type, value_comp_type>;
+    using priority_queue_t =
+      std::conditional_t<MemoryMode == memory_mode::Internal,
+                         radix_heap<value_type, value_comp_type, LevelFileComp>,
+                         priority_queue<MemoryMode, value_type, value_comp_type>>;
 
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the level merger.
@@ -142,10 +158,16 @@ namespace adiar::internal
 
   public:
     ////////////////////////////////////////////////////////////////////////////
-    /// \brief Number of buckets.
+    /// \brief Maximum number of buckets.
     ////////////////////////////////////////////////////////////////////////////
     static constexpr size_t buckets = LookAhead + 1;
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimum number of buckets, i.e. the read-only and one pushable
+    ///        bucket. The memory is only computed for these.
+    ////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t min_buckets = 2u;
+
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Index for no bucket.
     ////////////////////////////////////////////////////////////////////////////
@@ -156,7 +178,7 @@ namespace adiar::internal
     /// \brief Total number of data structures in Levelized Priority Queue.
     ////////////////////////////////////////////////////////////////////////////
     static constexpr size_t data_structures =
-      buckets * sorter_t::data_structures + priority_queue_t::data_structures;
+      min_buckets * sorter_t::data_structures + priority_queue_t::data_structures;
 
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Value to reflect 'out of levels'.
@@ -188,8 +210,8 @@ namespace adiar::internal
   public:
     static tpie::memory_size_type memory_usage(tpie::memory_size_type no_elements)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_usage(no_elements)
-        + buckets * sorter<memory_mode::Internal, value_type, value_comp_type>::memory_usage(no_elements)
+      return radix_heap<value_type, value_comp_type, LevelFileComp>::memory_usage(no_elements)
+        + min_buckets * sorter<memory_mode::Internal, value_type, value_comp_type>::memory_usage(no_elements)
         + const_memory_usage();
     }
 
@@ -208,7 +230,7 @@ namespace adiar::internal
       const size_t sorter_fits = sorter<memory_mode::Internal, value_type, value_comp_type>
         ::memory_fits(memory_per_data_structure);
 
-      const size_t priority_queue_fits = priority_queue<memory_mode::Internal, value_type, value_comp_type>
+      const size_t priority_queue_fits = radix_heap<value_type, value_comp_type, LevelFileComp>
         ::memory_fits(memory_per_data_structure);
 
       const size_t res = std::min(sorter_fits, priority_queue_fits);
@@ -283,14 +305,43 @@ namespace adiar::internal
     level_merger_t _level_merger;
 
     ////////////////////////////////////////////////////////////////////////////
-    /// \brief Level of each bucket.
+    /// \brief Maximum number of buckets the given memory can hold (at most
+    ///        `buckets`).
+    ///
+    /// \see levelized_priority_queue::max_buckets
+    ////////////////////////////////////////////////////////////////////////////
+    const size_t _buckets_max;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Accumulated width of levels above which the circular array of
+    ///        buckets is not extended with another level.
+    ///
+    /// \see levelized_priority_queue::extend_buckets
+    ////////////////////////////////////////////////////////////////////////////
+    const size_t _buckets_max_width;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of buckets currently used in the circular array, i.e. its
+    ///        size (at most `_buckets_max`). The memory for the buckets is
+    ///        shared between only these.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t _buckets_used = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Level of each bucket in the circular array.
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<ptr_uint64::label_type> _buckets_level;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Width of the level of each bucket in the circular array (0 if
+    ///        unknown).
     ////////////////////////////////////////////////////////////////////////////
-    ptr_uint64::label_type _buckets_level [buckets];
+    std::vector<size_t> _buckets_width;
 
     ////////////////////////////////////////////////////////////////////////////
-    /// \brief Sorter for each bucket.
+    /// \brief Sorter for each bucket in the circular array.
     ////////////////////////////////////////////////////////////////////////////
-    unique_ptr<sorter_t> _buckets_sorter [buckets];
+    std::vector<unique_ptr<sorter_t>> _buckets_sorter;
 
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Index of the currently read-from bucket (if any).
@@ -325,12 +376,14 @@ namespace adiar::internal
     /// \brief The actual maximum size of the levelized priority queue.
     ////////////////////////////////////////////////////////////////////////////
     size_t _actual_max_size = 0u;
+#endif
 
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Reference to struct to store non-global stats into.
+    ///
+    /// \remark The disk usage is recorded in here also without `ADIAR_STATS`.
     ////////////////////////////////////////////////////////////////////////////
     statistics::levelized_priority_queue_t &_stats;
-#endif
 
   private:
     static tpie::memory_size_type mem_overflow_queue(tpie::memory_size_type memory_given)
@@ -355,12 +408,12 @@ namespace adiar::internal
       } else if constexpr (mem_mode == memory_mode::External) {
         // ---------------------------------------------------------------------
         // EXTERNAL MEMORY MODE:
-        //   Use 1/(4Buckets + 1)th of the memory and at least 8 MiB.
+        //   Use 1/(4MinBuckets + 1)th of the memory and at least 8 MiB.
 
         // LCOV_EXCL_START
         // TODO: Unit test external memory variants?
         const tpie::memory_size_type eight_MiB = 8 * 1024;
-        const tpie::memory_size_type weighted_share = memory_given / (4 * buckets + 1);
+        const tpie::memory_size_type weighted_share = memory_given / (4 * min_buckets + 1);
 
         return std::max(eight_MiB, weighted_share);
         // LCOV_EXCL_STOP
@@ -371,16 +424,36 @@ namespace adiar::internal
       }
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum number of buckets to share the given memory.
+    ///
+    /// \details In internal memory, each bucket is an array of `max_size`
+    ///          elements. Hence, only as many buckets are used as fit into the
+    ///          memory (but always the minimum). In external memory, the
+    ///          buckets merely get a smaller share of it.
+    ////////////////////////////////////////////////////////////////////////////
+    static size_t max_buckets(tpie::memory_size_type memory_for_buckets, size_t max_size)
+    {
+      if constexpr (mem_mode == memory_mode::Internal) {
+        const tpie::memory_size_type bucket_memory = sorter_t::memory_usage(max_size);
+        if (bucket_memory == 0u) { return buckets; }
+
+        return std::clamp<size_t>(memory_for_buckets / bucket_memory, min_buckets, buckets);
+      } else {
+        return buckets;
+      }
+    }
+
     levelized_priority_queue(tpie::memory_size_type memory_given, size_t max_size,
-                             [[maybe_unused]] statistics::levelized_priority_queue_t &stats)
+                             statistics::levelized_priority_queue_t &stats)
       : _max_size(max_size)
       , _memory_given(memory_given)
       , _memory_for_buckets(memory_given - _memory_occupied_by_merger - mem_overflow_queue(memory_given))
       , _memory_occupied_by_overflow(mem_overflow_queue(memory_given))
+      , _buckets_max(max_buckets(_memory_for_buckets, max_size))
+      , _buckets_max_width(std::max<size_t>(1u, max_size / _buckets_max))
       , _overflow_queue(mem_overflow_queue(memory_given), max_size)
-#ifdef ADIAR_STATS
       , _stats(stats)
-#endif
     {
       adiar_assert(_memory_occupied_by_merger + _memory_for_buckets + _memory_occupied_by_overflow <= _memory_given,
                    "the amount of memory used should be within the given bounds");
@@ -454,9 +527,12 @@ namespace adiar::internal
         _level_merger.pull();
       }
 
-      // Set up buckets until no levels are left or all buckets have been
-      // instantiated. Notice, that _back_bucket_idx was initialised to -1.
-      while (_back_bucket_idx + 1 < buckets && _level_merger.can_pull()) {
+      // Set up buckets until no levels are left, all buckets have been
+      // instantiated, or the levels are too wide. Notice, that _back_bucket_idx
+      // was initialised to -1.
+      size_t width = 0u;
+      while (_back_bucket_idx + 1 < _buckets_max && _level_merger.can_pull() && extend_buckets(width)) {
+        const size_t level_width = _level_merger.peek_width();
         const ptr_uint64::label_type level = _level_merger.pull();
 
         adiar_assert(_front_bucket_idx == out_of_buckets_idx,
@@ -464,11 +540,71 @@ namespace adiar::internal
 
         _back_bucket_idx++;
 
-        _buckets_level[_back_bucket_idx] = level;
-        _buckets_sorter[_back_bucket_idx] = sorter_t::make_unique(_memory_for_buckets, _max_size, buckets);
+        _buckets_level.push_back(level);
+        _buckets_width.push_back(level_width);
+        width += level_width;
+      }
+      _buckets_used = used_buckets();
+
+      _buckets_level.resize(_buckets_used);
+      _buckets_width.resize(_buckets_used);
+      _buckets_sorter.resize(_buckets_used);
+
+      // Only now that the size of the circular array is known, can its buckets
+      // be given their share of the memory.
+      for (size_t idx = 0; _back_bucket_idx != out_of_buckets_idx && idx <= _back_bucket_idx; idx++) {
+        _buckets_sorter[idx] = sorter_t::make_unique(_memory_for_buckets, _max_size, _buckets_used);
       }
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Whether the circular array of buckets (currently up to
+    ///          `_back_bucket_idx`) should include yet another level, given the
+    ///          accumulated `width` of the levels in it so far (including the
+    ///          ones kept when relabelling).
+    ///
+    /// \details If the upcoming levels are narrow, then elements are spread
+    ///          across many of them and each bucket saves pushes to the
+    ///          overflow queue. If they are wide, then most elements go to the
+    ///          next few levels; more buckets then only slow down every push
+    ///          to the overflow queue and need to be sorted (and reset) for
+    ///          each level.
+    ///
+    /// \remark  There is always at least one bucket to push to in addition to
+    ///          the read-only one. Levels without any width information are
+    ///          always bucketed. Hence, the circular array only adapts (both
+    ///          shrinking and growing again) if `LookAhead` is larger than one.
+    ////////////////////////////////////////////////////////////////////////////
+    bool extend_buckets(const size_t width) const
+    {
+      return _back_bucket_idx + 1 < 2u || width < _buckets_max_width;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Size of the circular array after (re)initialising its buckets up
+    ///        to `_back_bucket_idx`.
+    ///
+    /// \details If it has stopped early due to `extend_buckets`, then the
+    ///          circular array only spans the buckets up to `_back_bucket_idx`.
+    ///          Otherwise, all buckets are used (if there are levels left).
+    ////////////////////////////////////////////////////////////////////////////
+    size_t used_buckets()
+    {
+      return _back_bucket_idx + 1 < _buckets_max && _level_merger.can_pull()
+        ? _back_bucket_idx + 1
+        : _buckets_max;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of buckets currently used (at most `buckets`), including
+    ///        the read-only one.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t buckets_used() const
+    {
+      return _buckets_used;
+    }
+
   public:
     ~levelized_priority_queue()
     {
@@ -560,7 +696,7 @@ namespace adiar::internal
 
       ptr_uint64::label_type bucket_offset = 1u;
       do {
-        const ptr_uint64::label_type bucket_idx = (_front_bucket_idx + bucket_offset++) % buckets;
+        const ptr_uint64::label_type bucket_idx = (_front_bucket_idx + bucket_offset++) % _buckets_used;
 
         if (_buckets_level[bucket_idx] == level) {
           _buckets_sorter[bucket_idx] -> push(e);
@@ -598,8 +734,16 @@ namespace adiar::internal
       adiar_assert(stop_level != no_label || !empty(),
                    "Either a stop level is given or we have some non-empty level to forward to");
 
+      // Check the disk usage once per level. Sorting the next level may write
+      // (at most) all elements once more to disk.
+      const size_t disk = disk_check(mem_mode == memory_mode::External
+                                     ? disk_size<value_type>(_size)
+                                     : 0u);
+      disk_peak_update(stats_levelized_priority_queue.max_disk_usage, disk);
+      disk_peak_update(_stats.max_disk_usage, disk);
+
       const ptr_uint64::label_type overflow_level = !_overflow_queue.empty()
-        ? _overflow_queue.top().level()
+        ? _overflow_queue.top_level()
         : stop_level;
 
       stop_level = stop_level == no_label || level_cmp_lt<LevelFileComp>(overflow_level, stop_level, _level_comparator)
@@ -658,7 +802,7 @@ namespace adiar::internal
          && !_has_next_from_bucket
          // and the priority queue has nothing for this level?
          && (_overflow_queue.empty()
-             || current_level() != _overflow_queue.top().level() ) );
+             || current_level() != _overflow_queue.top_level() ) );
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -717,9 +861,11 @@ namespace adiar::internal
       adiar_assert(_size > 0, "pull on non-top element requires content");
       _size--;
 
-      // Merge bucket with overflow queue
-      if (_overflow_queue.empty() || (_has_next_from_bucket
-                                      && _v_comparator(_next_from_bucket, _overflow_queue.top()))) {
+      // Merge bucket with overflow queue (without obtaining an element from the
+      // overflow queue of a later level).
+      if (_overflow_queue.empty()
+          || current_level() != _overflow_queue.top_level()
+          || (_has_next_from_bucket && _v_comparator(_next_from_bucket, _overflow_queue.top()))) {
         const value_type ret = _next_from_bucket;
         if (_buckets_sorter[_front_bucket_idx] -> can_pull()) {
           _next_from_bucket = _buckets_sorter[_front_bucket_idx] -> pull();
@@ -785,7 +931,7 @@ namespace adiar::internal
 
       return _front_bucket_idx <= _back_bucket_idx
         ? (_back_bucket_idx - _front_bucket_idx) + 1
-        : (buckets - _front_bucket_idx) + _back_bucket_idx + 1;
+        : (_buckets_used - _front_bucket_idx) + _back_bucket_idx + 1;
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -804,7 +950,7 @@ namespace adiar::internal
       adiar_assert(has_next_bucket(),
                    "Cannot obtain level of non-existing next bucket");
 
-      const ptr_uint64::label_type next_idx   = (_front_bucket_idx + 1) % buckets;
+      const ptr_uint64::label_type next_idx   = (_front_bucket_idx + 1) % _buckets_used;
       const ptr_uint64::label_type next_level = _buckets_level[next_idx];
       return next_level;
     }
@@ -863,15 +1009,17 @@ namespace adiar::internal
 
         // Replace the current read-only bucket, if there is one
         if (_level_merger.can_pull() && has_front_bucket()) {
+          const size_t next_width = _level_merger.peek_width();
           const ptr_uint64::label_type next_level = _level_merger.pull();
 
           _buckets_level[_front_bucket_idx] = next_level;
+          _buckets_width[_front_bucket_idx] = next_width;
           sorter_t::reset_unique(_buckets_sorter[_front_bucket_idx],
-                                 _memory_for_buckets, _max_size, buckets);
+                                 _memory_for_buckets, _max_size, _buckets_used);
 
           _back_bucket_idx = _front_bucket_idx;
         }
-        _front_bucket_idx = (_front_bucket_idx + 1) % buckets;
+        _front_bucket_idx = (_front_bucket_idx + 1) % _buckets_used;
 
         adiar_assert(!has_next_bucket() || !has_front_bucket()
                      || level_cmp_lt<LevelFileComp>(front_bucket_level(), back_bucket_level(), _level_comparator),
@@ -920,51 +1068,80 @@ namespace adiar::internal
       const size_t old_front_bucket_idx = _front_bucket_idx;
       const size_t old_back_bucket_idx = _back_bucket_idx;
 
-      // Create a list of the new levels
-      ptr_uint64::label_type new_levels[buckets];
+      // Create a list of the new levels (and their widths)
+      std::vector<ptr_uint64::label_type> new_levels;
+      new_levels.reserve(_buckets_max);
+
+      std::vector<size_t> new_widths;
+      new_widths.reserve(_buckets_max);
+
       _back_bucket_idx = out_of_buckets_idx;
 
+      size_t width = 0u;
+
       // Copy over still relevant levels from current buckets
       do {
-        _front_bucket_idx = (_front_bucket_idx + 1) % buckets;
+        _front_bucket_idx = (_front_bucket_idx + 1) % _buckets_used;
 
         adiar_assert(has_front_bucket(), "After increment the front bucket will 'exist'");
 
         if (level_cmp_le<LevelFileComp>(front_bucket_level(), stop_level, _level_comparator)) {
           _current_level = front_bucket_level();
         } else { // level_cmp_lt<LevelFileComp>(stop_level, front_bucket_level(), _level_comparator)
-          new_levels[++_back_bucket_idx] = front_bucket_level();
+          ++_back_bucket_idx;
+          new_levels.push_back(front_bucket_level());
+          new_widths.push_back(_buckets_width[_front_bucket_idx]);
+          width += _buckets_width[_front_bucket_idx];
         }
       } while (_front_bucket_idx != old_back_bucket_idx);
 
       _front_bucket_idx = out_of_buckets_idx;
 
-      // Add as many levels from the level_merger as we can fit in
+      // Add as many levels from the level_merger as we can fit in (and as the
+      // width of the upcoming levels permit). This may change the size of the
+      // circular array.
       while (_level_merger.can_pull() && level_cmp_le<LevelFileComp>(_level_merger.peek(), stop_level, _level_comparator)) {
         _current_level = _level_merger.pull();
       }
 
-      while (_back_bucket_idx + 1 < buckets && _level_merger.can_pull()) {
-        new_levels[++_back_bucket_idx] = _level_merger.pull();
+      while (_back_bucket_idx + 1 < _buckets_max && _level_merger.can_pull() && extend_buckets(width)) {
+        ++_back_bucket_idx;
+        new_widths.push_back(_level_merger.peek_width());
+        new_levels.push_back(_level_merger.pull());
+        width += new_widths.back();
       }
 
-      adiar_assert(_back_bucket_idx == out_of_buckets_idx || _back_bucket_idx < buckets,
+      const size_t old_buckets_used = _buckets_used;
+      _buckets_used = used_buckets();
+
+      adiar_assert(_back_bucket_idx == out_of_buckets_idx || _back_bucket_idx < _buckets_used,
                    "_back_bucket_idx is a valid index");
 
       // Relabel all buckets
-      if (_back_bucket_idx != out_of_buckets_idx) {
-        for (size_t idx = 0; idx <= _back_bucket_idx; idx++) {
-          _buckets_level[idx] = new_levels[idx];
-        }
-
-        // Reset the prior read-only bucket, if relevant
-        if (old_front_bucket_idx <= _back_bucket_idx) {
-          sorter_t::reset_unique(_buckets_sorter[old_front_bucket_idx],
-                                 _memory_for_buckets, _max_size, buckets);
+      _buckets_level = std::move(new_levels);
+      _buckets_level.resize(_buckets_used);
+
+      _buckets_width = std::move(new_widths);
+      _buckets_width.resize(_buckets_used);
+
+      // If the size of the circular array has changed, then all buckets are
+      // (empty and) given a new share of the memory while the ones outside of
+      // it are released. Otherwise, only the prior read-only bucket needs to be
+      // reset (if relevant).
+      const bool buckets_resized = old_buckets_used != _buckets_used;
+      _buckets_sorter.resize(_buckets_used);
+
+      for (size_t idx = 0; idx < _buckets_used; idx++) {
+        const bool in_use = _back_bucket_idx != out_of_buckets_idx && idx <= _back_bucket_idx;
+
+        if (!in_use) {
+          if (buckets_resized) { _buckets_sorter[idx].reset(); }
+        } else if (!_buckets_sorter[idx]) {
+          _buckets_sorter[idx] = sorter_t::make_unique(_memory_for_buckets, _max_size, _buckets_used);
+        } else if (buckets_resized || idx == old_front_bucket_idx) {
+          sorter_t::reset_unique(_buckets_sorter[idx],
+                                 _memory_for_buckets, _max_size, _buckets_used);
         }
-
-        // We can clean up all the dead buckets with a '.reset()' on the
-        // unique_ptr, but we will leave that for the destructor to do.
       }
     }
   };
@@ -1006,9 +1183,13 @@ namespace adiar::internal
 
   public:
     ////////////////////////////////////////////////////////////////////////////
-    /// \brief Type of the (overflow) priority queue.
+    /// \brief Type of the (overflow) priority queue. In internal memory, this
+    ///        exploits that levels are only pushed to in increasing order.
     ////////////////////////////////////////////////////////////////////////////
-    using priority_queue_t = priority_queue<mem_mode, value_type, value_comp_type>;
+    using priority_queue_t =
+      std::conditional_t<mem_mode == memory_mode::Internal,
+                         radix_heap<value_type, value_comp_type, LevelFileComp>,
+                         priority_queue<mem_mode, value_type, value_comp_type>>;
 
   public:
     ////////////////////////////////////////////////////////////////////////////
@@ -1029,12 +1210,12 @@ namespace adiar::internal
   public:
     static tpie::memory_size_type memory_usage(tpie::memory_size_type no_elements)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_usage(no_elements);
+      return radix_heap<value_type, value_comp_type, LevelFileComp>::memory_usage(no_elements);
     }
 
     static tpie::memory_size_type memory_fits(tpie::memory_size_type memory_bytes)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_fits(memory_bytes);
+      return radix_heap<value_type, value_comp_type, LevelFileComp>::memory_fits(memory_bytes);
     }
 
   private:
@@ -1074,22 +1255,22 @@ namespace adiar::internal
     /// \brief The actual maximum size of the levelized priority queue.
     ////////////////////////////////////////////////////////////////////////////
     size_t _actual_max_size = 0u;
+#endif
 
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Reference to struct to store non-global stats into.
+    ///
+    /// \remark The disk usage is recorded in here also without `ADIAR_STATS`.
     ////////////////////////////////////////////////////////////////////////////
     statistics::levelized_priority_queue_t &_stats;
-#endif
 
   private:
     levelized_priority_queue(tpie::memory_size_type memory_given, size_t max_size,
-                             [[maybe_unused]] statistics::levelized_priority_queue_t &stats)
+                             statistics::levelized_priority_queue_t &stats)
       : _max_size(max_size),
         _memory_given(memory_given),
         _priority_queue(memory_given, max_size)
-#ifdef ADIAR_STATS
       , _stats(stats)
-#endif
     { }
 
   public:
@@ -1183,7 +1364,7 @@ namespace adiar::internal
       if(_priority_queue.empty()) {
         return false;
       }
-      ptr_uint64::label_type next_label_from_queue = _priority_queue.top().level();
+      ptr_uint64::label_type next_label_from_queue = _priority_queue.top_level();
       return (has_current_level() && level_cmp_lt<LevelFileComp>(_current_level,
                                                                 next_label_from_queue,
                                                                 _level_comparator))
@@ -1197,7 +1378,7 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////
     ptr_uint64::label_type next_level() /*const*/
     {
-      return _priority_queue.top().level();
+      return _priority_queue.top_level();
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -1242,9 +1423,15 @@ namespace adiar::internal
       adiar_assert(has_stop_level || !empty(),
                    "Either a stop level is given or we have some non-empty level to forward to");
 
+      // Check the disk usage once per level. The priority queue has already
+      // accounted for the room of its content when it was created.
+      const size_t disk = disk_check();
+      disk_peak_update(stats_levelized_priority_queue.max_disk_usage, disk);
+      disk_peak_update(_stats.max_disk_usage, disk);
+
       // Edge Case: ---------------------------------------------------------- :
       //   The given stop_level is prior to the next level or there is nothing in the queue
-      if ((has_stop_level && level_cmp_lt<LevelFileComp>(stop_level, next_level(), _level_comparator)) || _priority_queue.empty()) {
+      if (_priority_queue.empty() || (has_stop_level && level_cmp_lt<LevelFileComp>(stop_level, next_level(), _level_comparator))) {
         _current_level = stop_level;
         return;
       }
@@ -1273,7 +1460,7 @@ namespace adiar::internal
       // TODO: change semantics to require 'has_current_level'
       return !has_current_level()
           || _priority_queue.empty()
-          || current_level() != _priority_queue.top().level();
+          || current_level() != _priority_queue.top_level();
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -8,6 +8,7 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/io/temp_dir.h>
 
 namespace adiar::internal
 {
@@ -54,6 +55,9 @@ namespace adiar::internal
     value_type top() const
     { return pq.top(); }
 
+    auto top_level() const
+    { return pq.top().level(); }
+
     void pop()
     { pq.pop(); }
 
@@ -93,13 +97,21 @@ namespace adiar::internal
     pq_type pq;
 
   public:
-    priority_queue(size_t memory_bytes, size_t /*max_size*/)
+    priority_queue(size_t memory_bytes, size_t max_size)
       : pq(memory_bytes)
-    {}
+    {
+      // The part of its content that does not fit into its memory is placed on
+      // disk: is there (still) room for it?
+      const size_t max_bytes = disk_size<value_type>(max_size);
+      disk_check(max_bytes <= memory_bytes ? 0u : max_bytes - memory_bytes);
+    }
 
     value_type top()
     { return pq.top(); }
 
+    auto top_level()
+    { return pq.top().level(); }
+
     void pop()
     { pq.pop(); }
 
@@ -0,0 +1,368 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_HEAP_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_HEAP_H
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <stdint.h>
+
+#include <tpie/tpie.h>
+#include <tpie/array.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/radix_sort.h>
+#include <adiar/internal/data_types/ptr.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   Internal memory monotone priority queue (a radix heap) keyed on
+  ///          the level of its elements.
+  ///
+  /// \details Each element is placed in the bucket given by the most
+  ///          significant bit in which its level differs from the level of
+  ///          the last element obtained from the queue. Elements only ever
+  ///          move to a smaller bucket, which makes `push` and `pop` O(1)
+  ///          amortised for a bounded number of levels. The elements of the
+  ///          current (smallest) level are kept in a separate buffer that is
+  ///          sorted with `Comp` (using a radix sort if possible).
+  ///
+  /// \remark  Elements may \e only be pushed to the level of (or after) the
+  ///          last element obtained with `top()` or `pop()`. The level of the
+  ///          next element can be obtained with `top_level()` without putting
+  ///          any such restriction on later pushes.
+  ///
+  /// \tparam T         Type of the elements (with a `level()` member function).
+  ///
+  /// \tparam Comp      Comparator between elements. This has to agree with
+  ///                   `LevelComp` on the levels of the elements.
+  ///
+  /// \tparam LevelComp Comparator between levels (std::less = top-down, while
+  ///                   std::greater = bottom-up).
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp = std::less<T>, typename LevelComp = std::less<>>
+  class radix_heap
+  {
+  public:
+    using value_type = T;
+
+    using level_type = ptr_uint64::label_type;
+
+    static constexpr size_t data_structures = 1u;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Levels translated into an increasing key.
+    ////////////////////////////////////////////////////////////////////////////
+    using key_type = level_type;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of buckets, where bucket 0 is the buffer of the current
+    ///        level.
+    ////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t buckets = std::numeric_limits<key_type>::digits + 1u;
+
+    static_assert(buckets <= 64u,
+                  "The non-empty buckets are tracked in a 64-bit mask");
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Index for no element.
+    ////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t nil = std::numeric_limits<size_t>::max();
+
+    using array_type = tpie::array<value_type>;
+    using index_array_type = tpie::array<size_t>;
+
+  public:
+    static tpie::memory_size_type memory_usage(tpie::memory_size_type no_elements)
+    {
+      return 2u * array_type::memory_usage(no_elements)
+        + index_array_type::memory_usage(no_elements);
+    }
+
+    static tpie::memory_size_type memory_fits(tpie::memory_size_type memory_bytes)
+    {
+      const tpie::memory_size_type bytes_per_element = 2u * sizeof(value_type) + sizeof(size_t);
+
+      tpie::memory_size_type ret = memory_bytes / bytes_per_element;
+      while (0u < ret && memory_bytes < memory_usage(ret)) { --ret; }
+
+      adiar_assert(memory_usage(ret) <= memory_bytes,
+                   "memory_fits and memory_usage should agree.");
+      return ret;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Comparator between elements.
+    ////////////////////////////////////////////////////////////////////////////
+    Comp _comp = Comp();
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements (across all buckets).
+    ////////////////////////////////////////////////////////////////////////////
+    size_t _size = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Key of the last element obtained (and of the current level).
+    ////////////////////////////////////////////////////////////////////////////
+    key_type _last = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Elements in buckets 1 and onwards. Each bucket is a linked list
+    ///        through `_next`; unused slots are in the free list.
+    ////////////////////////////////////////////////////////////////////////////
+    array_type _elems;
+    index_array_type _next;
+
+    size_t _free = nil;
+    size_t _unused = 0u;
+
+    std::array<size_t, buckets> _bucket_head;
+    std::array<key_type, buckets> _bucket_min;
+
+    uint64_t _nonempty = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Buffer with the elements of the current level (bucket 0), of
+    ///        which `[_level_front, _level_back)` are yet to be obtained.
+    ////////////////////////////////////////////////////////////////////////////
+    array_type _level;
+
+    size_t _level_front = 0u;
+    size_t _level_back = 0u;
+    bool _level_sorted = true;
+
+  public:
+    radix_heap([[maybe_unused]] size_t memory_bytes, size_t max_size)
+      : _elems(max_size), _next(max_size), _level(max_size)
+    {
+      adiar_assert(max_size <= memory_fits(memory_bytes),
+                   "Must be instantiated with enough memory.");
+
+      _bucket_head.fill(nil);
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The level of the next element.
+    ///
+    /// \pre `empty() == false`
+    ////////////////////////////////////////////////////////////////////////////
+    level_type top_level() const
+    {
+      adiar_assert(!empty(), "Can only obtain level of non-empty queue");
+
+      return __level_of(_level_front < _level_back
+                        ? _last
+                        : _bucket_min[__lowest_bucket(_nonempty)]);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The next element.
+    ///
+    /// \pre `empty() == false`
+    ////////////////////////////////////////////////////////////////////////////
+    value_type top()
+    {
+      adiar_assert(!empty(), "Can only obtain top element of non-empty queue");
+
+      __setup_level();
+      return _level[_level_front];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Remove the next element.
+    ///
+    /// \pre `empty() == false`
+    ////////////////////////////////////////////////////////////////////////////
+    void pop()
+    {
+      adiar_assert(!empty(), "Can only pop from non-empty queue");
+
+      __setup_level();
+
+      _size--;
+      if (++_level_front == _level_back) {
+        _level_front = _level_back = 0u;
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Push an element into the priority queue.
+    ///
+    /// \pre Its level is the one of the last element obtained or after it.
+    ////////////////////////////////////////////////////////////////////////////
+    void push(const value_type &v)
+    {
+      adiar_assert(_size < _level.size(),
+                   "Must have room for another element");
+
+      const key_type k = __key_of(v);
+
+      adiar_assert(_last <= k,
+                   "Can only push to the current level or later.");
+
+      _size++;
+
+      if (k == _last) {
+        __level_push(v);
+      } else {
+        const size_t slot = __alloc();
+        _elems[slot] = v;
+        __bucket_link(slot, k);
+      }
+    }
+
+    size_t size() const
+    { return _size; }
+
+    bool empty() const
+    { return _size == 0u; }
+
+  private:
+    static key_type __key_of(const value_type &v)
+    {
+      return __level_of(v.level());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion between keys and levels (an involution).
+    ////////////////////////////////////////////////////////////////////////////
+    static level_type __level_of(const key_type k)
+    {
+      return LevelComp()(0u, 1u) ? k : std::numeric_limits<key_type>::max() - k;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of significant bits in `x`.
+    ////////////////////////////////////////////////////////////////////////////
+    static size_t __bit_width(const uint64_t x)
+    {
+      if (x == 0u) { return 0u; }
+#ifdef __GNUC__ // GCC 4.8+, Clang, Intel and other compilers compatible with GCC (-std=c++0x or above)
+      return 64u - static_cast<size_t>(__builtin_clzll(x));
+#else // ???
+      size_t ret = 0u;
+      for (uint64_t y = x; y != 0u; y >>= 1) { ret++; }
+      return ret;
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the first bucket set in the (non-empty) `mask`.
+    ////////////////////////////////////////////////////////////////////////////
+    static size_t __lowest_bucket(const uint64_t mask)
+    {
+      adiar_assert(mask != 0u, "Some bucket must be non-empty");
+#ifdef __GNUC__ // GCC 4.8+, Clang, Intel and other compilers compatible with GCC (-std=c++0x or above)
+      return static_cast<size_t>(__builtin_ctzll(mask));
+#else // ???
+      size_t ret = 0u;
+      while (!((mask >> ret) & 1u)) { ret++; }
+      return ret;
+#endif
+    }
+
+    size_t __alloc()
+    {
+      if (_free != nil) {
+        const size_t slot = _free;
+        _free = _next[slot];
+        return slot;
+      }
+      return _unused++;
+    }
+
+    void __dealloc(const size_t slot)
+    {
+      _next[slot] = _free;
+      _free = slot;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Place the element in `slot` with key `k` in its bucket.
+    ////////////////////////////////////////////////////////////////////////////
+    void __bucket_link(const size_t slot, const key_type k)
+    {
+      const size_t b = __bit_width(k ^ _last);
+      adiar_assert(0u < b && b < buckets, "Bucket 0 is the level buffer");
+
+      const uint64_t b_bit = uint64_t(1u) << b;
+
+      if (!(_nonempty & b_bit) || k < _bucket_min[b]) {
+        _bucket_min[b] = k;
+      }
+      _nonempty |= b_bit;
+
+      _next[slot] = _bucket_head[b];
+      _bucket_head[b] = slot;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Add an element to the level buffer.
+    ////////////////////////////////////////////////////////////////////////////
+    void __level_push(const value_type &v)
+    {
+      if (_level_back == _level.size()) {
+        std::copy(_level.begin() + _level_front, _level.begin() + _level_back, _level.begin());
+        _level_back -= _level_front;
+        _level_front = 0u;
+      }
+
+      _level_sorted = _level_sorted
+        && (_level_front == _level_back || !_comp(v, _level[_level_back - 1u]));
+
+      _level[_level_back++] = v;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Make sure the level buffer is non-empty and sorted.
+    ///
+    /// \details If the buffer is empty, then the first non-empty bucket is
+    ///          split: all elements with the smallest key are moved into the
+    ///          buffer while the remaining ones are redistributed (relative to
+    ///          the new smallest key) into smaller buckets.
+    ////////////////////////////////////////////////////////////////////////////
+    void __setup_level()
+    {
+      if (_level_front == _level_back) {
+        const size_t b = __lowest_bucket(_nonempty);
+
+        _last = _bucket_min[b];
+
+        size_t slot = _bucket_head[b];
+        _bucket_head[b] = nil;
+        _nonempty &= ~(uint64_t(1u) << b);
+
+        _level_front = _level_back = 0u;
+        while (slot != nil) {
+          const size_t next = _next[slot];
+          const key_type k = __key_of(_elems[slot]);
+
+          if (k == _last) {
+            _level[_level_back++] = _elems[slot];
+            __dealloc(slot);
+          } else {
+            __bucket_link(slot, k);
+          }
+          slot = next;
+        }
+        _level_sorted = _level_back == 1u;
+      }
+
+      if (!_level_sorted) {
+        if constexpr (has_radix_sort_key<value_type, Comp>) {
+          radix_sort<radix_sort_key<value_type, Comp>>(_level.begin() + _level_front,
+                                                       _level.begin() + _level_back);
+        } else {
+          std::sort(_level.begin() + _level_front, _level.begin() + _level_back, _comp);
+        }
+        _level_sorted = true;
+      }
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_HEAP_H
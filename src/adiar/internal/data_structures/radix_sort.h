@@ -0,0 +1,197 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_SORT_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <utility>
+#include <stdint.h>
+
+#include <adiar/internal/assert.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Key extraction for a radix sort of elements of type `T` that is
+  ///        equivalent to the comparator `Comp`.
+  ///
+  /// \details Specializations provide the key as a (lexicographically ordered)
+  ///          sequence of 64-bit unsigned integers, such that `Comp(a,b)` is
+  ///          true if and only if the key of `a` is smaller than the key of
+  ///          `b`. This is only possible for comparators that merely compare
+  ///          (packed) integers, e.g. the pointers in a node or an arc.
+  ///
+  /// \tparam T    Type of the elements.
+  ///
+  /// \tparam Comp Comparator on the elements.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  struct radix_sort_key
+  {
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of 64-bit words of the key (0 if not supported).
+    ////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t words = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the `w`th word of the key of `t`, where word 0 is the most
+    ///        significant one.
+    ////////////////////////////////////////////////////////////////////////////
+    static inline uint64_t word(const T &/*t*/, const size_t /*w*/)
+    { return 0u; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether elements of type `T` with comparator `Comp` can be sorted
+  ///        with `radix_sort`.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  constexpr bool has_radix_sort_key = 0u < radix_sort_key<T, Comp>::words;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of elements below which `radix_sort` uses an insertion sort.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t radix_sort_insertion_threshold = 32u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of bits per digit in `radix_sort`.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t radix_sort_digit_bits = 8u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of buckets per digit in `radix_sort`.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t radix_sort_buckets = 1u << radix_sort_digit_bits;
+
+  template <typename Key, typename T>
+  inline size_t
+  __radix_sort_digit(const T &t, const size_t w, const size_t shift)
+  {
+    return (Key::word(t, w) >> shift) & (radix_sort_buckets - 1u);
+  }
+
+  template <typename Key, typename T>
+  inline bool
+  __radix_sort_lt(const T &a, const T &b, size_t w)
+  {
+    for (; w < Key::words; ++w) {
+      const uint64_t a_w = Key::word(a, w);
+      const uint64_t b_w = Key::word(b, w);
+
+      if (a_w != b_w) { return a_w < b_w; }
+    }
+    return false;
+  }
+
+  template <typename Key, typename RandomIt>
+  void
+  __radix_sort_insertion(RandomIt begin, RandomIt end, const size_t w)
+  {
+    for (RandomIt i = begin; i != end; ++i) {
+      for (RandomIt j = i; j != begin && __radix_sort_lt<Key>(*j, *(j-1), w); --j) {
+        std::iter_swap(j, j-1);
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief In-place most-significant-digit radix sort (American flag sort) of
+  ///        `[begin, end)` starting at the digit at `shift` in word `w`.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Key, typename RandomIt>
+  void
+  __radix_sort(RandomIt begin, RandomIt end, size_t w, size_t shift)
+  {
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+
+    while (w < Key::words) {
+      const size_t size = static_cast<size_t>(end - begin);
+      if (size <= radix_sort_insertion_threshold) {
+        __radix_sort_insertion<Key>(begin, end, w);
+        return;
+      }
+
+      // Histogram of the current digit
+      std::array<size_t, radix_sort_buckets> counts;
+      counts.fill(0u);
+
+      for (RandomIt it = begin; it != end; ++it) {
+        counts[__radix_sort_digit<Key>(*it, w, shift)] += 1u;
+      }
+
+      // Next digit (possibly in the next word)
+      const size_t next_w     = shift == 0u ? w + 1u : w;
+      const size_t next_shift = shift == 0u ? 64u - radix_sort_digit_bits : shift - radix_sort_digit_bits;
+
+      // Skip digits shared by all elements (e.g. the level of all nodes)
+      const size_t first_digit = __radix_sort_digit<Key>(*begin, w, shift);
+      if (counts[first_digit] == size) {
+        w = next_w;
+        shift = next_shift;
+        continue;
+      }
+
+      // Bucket boundaries
+      std::array<size_t, radix_sort_buckets> heads;
+      std::array<size_t, radix_sort_buckets> tails;
+
+      size_t offset = 0u;
+      for (size_t b = 0u; b < radix_sort_buckets; ++b) {
+        heads[b] = offset;
+        offset += counts[b];
+        tails[b] = offset;
+      }
+
+      // Permute each element into its bucket
+      for (size_t b = 0u; b < radix_sort_buckets; ++b) {
+        while (heads[b] < tails[b]) {
+          auto v = *(begin + static_cast<difference_type>(heads[b]));
+          size_t d = __radix_sort_digit<Key>(v, w, shift);
+
+          while (d != b) {
+            std::swap(v, *(begin + static_cast<difference_type>(heads[d]++)));
+            d = __radix_sort_digit<Key>(v, w, shift);
+          }
+          *(begin + static_cast<difference_type>(heads[b]++)) = v;
+        }
+      }
+
+      // Recurse on each bucket
+      if (next_w == Key::words) { return; }
+
+      size_t bucket_begin = 0u;
+      for (size_t b = 0u; b < radix_sort_buckets; ++b) {
+        if (1u < counts[b]) {
+          __radix_sort<Key>(begin + static_cast<difference_type>(bucket_begin),
+                            begin + static_cast<difference_type>(bucket_begin + counts[b]),
+                            next_w, next_shift);
+        }
+        bucket_begin += counts[b];
+      }
+      return;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sort `[begin, end)` in-place in the order given by the key `Key`.
+  ///
+  /// \details Unlike a comparison-based sort, this does only inspect a few
+  ///          bytes of each element per pass. Digits that are shared by all
+  ///          elements, e.g. the level of all nodes or arcs in a level, are
+  ///          skipped. As with `std::sort`, the order of equivalent elements
+  ///          is unspecified.
+  ///
+  /// \tparam Key A specialization of `radix_sort_key`.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename Key, typename RandomIt>
+  void
+  radix_sort(RandomIt begin, RandomIt end)
+  {
+    static_assert(0u < Key::words, "Key must consist of at least one word");
+
+    if (end - begin < 2) { return; }
+    __radix_sort<Key>(begin, end, 0u, 64u - radix_sort_digit_bits);
+  }
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_SORT_H
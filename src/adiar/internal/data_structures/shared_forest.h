@@ -0,0 +1,588 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_SHARED_FOREST_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_SHARED_FOREST_H
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include <adiar/exception.h>
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/memory.h>
+#include <adiar/internal/algorithms/build.h>
+#include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_types/arc.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/ptr.h>
+#include <adiar/internal/io/file.h>
+#include <adiar/internal/io/file_stream.h>
+#include <adiar/internal/io/file_writer.h>
+#include <adiar/internal/io/node_file.h>
+#include <adiar/internal/io/node_stream.h>
+#include <adiar/internal/io/node_writer.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  //  Shared Forest
+  // ===============
+  //
+  // An alternative to storing each decision diagram in its own levelized node
+  // file: all diagrams are stored in a single shared (external memory) unique
+  // node table. For each level, the table contains a list of its nodes sorted
+  // lexicographically on their children. Inserting a decision diagram merges
+  // its (possibly new) nodes into this table level by level. Hence, nodes are
+  // shared between all diagrams in the forest and two diagrams are equivalent
+  // if and only if their roots are the same pointer.
+  //
+  // Nodes are never removed on insertion. Instead, nodes that are not reachable
+  // from some set of roots are removed with a time-forward processed mark and
+  // sweep, `gc(roots)`.
+  //
+  // All operations only use sorting and (external memory) priority queues and
+  // so have an I/O complexity of O(sort(N)) where N is the number of nodes in
+  // the forest and the diagram in question.
+  //
+  // The forest is a store next to the algorithms rather than their storage:
+  // Apply and all other operations still read and write each diagram in its
+  // own levelized node file. Their (possibly unreduced) result is added to the
+  // forest by an explicit `insert`, which routes the output of Reduce into the
+  // forest's levels. The public handles are `bdd_forest` and `zdd_forest`.
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sorting predicate on nodes: Lexicographically (descending) on their
+  ///        children, i.e. the same order as used for Reduction Rule 2.
+  //////////////////////////////////////////////////////////////////////////////
+  struct shared_forest_children_lt
+  {
+    bool operator()(const node &a, const node &b) const
+    {
+      return a.high() > b.high() || (a.high() == b.high() && a.low() > b.low());
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sorting predicate on arcs: Descending on their target, i.e. in the
+  ///        order they are resolved by a bottom-up sweep.
+  //////////////////////////////////////////////////////////////////////////////
+  struct shared_forest_target_gt
+  {
+    bool operator()(const arc &a, const arc &b) const
+    {
+      return a.target() > b.target();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Sorting predicate on arcs: Descending on their source, i.e. the
+  ///        high arc comes before the low arc of the same node.
+  //////////////////////////////////////////////////////////////////////////////
+  struct shared_forest_source_gt
+  {
+    bool operator()(const arc &a, const arc &b) const
+    {
+      return a.source() > b.source();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A shared unique node table for decision diagrams of the given
+  ///        policy.
+  ///
+  /// \details Each level is stored twice: once in ascending order of the ids
+  ///          (to follow pointers) and once sorted on the children (to look up
+  ///          whether a node already exists).
+  ///
+  /// \tparam DdPolicy Decision diagram policy to provide the reduction rules.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename DdPolicy>
+  class shared_forest
+  {
+  public:
+    using dd_type      = typename DdPolicy::dd_type;
+    using __dd_type    = typename DdPolicy::__dd_type;
+    using node_type    = typename DdPolicy::node_type;
+    using pointer_type = typename DdPolicy::pointer_type;
+    using label_type   = typename DdPolicy::label_type;
+    using id_type      = typename DdPolicy::id_type;
+
+  private:
+    using arc_pq_type = external_priority_queue<arc, shared_forest_source_gt>;
+    using ptr_pq_type = external_priority_queue<pointer_type, std::less<pointer_type>>;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief The nodes of a single level.
+    ////////////////////////////////////////////////////////////////////////////
+    struct level_type
+    {
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief The nodes in ascending order of their id.
+      //////////////////////////////////////////////////////////////////////////
+      shared_ptr<file<node_type>> by_uid = make_shared<file<node_type>>();
+
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief The nodes sorted by `shared_forest_children_lt`.
+      //////////////////////////////////////////////////////////////////////////
+      shared_ptr<file<node_type>> by_children = make_shared<file<node_type>>();
+
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief The id of the next node to be added to this level.
+      //////////////////////////////////////////////////////////////////////////
+      id_type next_id = 0u;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief All (non-empty) levels of the forest.
+    ////////////////////////////////////////////////////////////////////////////
+    std::map<label_type, level_type> _levels;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Execution policy, e.g. the memory budget, of all sweeps.
+    ////////////////////////////////////////////////////////////////////////////
+    exec_policy _policy;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Create an empty forest.
+    ///
+    /// \param ep Execution policy for inserting, exporting, and collecting
+    ///           garbage.
+    ////////////////////////////////////////////////////////////////////////////
+    explicit shared_forest(const exec_policy &ep = exec_policy())
+      : _policy(ep)
+    { }
+
+    ////////////////////////////////////////////////////////////////////////////
+    shared_forest(const shared_forest &) = delete;
+    shared_forest(shared_forest &&) = default;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of nodes in the forest.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t size() const
+    {
+      size_t res = 0u;
+      for (const auto &l : _levels) { res += l.second.by_uid->size(); }
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of (non-empty) levels in the forest.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t levels() const
+    { return _levels.size(); }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Merge the nodes of a decision diagram into the forest.
+    ///
+    /// \details The diagram is processed bottom-up, level by level. Each level
+    ///          is sorted on its (translated) children and merged with the
+    ///          forest's level of the same label; only nodes that do not
+    ///          already exist are added.
+    ///
+    /// \returns Pointer to the root of `f` within the forest. Two diagrams are
+    ///          equivalent if and only if their roots are the same.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type insert(const dd_type &f)
+    {
+      // Copy the (possibly negated) nodes of `f` in top-down order.
+      file<node_type> f_nodes;
+      {
+        node_stream<> ns(f);
+
+        const node_type root = ns.pull();
+        if (root.is_terminal()) { return root.uid(); }
+
+        file_writer<node_type> fw(f_nodes);
+        fw << root;
+        while (ns.can_pull()) { fw << ns.pull(); }
+      }
+      f_nodes.sort(std::less<node_type>());
+
+      // Arcs to the internal children of `f` in the order of the bottom-up
+      // sweep.
+      file<arc> f_parents;
+      __write_parents(f_nodes, f_parents);
+
+      file_stream<arc> parents(f_parents);
+      arc_pq_type pq(__memory(), f_nodes.size());
+
+      pointer_type root = pointer_type::nil();
+
+      file_stream<node_type, true> f_stream(f_nodes);
+      while (f_stream.can_pull()) {
+        const label_type label = f_stream.peek().label();
+
+        // Translate the children of all nodes on this level. Nodes that are
+        // suppressed by the reduction rules are immediately forwarded.
+        file<arc> level_mapping;
+        file<node_type> level_nodes;
+        {
+          file_writer<arc> mw(level_mapping);
+          file_writer<node_type> nw(level_nodes);
+
+          while (f_stream.can_pull() && f_stream.peek().label() == label) {
+            const node_type n = __forward(pq, f_stream.pull());
+
+            const pointer_type rr_res = DdPolicy::reduction_rule(n);
+            if (rr_res != n.uid()) {
+              mw << arc(n.uid(), rr_res);
+            } else {
+              nw << n;
+            }
+          }
+        }
+        level_nodes.sort(shared_forest_children_lt());
+
+        // Before the forest's level is changed, check whether the ids of all
+        // nodes (if new) fit. The levels below then only include a few more
+        // unreachable nodes.
+        {
+          const auto level_it = _levels.find(label);
+          const id_type next_id = level_it == _levels.end() ? 0u : level_it->second.next_id;
+
+          if (DdPolicy::max_id + 1u - next_id < level_nodes.size()) {
+            throw out_of_range("Too many nodes on a single level of the forest");
+          }
+        }
+
+        // Merge with the forest's level. The ids of the nodes in `f` are kept
+        // within `level_nodes` to output the mapping to the forest's nodes.
+        level_type &level = _levels[label];
+        {
+          shared_ptr<file<node_type>> by_children = make_shared<file<node_type>>();
+
+          file_writer<arc> mw(level_mapping);
+          file_writer<node_type> uid_writer(level.by_uid);
+          file_writer<node_type> children_writer(by_children);
+
+          file_stream<node_type> forest_stream(level.by_children);
+          file_stream<node_type> level_stream(level_nodes);
+
+          const shared_forest_children_lt lt;
+
+          while (level_stream.can_pull()) {
+            const node_type n = level_stream.pull();
+
+            while (forest_stream.can_pull() && lt(forest_stream.peek(), n)) {
+              children_writer << forest_stream.pull();
+            }
+
+            if (forest_stream.can_pull() && forest_stream.peek().children() == n.children()) {
+              mw << arc(n.uid(), forest_stream.peek().uid());
+              continue;
+            }
+
+            const node_type n_new(label, level.next_id++, n.low(), n.high());
+
+            uid_writer << n_new;
+            children_writer << n_new;
+            mw << arc(n.uid(), n_new.uid());
+          }
+          while (forest_stream.can_pull()) {
+            children_writer << forest_stream.pull();
+          }
+
+          forest_stream.detach();
+          level.by_children = by_children;
+        }
+        level_mapping.sort(shared_forest_source_gt());
+
+        // Forward the result to the parents
+        file_stream<arc> ms(level_mapping);
+        while (ms.can_pull()) {
+          const arc m = ms.pull();
+          __forward_to_parents(pq, parents, m);
+          root = m.target();
+        }
+      }
+
+      adiar_assert(pq.empty(), "All forwarded pointers have been used");
+      return root;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Reduce the (possibly unreduced) result of an operation and merge
+    ///        its nodes into the forest.
+    ///
+    /// \details The output of Reduce (with the execution policy of `f`) is
+    ///          only used to be merged into the forest's levels.
+    ///
+    /// \returns Pointer to the root of `f` within the forest.
+    ////////////////////////////////////////////////////////////////////////////
+    pointer_type insert(__dd_type f)
+    {
+      return insert(dd_type(std::move(f)));
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the decision diagram with the given root as a (canonical)
+    ///        levelized node file.
+    ///
+    /// \pre `root` is a terminal or a node within this forest.
+    ////////////////////////////////////////////////////////////////////////////
+    shared_levelized_file<node_type> export_to_file(const pointer_type &root) const
+    {
+      if (root.is_terminal()) {
+        return build_terminal<DdPolicy>(root.value());
+      }
+
+      file<node_type> reached;
+      file<arc> reached_parents;
+      std::map<label_type, size_t> level_sizes;
+      __mark({ root }, reached, reached_parents, level_sizes);
+
+      shared_levelized_file<node_type> nf;
+      {
+        node_writer nw(nf);
+
+        file_stream<arc> parents(reached_parents);
+        arc_pq_type pq(__memory(), reached.size());
+
+        file_stream<node_type, true> reached_stream(reached);
+        while (reached_stream.can_pull()) {
+          const label_type label = reached_stream.peek().label();
+
+          // Translate the children of all nodes on this level (while keeping
+          // their id within the forest)
+          file<node_type> level_nodes;
+          {
+            file_writer<node_type> lw(level_nodes);
+            while (reached_stream.can_pull() && reached_stream.peek().label() == label) {
+              lw << __forward(pq, reached_stream.pull());
+            }
+          }
+          level_nodes.sort(shared_forest_children_lt());
+
+          // Output the nodes in canonical order
+          file<arc> level_mapping;
+          {
+            file_writer<arc> mw(level_mapping);
+            file_stream<node_type> ls(level_nodes);
+
+            id_type out_id = DdPolicy::max_id;
+            while (ls.can_pull()) {
+              const node_type n = ls.pull();
+              const node_type n_out(label, out_id--, n.low(), n.high());
+
+              nw << n_out;
+              mw << arc(n.uid(), n_out.uid());
+            }
+          }
+          level_mapping.sort(shared_forest_source_gt());
+
+          // Forward the result to the parents
+          file_stream<arc> ms(level_mapping);
+          while (ms.can_pull()) {
+            __forward_to_parents(pq, parents, ms.pull());
+          }
+        }
+        adiar_assert(pq.empty(), "All forwarded pointers have been used");
+      }
+      return nf;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the decision diagram with the given root.
+    ///
+    /// \pre `root` is a terminal or a node within this forest.
+    ////////////////////////////////////////////////////////////////////////////
+    dd_type get(const pointer_type &root) const
+    {
+      return dd_type(export_to_file(root));
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Remove all nodes that are not reachable from the given roots.
+    ///
+    /// \details A top-down sweep marks all reachable nodes. A bottom-up sweep
+    ///          then renumbers the surviving nodes of each level to the ids 0,
+    ///          1, ..., i.e. the ids of all other nodes in the forest change.
+    ///
+    /// \returns The new pointer for each root in `roots` (in the same order).
+    ///
+    /// \pre All `roots` are terminals or nodes within this forest.
+    ////////////////////////////////////////////////////////////////////////////
+    std::vector<pointer_type> gc(const std::vector<pointer_type> &roots)
+    {
+      file<node_type> reached;
+      file<arc> reached_parents;
+      std::map<label_type, size_t> level_sizes;
+      __mark(roots, reached, reached_parents, level_sizes);
+
+      // New pointer for each root (terminals stay as-is)
+      std::map<pointer_type, pointer_type> root_mapping;
+      for (const pointer_type &r : roots) { root_mapping.insert({ r, r }); }
+
+      std::map<label_type, level_type> new_levels;
+      {
+        file_stream<arc> parents(reached_parents);
+        arc_pq_type pq(__memory(), reached.size());
+
+        file_stream<node_type, true> reached_stream(reached);
+        while (reached_stream.can_pull()) {
+          const label_type label = reached_stream.peek().label();
+
+          // Since the nodes are processed in descending order of their ids, so
+          // are their new ids. Hence, the relative order of ids is preserved.
+          level_type &level = new_levels[label];
+          level.next_id = level_sizes.at(label);
+          {
+            file_writer<node_type> uid_writer(level.by_uid);
+            file_writer<node_type> children_writer(level.by_children);
+
+            id_type new_id = level.next_id;
+            while (reached_stream.can_pull() && reached_stream.peek().label() == label) {
+              const node_type n = __forward(pq, reached_stream.pull());
+              const node_type n_new(label, --new_id, n.low(), n.high());
+
+              uid_writer << n_new;
+              children_writer << n_new;
+
+              const arc m(n.uid(), n_new.uid());
+              __forward_to_parents(pq, parents, m);
+
+              const auto r = root_mapping.find(n.uid());
+              if (r != root_mapping.end()) { r->second = n_new.uid(); }
+            }
+            adiar_assert(new_id == 0u, "All ids in [0; size) are used");
+          }
+          level.by_uid->sort(std::less<node_type>());
+          level.by_children->sort(shared_forest_children_lt());
+        }
+        adiar_assert(pq.empty(), "All forwarded pointers have been used");
+      }
+      _levels = std::move(new_levels);
+
+      std::vector<pointer_type> res;
+      res.reserve(roots.size());
+      for (const pointer_type &r : roots) { res.push_back(root_mapping.at(r)); }
+      return res;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory for the priority queue of a single sweep.
+    ///
+    /// \details The remaining half is left for the file streams and sorting.
+    ////////////////////////////////////////////////////////////////////////////
+    size_t __memory() const
+    {
+      return memory_available(_policy) / 2;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Write the arcs to all internal children of the nodes in
+    ///        `nodes` to `out`, sorted by `shared_forest_target_gt`.
+    ////////////////////////////////////////////////////////////////////////////
+    static void __write_parents(const file<node_type> &nodes, file<arc> &out)
+    {
+      {
+        file_stream<node_type> ns(nodes);
+        file_writer<arc> aw(out);
+
+        while (ns.can_pull()) {
+          const node_type n = ns.pull();
+          if (n.low().is_node())  { aw << arc(n.uid(), false, n.low()); }
+          if (n.high().is_node()) { aw << arc(n.uid(), true,  n.high()); }
+        }
+      }
+      out.sort(shared_forest_target_gt());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Replace the internal children of `n` with the pointers forwarded
+    ///        to it in `pq`.
+    ////////////////////////////////////////////////////////////////////////////
+    static node_type __forward(arc_pq_type &pq, const node_type &n)
+    {
+      // The high arc is forwarded before the low arc.
+      pointer_type high = n.high();
+      if (high.is_node()) {
+        adiar_assert(!pq.empty() && pq.top().source() == n.uid().as_ptr(true),
+                     "Pointer for high child has been forwarded");
+        high = pq.top().target();
+        pq.pop();
+      }
+
+      pointer_type low = n.low();
+      if (low.is_node()) {
+        adiar_assert(!pq.empty() && pq.top().source() == n.uid().as_ptr(false),
+                     "Pointer for low child has been forwarded");
+        low = pq.top().target();
+        pq.pop();
+      }
+
+      return node_type(n.uid(), low, high);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Forward the mapping `m` from an old to a new pointer to all
+    ///        parents of `m.source()` in `parents`.
+    ///
+    /// \pre The mappings are provided in descending order of `m.source()`.
+    ////////////////////////////////////////////////////////////////////////////
+    static void __forward_to_parents(arc_pq_type &pq,
+                                     file_stream<arc> &parents,
+                                     const arc &m)
+    {
+      while (parents.can_pull() && parents.peek().target() == m.source()) {
+        pq.push(arc(parents.pull().source(), m.target()));
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Time-forward processing of all nodes reachable from `roots`.
+    ///
+    /// \param reached     Output of all reachable nodes in ascending order.
+    ///
+    /// \param parents     Output of the arcs between reachable nodes, sorted
+    ///                    by `shared_forest_target_gt`.
+    ///
+    /// \param level_sizes Output of the number of reachable nodes per level.
+    ////////////////////////////////////////////////////////////////////////////
+    void __mark(const std::vector<pointer_type> &roots,
+                file<node_type> &reached,
+                file<arc> &parents,
+                std::map<label_type, size_t> &level_sizes) const
+    {
+      {
+        ptr_pq_type pq(__memory(), size());
+        for (const pointer_type &r : roots) {
+          if (r.is_node()) { pq.push(r); }
+        }
+
+        file_writer<node_type> rw(reached);
+
+        while (!pq.empty()) {
+          const label_type label = pq.top().label();
+          file_stream<node_type> ls(_levels.at(label).by_uid);
+
+          while (!pq.empty() && pq.top().label() == label) {
+            const pointer_type p = pq.top();
+            while (!pq.empty() && pq.top() == p) { pq.pop(); }
+
+            const node_type n = ls.seek(node::uid_type(p));
+            adiar_assert(n.uid() == p, "Pointer must exist within the forest");
+
+            rw << n;
+            level_sizes[label] += 1u;
+
+            if (n.low().is_node())  { pq.push(n.low()); }
+            if (n.high().is_node()) { pq.push(n.high()); }
+          }
+        }
+      }
+      __write_parents(reached, parents);
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_SHARED_FOREST_H
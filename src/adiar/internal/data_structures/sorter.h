@@ -11,6 +11,8 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/data_structures/radix_sort.h>
+#include <adiar/internal/io/temp_dir.h>
 
 namespace adiar::internal
 {
@@ -19,6 +21,9 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Wrapper for TPIE's internal vector with standard quick-sort.
+  ///
+  /// \details If `radix_sort_key<T, Comp>` is specialized, then the elements
+  ///          are instead sorted with a radix sort.
   //////////////////////////////////////////////////////////////////////////////
   template <typename T, typename Comp>
   class sorter<memory_mode::Internal, T, Comp>
@@ -97,7 +102,11 @@ namespace adiar::internal
 
     void sort()
     {
-      tpie::parallel_sort(_array.begin(), _array.begin() + _size, _pred);
+      if constexpr (has_radix_sort_key<value_type, Comp>) {
+        radix_sort<radix_sort_key<value_type, Comp>>(_array.begin(), _array.begin() + _size);
+      } else {
+        tpie::parallel_sort(_array.begin(), _array.begin() + _size, _pred);
+      }
       _front_idx = 0;
     }
 
@@ -200,6 +209,11 @@ namespace adiar::internal
       // Case 0: No sorters - why are we then instantiating one?
       adiar_assert(number_of_sorters > 0, "Number of sorters should be positive");
 
+      // If its elements do not fit into its memory, then its runs are placed
+      // on disk: is there (still) room for them?
+      const size_t no_elements_bytes = disk_size<value_type>(no_elements);
+      disk_check(no_elements_bytes <= memory_bytes ? 0u : no_elements_bytes);
+
       // Consult the internal sorter to get a bound of how much memory is
       // necessary to sort these elements in internal memory. We don't need to
       // allocate more than a constant of this for the external memory case.
@@ -427,6 +427,56 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////
   inline bool operator>= (const node::uid_type &u, const node &n)
   { return u >= n.uid(); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Ordering of nodes by their (unflagged) children, i.e. the order in
+  ///        which Reduction Rule 2 assigns the identifiers on a level.
+  //////////////////////////////////////////////////////////////////////////////
+  struct reduce_node_children_lt
+  {
+    bool operator()(const node &a, const node &b)
+    {
+      // TODO (Attributed Edges):
+      //     Use the 'flag' bit on children to mark attributed edges. Currently,
+      //     we use this flag to mark whether Reduction Rule 1 was applied to
+      //     some node across some arc.
+      const ptr_uint64 a_high = unflag(a.high());
+      const ptr_uint64 a_low = unflag(a.low());
+
+      const ptr_uint64 b_high = unflag(b.high());
+      const ptr_uint64 b_low = unflag(b.low());
+
+      return a_high > b_high || (a_high == b_high && a_low > b_low)
+#ifndef NDEBUG
+        || (a_high == b_high && a_low == b_low && a.uid() > b.uid())
+#endif
+        ;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Hash of a node's (unflagged) children.
+  //////////////////////////////////////////////////////////////////////////////
+  struct reduce_node_children_hash
+  {
+    inline size_t operator()(const ptr_uint64 &p) const
+    {
+      constexpr uint64_t prime = 0x9E3779B97F4A7C15u;
+
+      const ptr_uint64 p_unflagged = unflag(p);
+      const uint64_t h = p_unflagged.is_node()
+        ? (static_cast<uint64_t>(p_unflagged.label()) << 40) ^ static_cast<uint64_t>(p_unflagged.id())
+        : ~static_cast<uint64_t>(p_unflagged.value());
+
+      return static_cast<size_t>(h * prime);
+    }
+
+    inline size_t operator()(const node &n) const
+    {
+      const size_t h_high = (*this)(n.high());
+      return (h_high << 7) ^ (h_high >> 3) ^ (*this)(n.low());
+    }
+  };
 }
 
 #endif // ADIAR_INTERNAL_DATA_TYPES_NODE_H
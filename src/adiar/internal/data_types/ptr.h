@@ -103,6 +103,9 @@ namespace adiar::internal
 
     template<typename pointer_type>
     friend class __uid;
+
+    template<typename T, typename Comp>
+    friend struct radix_sort_key;
     ////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////
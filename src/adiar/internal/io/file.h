@@ -13,6 +13,7 @@
 #include <adiar/exception.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/io/temp_dir.h>
 
 namespace adiar::internal
 {
@@ -92,8 +93,13 @@ namespace adiar::internal
   public:
     ////////////////////////////////////////////////////////////////////////////
     /// \brief Constructor for a new unammed \em temporary file.
+    ///
+    /// \details If multiple temporary directories are given, then the file is
+    ///          placed in the next one of them.
+    ///
+    /// \see next_temp_path
     ////////////////////////////////////////////////////////////////////////////
-    file() : _tpie_file()
+    file() : _tpie_file(next_temp_path())
     { }
 
   public:
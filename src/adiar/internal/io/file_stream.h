@@ -258,6 +258,28 @@ namespace adiar::internal
       while (_peeked < tgt && __can_read()) { _peeked = __read(); }
       return _peeked;
     }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Move the read head, such that the next element pulled is the
+    ///          one at the given index within the file (independent of the
+    ///          reading direction).
+    ///
+    /// \param i Index of the element within the file.
+    ///
+    /// \pre     `i` is smaller than the number of elements in the file.
+    ////////////////////////////////////////////////////////////////////////////
+    void seek_index(const size_t i)
+    {
+      adiar_assert(i < _stream.size(), "Index must be within the file");
+
+      _has_peeked = false;
+      if constexpr (Reverse) {
+        _stream.seek(i + 1u);
+      } else {
+        _stream.seek(i);
+      }
+    }
   };
 }
 
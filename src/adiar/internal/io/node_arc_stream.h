@@ -3,6 +3,7 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_types/arc.h>
+#include <adiar/internal/data_types/convert.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/io/levelized_file.h>
 #include <adiar/internal/io/levelized_file_stream.h>
@@ -86,6 +86,15 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////
     const node seek(const node::uid_type &u)
     { return parent_t::_streams[0].seek(u); }
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief   Move the read head to the node at the given index within the
+    ///          file (independent of the reading direction).
+    ///
+    /// \param i Index of the node within the file.
+    ////////////////////////////////////////////////////////////////////////////
+    void seek_index(const size_t i)
+    { parent_t::_streams[0].seek_index(i); }
   };
 }
 
@@ -0,0 +1,107 @@
+#include "temp_dir.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#include <tpie/stats.h>
+#include <tpie/tempname.h>
+
+#include <adiar/exception.h>
+
+namespace adiar::internal
+{
+  // Files may be created concurrently (e.g. by multiple threads each running
+  // their own operation), while the directories are only reconfigured by
+  // `adiar_init`. Hence, the directories are guarded by a readers-writer lock
+  // and the round-robin index is atomic.
+  std::shared_mutex _temp_dirs_mutex;
+  std::vector<std::string> _temp_dirs;
+  std::atomic<size_t> _temp_dirs_next = 0u;
+
+  void set_temp_dirs(const std::vector<std::string> &dirs)
+  {
+    std::unique_lock<std::shared_mutex> lock(_temp_dirs_mutex);
+    _temp_dirs = dirs;
+    _temp_dirs_next.store(0u, std::memory_order_relaxed);
+  }
+
+  std::vector<std::string> temp_dirs()
+  {
+    std::shared_lock<std::shared_mutex> lock(_temp_dirs_mutex);
+    return _temp_dirs;
+  }
+
+  std::string next_temp_path()
+  {
+    std::shared_lock<std::shared_mutex> lock(_temp_dirs_mutex);
+    if (_temp_dirs.size() < 2u) { return ""; }
+
+    const size_t idx = _temp_dirs_next.fetch_add(1u, std::memory_order_relaxed);
+    return tpie::tempname::tpie_name("", _temp_dirs[idx % _temp_dirs.size()]);
+  }
+
+  // Disk checks may happen concurrently (e.g. by the workers of a parallel
+  // sweep), so the limit and the global peak are atomic and the peaks of the
+  // individual operations are only updated while holding a lock.
+  std::atomic<size_t> _disk_limit = disk_unlimited;
+  std::atomic<size_t> _disk_peak  = 0u;
+  std::mutex _disk_peak_mutex;
+
+  size_t disk_usage()
+  {
+    return tpie::get_temp_file_usage();
+  }
+
+  void __disk_peak_update(const size_t usage)
+  {
+    size_t peak = _disk_peak.load(std::memory_order_relaxed);
+    while (peak < usage
+           && !_disk_peak.compare_exchange_weak(peak, usage, std::memory_order_relaxed))
+      ;
+  }
+
+  size_t disk_peak()
+  {
+    __disk_peak_update(disk_usage());
+    return _disk_peak.load(std::memory_order_relaxed);
+  }
+
+  void disk_peak_reset()
+  {
+    _disk_peak.store(disk_usage(), std::memory_order_relaxed);
+  }
+
+  void disk_peak_update(size_t &peak, const size_t usage)
+  {
+    std::lock_guard<std::mutex> lock(_disk_peak_mutex);
+    peak = std::max(peak, usage);
+  }
+
+  void set_disk_limit(size_t bytes)
+  {
+    _disk_limit.store(bytes, std::memory_order_relaxed);
+  }
+
+  size_t disk_limit()
+  {
+    return _disk_limit.load(std::memory_order_relaxed);
+  }
+
+  size_t disk_check(size_t bytes)
+  {
+    const size_t usage = disk_usage();
+    __disk_peak_update(usage);
+
+    const size_t limit = disk_limit();
+    if (limit == disk_unlimited) { return usage; }
+
+    if (limit < usage || limit - usage < bytes) {
+      throw runtime_error("Temporary files exceed the disk limit of "
+                          + std::to_string(limit) + " bytes");
+    }
+    return usage;
+  }
+}
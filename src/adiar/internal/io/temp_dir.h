@@ -0,0 +1,109 @@
+#ifndef ADIAR_INTERNAL_IO_TEMP_DIR_H
+#define ADIAR_INTERNAL_IO_TEMP_DIR_H
+
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Set the directories across which temporary files are striped.
+  ///
+  /// \details If empty, then all temporary files are placed in TPIE's default
+  ///          directory.
+  //////////////////////////////////////////////////////////////////////////////
+  void set_temp_dirs(const std::vector<std::string> &dirs);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The directories across which temporary files are striped.
+  ///
+  /// \details Returned as a copy, since they may be reconfigured concurrently.
+  //////////////////////////////////////////////////////////////////////////////
+  std::vector<std::string> temp_dirs();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Path for a new temporary file.
+  ///
+  /// \details The directories of `temp_dirs()` are used in a round-robin
+  ///          fashion. Since an algorithm usually creates its output file
+  ///          right after its input files, this places its input streams and
+  ///          its output writer on different directories (devices). If only a
+  ///          single (or no) directory is given, then the empty string is
+  ///          returned, i.e. TPIE picks the path lazily in its default
+  ///          directory.
+  //////////////////////////////////////////////////////////////////////////////
+  std::string next_temp_path();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Value of `disk_limit()` if no limit has been set.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t disk_unlimited = std::numeric_limits<size_t>::max();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of bytes currently occupied by temporary files, i.e. the
+  ///        files of decision diagrams, arcs, sorters and priority queues.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t disk_usage();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Largest value of `disk_usage()` observed since the last call to
+  ///        `disk_peak_reset()`.
+  ///
+  /// \details The usage is observed whenever it is checked against the limit,
+  ///          i.e. when an external memory data structure is created and when
+  ///          a levelized priority queue moves on to the next level.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t disk_peak();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Reset `disk_peak()` to the current disk usage.
+  //////////////////////////////////////////////////////////////////////////////
+  void disk_peak_reset();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Raise the peak of a single operation, e.g. the `max_disk_usage`
+  ///        of its statistics, to the given usage.
+  ///
+  /// \details Contrary to the other statistics, this is done independently of
+  ///          `ADIAR_STATS` and is safe to call from multiple threads.
+  //////////////////////////////////////////////////////////////////////////////
+  void disk_peak_update(size_t &peak, const size_t usage);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Set the maximum number of bytes temporary files may occupy.
+  //////////////////////////////////////////////////////////////////////////////
+  void set_disk_limit(size_t bytes);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The maximum number of bytes temporary files may occupy.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t disk_limit();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of bytes that `elements` many values of type `T` occupy on
+  ///        disk (saturated at `disk_unlimited`).
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename T>
+  constexpr size_t disk_size(const size_t elements)
+  {
+    return elements <= disk_unlimited / sizeof(T)
+      ? elements * sizeof(T)
+      : disk_unlimited;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Check whether another `bytes` fit within the `disk_limit()`.
+  ///
+  /// \param bytes The number of bytes the caller predicts to write to disk,
+  ///              e.g. the part of a sorter or priority queue that does not
+  ///              fit into its memory.
+  ///
+  /// \returns The current disk usage.
+  ///
+  /// \throws runtime_error If the usage (plus `bytes`) exceeds the limit.
+  //////////////////////////////////////////////////////////////////////////////
+  size_t disk_check(size_t bytes = 0u);
+}
+
+#endif // ADIAR_INTERNAL_IO_TEMP_DIR_H
@@ -1,11 +1,14 @@
 #ifndef ADIAR_INTERNAL_MEMORY_H
 #define ADIAR_INTERNAL_MEMORY_H
 
+#include <algorithm>
 #include <string>
 
 #include <tpie/tpie.h>
 #include <tpie/memory.h>
 
+#include <adiar/exec_policy.h>
+
 #include <adiar/internal/assert.h>
 
 namespace adiar::internal
@@ -18,6 +21,15 @@ namespace adiar::internal
     return tpie::get_memory_manager().available();
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the amount of memory available to an operation, i.e. the
+  ///        available memory capped by the budget of its execution policy.
+  //////////////////////////////////////////////////////////////////////////////
+  inline size_t memory_available(const exec_policy &ep)
+  {
+    return std::min(memory_available(), ep.memory_limit().bytes());
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Enum to specify implementation of auxiliary data structures.
   ///
@@ -34,6 +34,21 @@ namespace adiar::internal
     }
   }
 
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief Template to hide how to obtain the width of a level from a data
+  ///        type. This is 0 if the data type does not provide a width.
+  ////////////////////////////////////////////////////////////////////////////
+  template<typename T>
+  inline size_t
+  width_of(const T& t)
+  {
+    if constexpr (std::is_integral<T>::value) {
+      return 0u;
+    } else {
+      return t.width();
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Defines at compile time the type of the file stream to use for
   ///        reading the levels from some file(s).
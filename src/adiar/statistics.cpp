@@ -4,6 +4,7 @@
 
 #include <adiar/bdd/if_then_else.h>
 #include <adiar/internal/algorithms/count.h>
+#include <adiar/internal/algorithms/depth_first.h>
 #include <adiar/internal/algorithms/reduce.h>
 #include <adiar/internal/algorithms/intercut.h>
 #include <adiar/internal/algorithms/nested_sweeping.h>
@@ -25,7 +26,7 @@ namespace adiar
   statistics statistics_get()
   {
 #ifndef ADIAR_STATS
-    std::cerr << "Statistics not gathered. Please compile with 'ADIAR_STATS'" << std::endl;
+    std::cerr << "Statistics (except for the disk usage) not gathered. Please compile with 'ADIAR_STATS'" << std::endl;
 #endif
 
     return {
@@ -50,7 +51,8 @@ namespace adiar
       internal::stats_reduce,
 
       // other algorithms
-      internal::nested_sweeping::stats
+      internal::nested_sweeping::stats,
+      internal::stats_depth_first
     };
   }
 
@@ -78,6 +80,7 @@ namespace adiar
 
     // other algorithms
     internal::nested_sweeping::stats         = {};
+    internal::stats_depth_first              = {};
   }
 
   //////////////////////////////////////////////////////////////////////////////
@@ -211,7 +214,13 @@ namespace adiar
       << stats.sum_actual_max_size << " / " << stats.sum_predicted_max_size
       << " = " << internal::percent_frac(stats.sum_actual_max_size, stats.sum_predicted_max_size) << percent
       << endl;
-    indent_level -= 2;
+    indent_level--;
+
+    o << indent << endl;
+
+    o << indent << bold_on << label << "max disk usage" << bold_off
+      << stats.max_disk_usage << " bytes" << endl;
+    indent_level--;
   }
 
 
@@ -576,6 +585,27 @@ namespace adiar
   }
 
 
+  void __printstat_depth_first(std::ostream &o)
+  {
+    uintwide total_runs = internal::stats_depth_first.runs;
+    o << indent << bold_on << label << "Depth-first Engine" << bold_off << total_runs << endl;
+
+    indent_level++;
+    if (total_runs == 0u) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << label << "fallbacks:"
+      << internal::stats_depth_first.fallbacks
+      << " = " << internal::percent_frac(internal::stats_depth_first.fallbacks, total_runs) << percent
+      << endl;
+
+    indent_level--;
+  }
+
+
   void statistics_print(std::ostream &o)
   {
     o << bold_on << "Adiar statistics" << bold_off << endl;
@@ -631,6 +661,11 @@ namespace adiar
     o << bold_on << "--== Bottom-Up Sweep Algorithms ==--" << bold_off << endl << endl;
 
     __printstat_reduce(o);
+    o << endl;
+
+    o << bold_on << "--== Other Algorithms ==--" << bold_off << endl << endl;
+
+    __printstat_depth_first(o);
 #endif
   }
 }
@@ -136,6 +136,15 @@ namespace adiar
       /// levelized priority queues that have reported their statistics.
       //////////////////////////////////////////////////////////////////////////
       size_t sum_destructors = 0;
+
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief Largest number of bytes occupied by temporary files when
+      /// moving to a new level.
+      ///
+      /// \remark Contrary to all other statistics, this is also populated
+      ///         without `ADIAR_STATS`.
+      //////////////////////////////////////////////////////////////////////////
+      size_t max_disk_usage = 0;
     }
     /// \copydoc levelized_priority_queue_t
     levelized_priority_queue;
@@ -503,6 +512,27 @@ namespace adiar
     }
     /// \copydoc nested_sweeping_t
     nested_sweeping;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief Depth-first engine statistics.
+    ///
+    /// \see exec_policy::engine
+    ////////////////////////////////////////////////////////////////////////////
+    struct depth_first_t
+    {
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief Number of runs of the depth-first engine.
+      //////////////////////////////////////////////////////////////////////////
+      uintwide runs = 0;
+
+      //////////////////////////////////////////////////////////////////////////
+      /// \brief Number of runs abandoned due to exceeding the budget of the
+      ///        local unique table (and so fell back to levelized algorithms).
+      //////////////////////////////////////////////////////////////////////////
+      uintwide fallbacks = 0;
+    }
+    /// \copydoc depth_first_t
+    depth_first;
   };
 
   //////////////////////////////////////////////////////////////////////////////
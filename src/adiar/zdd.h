@@ -21,8 +21,11 @@
 #include <adiar/functional.h>
 
 #include <adiar/zdd/zdd.h>
+#include <adiar/zdd/zdd_policy.h>
 #include <adiar/bdd/bdd.h>
 
+#include <adiar/internal/data_structures/shared_forest.h>
+
 namespace adiar
 {
   //////////////////////////////////////////////////////////////////////////////
@@ -355,6 +358,161 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////
   zdd zdd_top();
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      Construct the family of sets given by a stream of (set, element)
+  ///             pairs.
+  ///
+  /// \details    The pairs are sorted externally and the ZDD is constructed with
+  ///             a single run of the Reduce algorithm. Hence, this uses only
+  ///             \f$ O(\mathit{sort}(N)) \f$ I/Os for \f$ N \f$ pairs rather
+  ///             than \f$ n \f$ calls to `zdd_union`.
+  ///
+  /// \param n    Number of sets. The sets are identified by \f$ 0, 1, \dots,
+  ///             n-1 \f$ and a set without any pairs is the empty set.
+  ///
+  /// \param sets Generator of pairs \f$ (i, x) \f$ stating that \f$ x \f$ is an
+  ///             element of the \f$ i \f$th set. The pairs may be given in any
+  ///             order and may include duplicates.
+  ///
+  /// \returns    \f$ \{ s_0, s_1, \dots, s_{n-1} \} \f$
+  ///
+  /// \throws invalid_argument If a set identifier is not smaller than `n` or
+  ///                          if an element exceeds `zdd::max_label`.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_from_sets(const size_t n,
+                      const generator<pair<size_t, zdd::label_type>> &sets);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Construct the family of sets given by a stream of (set, element)
+  ///        pairs.
+  ///
+  /// \see zdd_from_sets
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_from_sets(const exec_policy &ep,
+                      const size_t n,
+                      const generator<pair<size_t, zdd::label_type>> &sets);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      The family of all subsets of `vars` with at most `k` elements.
+  ///
+  /// \details    The ZDD is constructed directly in its canonical form. It has
+  ///             \f$ O(n \cdot k) \f$ nodes for \f$ n \f$ variables.
+  ///
+  /// \remark     Requires internal memory as described for `bdd_linear_leq`
+  ///             (with \f$ \mathit{bound} = k \f$).
+  ///
+  /// \param vars Generator of labels of variables in \em descending order.
+  ///             These values can at most be `zdd::max_label`.
+  ///
+  /// \param k    Maximum size of each set.
+  ///
+  /// \returns    \f$ \{ s \subseteq \mathit{vars} \mid |s| \leq k \} \f$
+  ///
+  /// \throws invalid_argument If `vars` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  zdd zdd_atmost(const generator<zdd::label_type> &vars, const uint64_t k);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The family of all subsets of the given variables with at most
+  ///              `k` elements.
+  ///
+  /// \param begin Single-pass forward iterator that provides the variables in
+  ///              \em descending order. All its values should be smaller than
+  ///              or equals to `zdd::max_label`.
+  ///
+  /// \param end   Marks the end for `begin`.
+  ///
+  /// \param k     Maximum size of each set.
+  ///
+  /// \throws invalid_argument If the iterator does not provide values in
+  ///                          descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ForwardIt>
+  inline zdd zdd_atmost(ForwardIt begin, ForwardIt end, const uint64_t k)
+  { return zdd_atmost(make_generator(begin, end), k); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      The family of all subsets of `vars` with exactly `k` elements.
+  ///
+  /// \details    The ZDD is constructed directly in its canonical form. It has
+  ///             \f$ O(n \cdot k) \f$ nodes for \f$ n \f$ variables.
+  ///
+  /// \remark     Requires internal memory as described for `bdd_linear_leq`
+  ///             (with \f$ \mathit{bound} = k \f$).
+  ///
+  /// \param vars Generator of labels of variables in \em descending order.
+  ///             These values can at most be `zdd::max_label`.
+  ///
+  /// \param k    Size of each set.
+  ///
+  /// \returns    \f$ \{ s \subseteq \mathit{vars} \mid |s| = k \} \f$
+  ///
+  /// \throws invalid_argument If `vars` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  zdd zdd_exactly(const generator<zdd::label_type> &vars, const uint64_t k);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The family of all subsets of the given variables with exactly
+  ///              `k` elements.
+  ///
+  /// \param begin Single-pass forward iterator that provides the variables in
+  ///              \em descending order. All its values should be smaller than
+  ///              or equals to `zdd::max_label`.
+  ///
+  /// \param end   Marks the end for `begin`.
+  ///
+  /// \param k     Size of each set.
+  ///
+  /// \throws invalid_argument If the iterator does not provide values in
+  ///                          descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ForwardIt>
+  inline zdd zdd_exactly(ForwardIt begin, ForwardIt end, const uint64_t k)
+  { return zdd_exactly(make_generator(begin, end), k); }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The family of all sets of variables whose total weight is at
+  ///              most `bound`.
+  ///
+  /// \details     The ZDD is constructed directly in its canonical form. Each
+  ///              node corresponds to a distinct reachable remainder of the
+  ///              bound. Hence, it has at most \f$ O(n \cdot \mathit{bound})
+  ///              \f$ nodes for \f$ n \f$ variables.
+  ///
+  /// \remark      Requires internal memory as described for `bdd_linear_leq`.
+  ///
+  /// \param terms Generator of pairs \f$ (x_i, a_i) \f$ of a variable and its
+  ///              weight in \em descending order of their label. The labels
+  ///              can at most be `zdd::max_label`.
+  ///
+  /// \param bound Upper bound on the total weight.
+  ///
+  /// \returns     \f$ \{ s \subseteq \{ x_i \} \mid \sum_{x_i \in s} a_i
+  ///              \leq \mathit{bound} \} \f$
+  ///
+  /// \throws invalid_argument If `terms` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  zdd zdd_linear_leq(const generator<pair<zdd::label_type, uint64_t>> &terms,
+                     const uint64_t bound);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief       The family of all sets of variables whose total weight is at
+  ///              most `bound`.
+  ///
+  /// \param begin Single-pass forward iterator that provides the pairs
+  ///              \f$ (x_i, a_i) \f$ in \em descending order of their label.
+  ///
+  /// \param end   Marks the end for `begin`.
+  ///
+  /// \param bound Upper bound on the total weight.
+  ///
+  /// \throws invalid_argument If the iterator does not provide values in
+  ///                          descending order.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename ForwardIt>
+  inline zdd zdd_linear_leq(ForwardIt begin, ForwardIt end, const uint64_t bound)
+  { return zdd_linear_leq(make_generator(begin, end), bound); }
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
@@ -456,6 +614,84 @@ namespace adiar
   __zdd operator- (__zdd &&, const zdd &);
   /// \endcond
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   The join (unate product) of two families of sets, i.e. the union
+  ///          of every pair of sets.
+  ///
+  /// \details The sets of `A` and `B` are paired up on disjoint copies of their
+  ///          joint support, which are then related to the output by an
+  ///          intersection and a projection sweep.
+  ///
+  /// \returns
+  /// \f$ A \sqcup B = \{ a \cup b \mid a \in A, b \in B \} \f$
+  ///
+  /// \throws invalid_argument If three copies of the joint support of `A` and
+  ///                          `B` do not fit within `zdd::max_label`.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_join(const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The join (unate product) of two families of sets.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_join(const exec_policy &ep, const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   The meet of two families of sets, i.e. the intersection of every
+  ///          pair of sets.
+  ///
+  /// \returns
+  /// \f$ A \sqcap B = \{ a \cap b \mid a \in A, b \in B \} \f$
+  ///
+  /// \throws invalid_argument If three copies of the joint support of `A` and
+  ///                          `B` do not fit within `zdd::max_label`.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_meet(const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The meet of two families of sets.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_meet(const exec_policy &ep, const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   The (weak) division of one family of sets by another, i.e. the
+  ///          largest family `Q` disjoint from `B` for which \f$ Q \sqcup B
+  ///          \subseteq A \f$.
+  ///
+  /// \details Division by the empty family is defined to be the empty family.
+  ///
+  /// \returns
+  /// \f$ A / B = \{ c \mid \forall b \in B : c \cap b = \emptyset \wedge c \cup b
+  ///          \in A \} \f$
+  ///
+  /// \throws invalid_argument If three copies of the joint support of `A` and
+  ///                          `B` do not fit within `zdd::max_label`.
+  ///
+  /// \see zdd_rem
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_div(const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The (weak) division of one family of sets by another.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_div(const exec_policy &ep, const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief   The remainder of the (weak) division of one family of sets by
+  ///          another.
+  ///
+  /// \returns
+  /// \f$ A \setminus (B \sqcup (A / B)) \f$
+  ///
+  /// \see zdd_div
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_rem(const zdd &A, const zdd &B);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The remainder of the (weak) division of one family of sets by
+  ///        another.
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_rem(const exec_policy &ep, const zdd &A, const zdd &B);
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief      The symmetric difference between each set in the family and
   ///             the given set of variables.
@@ -1203,6 +1439,43 @@ namespace adiar
   bool zdd_contains(const zdd &A, ForwardIt begin, ForwardIt end)
   { return zdd_contains(A, make_generator(begin, end)); }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief      Whether the family includes each set of a batch of sets.
+  ///
+  /// \details    All queries are answered within a single sweep through `A`,
+  ///             which is much faster than `n` calls to `zdd_contains`.
+  ///
+  /// \param A    Set of interest
+  ///
+  /// \param n    Number of sets in the batch, i.e. the sets are identified by
+  ///             the numbers `0` to `n-1`.
+  ///
+  /// \param sets Generator of the elements of all sets as pairs of a set's
+  ///             identifier and a label in \em ascending order, i.e. sorted by
+  ///             the identifier first and the label second. A set without any
+  ///             elements is the empty set.
+  ///
+  /// \param out  Consumer of whether \f$ a_i \in A \f$ for each set \f$ a_i \f$
+  ///             in the order of their identifier.
+  ///
+  /// \throws invalid_argument If `sets` is not in ascending order, if an
+  ///                          identifier is not smaller than `n`, or if a label
+  ///                          exceeds `zdd::max_label`.
+  //////////////////////////////////////////////////////////////////////////////
+  void zdd_contains_many(const zdd &A,
+                         const size_t n,
+                         const generator<pair<size_t, zdd::label_type>> &sets,
+                         const consumer<bool> &out);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the family includes each set of a batch of sets.
+  //////////////////////////////////////////////////////////////////////////////
+  void zdd_contains_many(const exec_policy &ep,
+                         const zdd &A,
+                         const size_t n,
+                         const generator<pair<size_t, zdd::label_type>> &sets,
+                         const consumer<bool> &out);
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief   Retrieves the lexicographically smallest set a in A.
   ///
@@ -1392,6 +1665,23 @@ namespace adiar
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \name Shared Forest of ZDDs
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Store of many ZDDs in a single unique node table, i.e. all nodes
+  ///        are shared between them and two ZDDs are equivalent if and only if
+  ///        their roots in the forest are the same.
+  ///
+  /// \see bdd_forest
+  //////////////////////////////////////////////////////////////////////////////
+  using zdd_forest = internal::shared_forest<zdd_policy>;
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 }
@@ -0,0 +1,329 @@
+#include <adiar/zdd.h>
+#include <adiar/zdd/zdd_policy.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <vector>
+
+#include <adiar/builder.h>
+#include <adiar/exception.h>
+#include <adiar/functional.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/algorithms/relabel.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////
+  // The join, meet, and division pair up each set of A with each set of B and
+  // so they are not a single product construction. Instead, we place the sets
+  // of A and B on disjoint copies of their joint support and relate them to a
+  // third copy for the output with a constraint ZDD. The intersection and
+  // projection sweeps then do the actual work. For the ith variable x_i in the
+  // joint support, the three levels
+  //
+  //   3i   : x_i is in the output,
+  //   3i+1 : x_i is in the set of A,
+  //   3i+2 : x_i is in the set of B.
+  //
+  // This mapping is monotone, so moving a ZDD from one copy to another is a
+  // single linear scan that preserves the shape of the ZDD.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr zdd::label_type zdd_algebra_out = 0u;
+  constexpr zdd::label_type zdd_algebra_A   = 1u;
+  constexpr zdd::label_type zdd_algebra_B   = 2u;
+
+  constexpr zdd::label_type zdd_algebra_copies = 3u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Joint support of two families in ascending order.
+  //////////////////////////////////////////////////////////////////////////////
+  inline std::vector<zdd::label_type>
+  __zdd_algebra_support(const zdd &A, const zdd &B)
+  {
+    std::vector<zdd::label_type> a_vars;
+    zdd_support(A, [&a_vars](const zdd::label_type x) { a_vars.push_back(x); });
+
+    std::vector<zdd::label_type> b_vars;
+    zdd_support(B, [&b_vars](const zdd::label_type x) { b_vars.push_back(x); });
+
+    std::vector<zdd::label_type> vars;
+    vars.reserve(a_vars.size() + b_vars.size());
+    std::set_union(a_vars.begin(), a_vars.end(),
+                   b_vars.begin(), b_vars.end(),
+                   std::back_inserter(vars));
+
+    if (zdd::max_label / zdd_algebra_copies < vars.size()) {
+      throw invalid_argument("Joint support is too large to pair up the sets");
+    }
+    return vars;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Labels of all copies of the variables in `vars` other than `copy`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline std::vector<zdd::label_type>
+  __zdd_algebra_others(const size_t vars, const zdd::label_type copy)
+  {
+    std::vector<zdd::label_type> res;
+    res.reserve(vars * (zdd_algebra_copies-1));
+
+    for (size_t i = 0; i < vars; ++i) {
+      for (zdd::label_type c = 0; c < zdd_algebra_copies; ++c) {
+        if (c == copy) { continue; }
+        res.push_back(zdd_algebra_copies * i + c);
+      }
+    }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Move `A` onto the given copy of the variables in `vars`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline zdd
+  __zdd_algebra_to_copy(const zdd &A,
+                        const std::vector<zdd::label_type> &vars,
+                        const zdd::label_type copy)
+  {
+    return internal::relabel<zdd_policy>(A, [&vars, &copy](const zdd::label_type x) {
+      const size_t i =
+        static_cast<size_t>(std::lower_bound(vars.begin(), vars.end(), x) - vars.begin());
+      return static_cast<zdd::label_type>(zdd_algebra_copies * i + copy);
+    });
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Move `A` from the output copy back onto the variables in `vars`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline zdd
+  __zdd_algebra_from_out(const zdd &A, const std::vector<zdd::label_type> &vars)
+  {
+    return internal::relabel<zdd_policy>(A, [&vars](const zdd::label_type x) {
+      adiar_assert(x % zdd_algebra_copies == zdd_algebra_out,
+                   "Only the output copy should be left");
+      return vars[x / zdd_algebra_copies];
+    });
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Project onto all copies except `copy`.
+  //////////////////////////////////////////////////////////////////////////////
+  inline __zdd
+  __zdd_algebra_hide(const exec_policy &ep, zdd &&A, const zdd::label_type copy)
+  {
+    return zdd_project(ep, std::move(A), [copy](const zdd::label_type x) {
+      return x % zdd_algebra_copies != copy;
+    });
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Project onto the output copy.
+  //////////////////////////////////////////////////////////////////////////////
+  inline __zdd
+  __zdd_algebra_out(const exec_policy &ep, zdd &&A)
+  {
+    return zdd_project(ep, std::move(A), [](const zdd::label_type x) {
+      return x % zdd_algebra_copies == zdd_algebra_out;
+    });
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Constraint on each block of three levels, i.e. the family of all
+  ///        sets where `allowed(out, a, b)` holds for the three copies of
+  ///        every variable.
+  ///
+  /// \pre `allowed(false, false, false)` holds.
+  //////////////////////////////////////////////////////////////////////////////
+  template<typename Allowed>
+  zdd
+  __zdd_algebra_constraint(const size_t vars, const Allowed &allowed)
+  {
+    adiar_assert(allowed(false, false, false),
+                 "Skipping a block should be allowed in a ZDD");
+
+    zdd_builder b;
+
+    const zdd_ptr terminal_F = b.add_node(false);
+    zdd_ptr next = b.add_node(true);
+
+    for (size_t i = vars; 0 < i; --i) {
+      const zdd::label_type x_out = zdd_algebra_copies * (i-1) + zdd_algebra_out;
+      const zdd::label_type x_A   = zdd_algebra_copies * (i-1) + zdd_algebra_A;
+      const zdd::label_type x_B   = zdd_algebra_copies * (i-1) + zdd_algebra_B;
+
+      // Nodes for the B copy are identified by which of their children are
+      // not suppressed. Each distinct one is only created once (and only if
+      // used, since the builder does not allow for unreferenced nodes).
+      const auto b_sig = [&allowed](const bool out, const bool a) -> size_t {
+        return (allowed(out, a, false) ? 2 : 0) | (allowed(out, a, true) ? 1 : 0);
+      };
+
+      std::array<zdd_ptr, 4> b_nodes;
+      std::array<bool, 4> b_made = { false, false, false, false };
+      for (size_t out = 0; out < 2; ++out) {
+        for (size_t a = 0; a < 2; ++a) {
+          const size_t sig = b_sig(out, a);
+          if (b_made[sig]) { continue; }
+
+          b_nodes[sig] = b.add_node(x_B, sig & 2 ? next : terminal_F,
+                                         sig & 1 ? next : terminal_F);
+          b_made[sig] = true;
+        }
+      }
+
+      // Nodes for the A copy are similarly identified by their children.
+      std::array<zdd_ptr, 2> a_nodes;
+      std::array<size_t, 2> a_sigs;
+      for (size_t out = 0; out < 2; ++out) {
+        a_sigs[out] = (b_sig(out, false) << 2) | b_sig(out, true);
+        a_nodes[out] = out == 1 && a_sigs[0] == a_sigs[1]
+          ? a_nodes[0]
+          : b.add_node(x_A, b_nodes[b_sig(out, false)], b_nodes[b_sig(out, true)]);
+      }
+
+      next = b.add_node(x_out, a_nodes[false], a_nodes[true]);
+    }
+    return b.build();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_join(const exec_policy &ep, const zdd &A, const zdd &B)
+  {
+    // Resolve terminal cases
+    if (zdd_isempty(A) || zdd_isempty(B)) { return zdd_empty(); }
+    if (zdd_isnull(A)) { return B; }
+    if (zdd_isnull(B)) { return A; }
+
+    // Pair up all sets and constrain the output copy to be their union
+    const std::vector<zdd::label_type> vars = __zdd_algebra_support(A, B);
+
+    const std::vector<zdd::label_type> not_A = __zdd_algebra_others(vars.size(), zdd_algebra_A);
+    const std::vector<zdd::label_type> not_B = __zdd_algebra_others(vars.size(), zdd_algebra_B);
+
+    const zdd constraint =
+      __zdd_algebra_constraint(vars.size(), [](bool out, bool a, bool b) {
+        return out == (a || b);
+      });
+
+    zdd pairs = zdd_intsec(ep,
+                           zdd_expand(ep, __zdd_algebra_to_copy(A, vars, zdd_algebra_A),
+                                      not_A.begin(), not_A.end()),
+                           constraint);
+    pairs = zdd_intsec(ep,
+                       pairs,
+                       zdd_expand(ep, __zdd_algebra_to_copy(B, vars, zdd_algebra_B),
+                                  not_B.begin(), not_B.end()));
+
+    return __zdd_algebra_from_out(__zdd_algebra_out(ep, std::move(pairs)), vars);
+  }
+
+  __zdd zdd_join(const zdd &A, const zdd &B)
+  {
+    return zdd_join(exec_policy(), A, B);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_meet(const exec_policy &ep, const zdd &A, const zdd &B)
+  {
+    // Resolve terminal cases
+    if (zdd_isempty(A) || zdd_isempty(B)) { return zdd_empty(); }
+    if (zdd_isnull(A) || zdd_isnull(B)) { return zdd_null(); }
+
+    // Pair up all sets and constrain the output copy to be their intersection
+    const std::vector<zdd::label_type> vars = __zdd_algebra_support(A, B);
+
+    const std::vector<zdd::label_type> not_A = __zdd_algebra_others(vars.size(), zdd_algebra_A);
+    const std::vector<zdd::label_type> not_B = __zdd_algebra_others(vars.size(), zdd_algebra_B);
+
+    const zdd constraint =
+      __zdd_algebra_constraint(vars.size(), [](bool out, bool a, bool b) {
+        return out == (a && b);
+      });
+
+    zdd pairs = zdd_intsec(ep,
+                           zdd_expand(ep, __zdd_algebra_to_copy(A, vars, zdd_algebra_A),
+                                      not_A.begin(), not_A.end()),
+                           constraint);
+    pairs = zdd_intsec(ep,
+                       pairs,
+                       zdd_expand(ep, __zdd_algebra_to_copy(B, vars, zdd_algebra_B),
+                                  not_B.begin(), not_B.end()));
+
+    return __zdd_algebra_from_out(__zdd_algebra_out(ep, std::move(pairs)), vars);
+  }
+
+  __zdd zdd_meet(const zdd &A, const zdd &B)
+  {
+    return zdd_meet(exec_policy(), A, B);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_div(const exec_policy &ep, const zdd &A, const zdd &B)
+  {
+    // Resolve terminal cases
+    if (zdd_isempty(A) || zdd_isempty(B)) { return zdd_empty(); }
+    if (zdd_isnull(B)) { return A; }
+
+    const std::vector<zdd::label_type> vars = __zdd_algebra_support(A, B);
+
+    const std::vector<zdd::label_type> not_A = __zdd_algebra_others(vars.size(), zdd_algebra_A);
+
+    std::vector<zdd::label_type> out_vars;
+    out_vars.reserve(vars.size());
+    for (size_t i = 0; i < vars.size(); ++i) {
+      out_vars.push_back(zdd_algebra_copies * i + zdd_algebra_out);
+    }
+
+    std::vector<zdd::label_type> B_vars;
+    B_vars.reserve(vars.size());
+    for (size_t i = 0; i < vars.size(); ++i) {
+      B_vars.push_back(zdd_algebra_copies * i + zdd_algebra_B);
+    }
+
+    // All pairs (c, b) where c and b are disjoint and c ∪ b is in A.
+    const zdd constraint =
+      __zdd_algebra_constraint(vars.size(), [](bool out, bool a, bool b) {
+        return !(out && b) && a == (out || b);
+      });
+
+    zdd good = zdd_intsec(ep,
+                          zdd_expand(ep, __zdd_algebra_to_copy(A, vars, zdd_algebra_A),
+                                     not_A.begin(), not_A.end()),
+                          constraint);
+    good = __zdd_algebra_hide(ep, std::move(good), zdd_algebra_A);
+
+    // ... restricted to b in B.
+    const zdd B_pairs = zdd_expand(ep, __zdd_algebra_to_copy(B, vars, zdd_algebra_B),
+                                   out_vars.begin(), out_vars.end());
+    good = zdd_intsec(ep, good, B_pairs);
+
+    // Candidates c are those that are part of some good pair. Of these, we
+    // need to remove every c that is paired badly with some b in B.
+    const zdd candidates = __zdd_algebra_out(ep, zdd(good));
+
+    zdd bad = zdd_intsec(ep,
+                         zdd_expand(ep, candidates, B_vars.begin(), B_vars.end()),
+                         B_pairs);
+    bad = zdd_diff(ep, bad, good);
+
+    const zdd res = zdd_diff(ep, candidates, __zdd_algebra_out(ep, std::move(bad)));
+    return __zdd_algebra_from_out(res, vars);
+  }
+
+  __zdd zdd_div(const zdd &A, const zdd &B)
+  {
+    return zdd_div(exec_policy(), A, B);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  __zdd zdd_rem(const exec_policy &ep, const zdd &A, const zdd &B)
+  {
+    return zdd_diff(ep, A, zdd_join(ep, B, zdd_div(ep, A, B)));
+  }
+
+  __zdd zdd_rem(const zdd &A, const zdd &B)
+  {
+    return zdd_rem(exec_policy(), A, B);
+  }
+}
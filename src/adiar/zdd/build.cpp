@@ -1,12 +1,21 @@
 #include <adiar/zdd.h>
 
+#include <algorithm>
 #include <limits>
 
 #include <adiar/zdd/zdd_policy.h>
 #include <adiar/domain.h>
+#include <adiar/exception.h>
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/algorithms/build.h>
+#include <adiar/internal/data_types/arc.h>
+#include <adiar/internal/data_types/level_info.h>
+#include <adiar/internal/io/arc_file.h>
+#include <adiar/internal/io/arc_writer.h>
+#include <adiar/internal/io/file.h>
+#include <adiar/internal/io/file_stream.h>
+#include <adiar/internal/io/file_writer.h>
 
 namespace adiar
 {
@@ -183,4 +192,360 @@ namespace adiar
 
     return zdd_powerset(make_generator(ds));
   }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Bulk construction of a family of sets from an unsorted stream of (set-id,
+  // element) pairs. The sets are placed in a trie where each node is a prefix
+  // of one or more of the (sorted) sets. The children of a prefix are linked
+  // together with low arcs in ascending order of their label while the high arc
+  // of a prefix points to its first child. This is an unreduced ZDD with the
+  // arcs already in the shape the Reduce algorithm needs, which then merges
+  // all common suffixes.
+  //
+  // The trie is built one depth at a time: the ith element of every set is
+  // grouped by the prefix of the set's first i-1 elements and sorted within
+  // that group. Since every element is part of a single round, the entire
+  // construction only takes O(sort(N)) I/Os for N pairs.
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief An element of a set together with its position within the set.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_from_sets_elem
+  {
+    size_t set;
+    zdd::label_type label;
+
+    /// Index of `label` within the sorted set
+    size_t depth;
+
+    /// Whether `label` is the set's largest element
+    bool last;
+
+    zdd_from_sets_elem operator! () const
+    { return *this; }
+  };
+
+  struct zdd_from_sets_set_lt
+  {
+    bool operator() (const zdd_from_sets_elem &a, const zdd_from_sets_elem &b) const
+    { return a.set < b.set || (a.set == b.set && a.label < b.label); }
+  };
+
+  struct zdd_from_sets_depth_lt
+  {
+    bool operator() (const zdd_from_sets_elem &a, const zdd_from_sets_elem &b) const
+    { return a.depth < b.depth || (a.depth == b.depth && a.set < b.set); }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The prefix (and its label) a set currently is placed in.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_from_sets_group
+  {
+    size_t set;
+    size_t prefix;
+    zdd::label_type label;
+
+    zdd_from_sets_group operator! () const
+    { return *this; }
+  };
+
+  struct zdd_from_sets_group_lt
+  {
+    bool operator() (const zdd_from_sets_group &a, const zdd_from_sets_group &b) const
+    { return a.set < b.set; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The next element of a set that is placed in the prefix `parent`.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_from_sets_token
+  {
+    size_t parent;
+    zdd::label_type parent_label;
+    zdd::label_type label;
+    size_t set;
+    bool last;
+
+    zdd_from_sets_token operator! () const
+    { return *this; }
+  };
+
+  struct zdd_from_sets_token_lt
+  {
+    bool operator() (const zdd_from_sets_token &a, const zdd_from_sets_token &b) const
+    {
+      return a.parent < b.parent
+        || (a.parent == b.parent && (a.label < b.label
+                                     || (a.label == b.label && a.set < b.set)));
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A prefix, i.e. a node of the trie.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_from_sets_prefix
+  {
+    size_t id;
+    zdd::label_type label;
+    size_t parent;
+    zdd::label_type parent_label;
+
+    zdd_from_sets_prefix operator! () const
+    { return *this; }
+  };
+
+  struct zdd_from_sets_children_lt
+  {
+    bool operator() (const zdd_from_sets_prefix &a, const zdd_from_sets_prefix &b) const
+    { return a.parent < b.parent || (a.parent == b.parent && a.label < b.label); }
+  };
+
+  struct zdd_from_sets_level_lt
+  {
+    bool operator() (const zdd_from_sets_prefix &a, const zdd_from_sets_prefix &b) const
+    { return a.label < b.label; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Identifier of the empty prefix, i.e. the trie's (virtual) root.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr size_t zdd_from_sets_root = 0u;
+
+  __zdd zdd_from_sets(const exec_policy &ep,
+                      const size_t n,
+                      const generator<pair<size_t, zdd::label_type>> &sets)
+  {
+    // -------------------------------------------------------------------------
+    // Sort all pairs by their set and derive each element's position
+    internal::shared_file<zdd_from_sets_elem> elems;
+    {
+      internal::shared_file<zdd_from_sets_elem> pairs;
+      {
+        internal::file_writer<zdd_from_sets_elem> pw(pairs);
+        for (optional<pair<size_t, zdd::label_type>> x = sets(); x; x = sets()) {
+          if (n <= x.value().first) {
+            throw invalid_argument("Set identifiers must be smaller than the number of sets");
+          }
+          if (zdd::max_label < x.value().second) {
+            throw invalid_argument("Labels must be smaller than or equal to 'zdd::max_label'");
+          }
+          pw << zdd_from_sets_elem{ x.value().first, x.value().second, 0u, false };
+        }
+      }
+      pairs->sort(zdd_from_sets_set_lt());
+
+      internal::file_writer<zdd_from_sets_elem> ew(elems);
+      internal::file_stream<zdd_from_sets_elem> ps(pairs);
+
+      size_t depth = 0u;
+      while (ps.can_pull()) {
+        zdd_from_sets_elem e = ps.pull();
+
+        // Skip duplicates
+        while (ps.can_pull() && ps.peek().set == e.set && ps.peek().label == e.label) {
+          ps.pull();
+        }
+
+        e.depth = depth;
+        e.last  = !ps.can_pull() || ps.peek().set != e.set;
+        ew << e;
+
+        depth = e.last ? 0u : depth + 1u;
+      }
+    }
+
+    // Distinct non-empty sets are exactly the elements at depth 0.
+    size_t nonempty_sets = 0u;
+    elems->sort(zdd_from_sets_depth_lt());
+    {
+      internal::file_stream<zdd_from_sets_elem> es(elems);
+      while (es.can_pull() && es.peek().depth == 0u) {
+        es.pull();
+        nonempty_sets++;
+      }
+    }
+
+    if (nonempty_sets == 0u) {
+      return zdd_terminal(0u < n);
+    }
+    const bool has_empty = nonempty_sets < n;
+
+    // -------------------------------------------------------------------------
+    // Create the prefixes of the trie one depth at a time.
+    internal::shared_file<zdd_from_sets_prefix> prefixes;
+    internal::shared_file<zdd_from_sets_prefix> children;
+    internal::shared_file<size_t> ends;
+    {
+      internal::file_writer<zdd_from_sets_prefix> pw(prefixes);
+      internal::file_writer<zdd_from_sets_prefix> cw(children);
+      internal::file_writer<size_t> endw(ends);
+
+      size_t prefix = zdd_from_sets_root;
+
+      internal::file_stream<zdd_from_sets_elem> es(elems);
+      internal::shared_file<zdd_from_sets_group> groups;
+
+      for (size_t depth = 0u; es.can_pull(); ++depth) {
+        // Place the next element of each set in the prefix of the set
+        internal::shared_file<zdd_from_sets_token> tokens;
+        {
+          internal::file_writer<zdd_from_sets_token> tw(tokens);
+          internal::file_stream<zdd_from_sets_group> gs(groups);
+
+          while (es.can_pull() && es.peek().depth == depth) {
+            const zdd_from_sets_elem e = es.pull();
+
+            zdd_from_sets_group g = { e.set, zdd_from_sets_root, 0u };
+            if (depth > 0u) {
+              do { g = gs.pull(); } while (g.set < e.set);
+              adiar_assert(g.set == e.set, "Set must have a prefix of length 'depth'");
+            }
+            tw << zdd_from_sets_token{ g.prefix, g.label, e.label, e.set, e.last };
+          }
+        }
+        tokens->sort(zdd_from_sets_token_lt());
+
+        // Create a new prefix for each distinct (parent, label) pair
+        internal::shared_file<zdd_from_sets_group> next_groups;
+        {
+          internal::file_writer<zdd_from_sets_group> gw(next_groups);
+          internal::file_stream<zdd_from_sets_token> ts(tokens);
+
+          bool has_prev = false;
+          bool prev_end = false;
+          zdd_from_sets_token prev{};
+
+          while (ts.can_pull()) {
+            const zdd_from_sets_token t = ts.pull();
+
+            if (!has_prev || prev.parent != t.parent || prev.label != t.label) {
+              if (zdd::max_id <= prefix) {
+                throw out_of_range("Number of distinct prefixes exceeds 'zdd::max_id'");
+              }
+              const zdd_from_sets_prefix p = { ++prefix, t.label, t.parent, t.parent_label };
+              pw << p;
+              cw << p;
+              prev_end = false;
+            }
+            if (t.last && !prev_end) {
+              endw << prefix;
+              prev_end = true;
+            }
+            if (!t.last) {
+              gw << zdd_from_sets_group{ t.set, prefix, t.label };
+            }
+            has_prev = true;
+            prev = t;
+          }
+        }
+        next_groups->sort(zdd_from_sets_group_lt());
+        groups = next_groups;
+      }
+    }
+    children->sort(zdd_from_sets_children_lt());
+
+    // -------------------------------------------------------------------------
+    // Link up the prefixes as the nodes of an (unreduced) ZDD.
+    using arc = internal::arc;
+
+    internal::shared_levelized_file<arc> af;
+    size_t internal_arcs = 0u;
+    {
+      internal::arc_writer aw(af);
+
+      internal::shared_file<arc> internal_af;
+      {
+        internal::file_writer<arc> iw(internal_af);
+
+        internal::file_stream<zdd_from_sets_prefix> cs(children);
+        internal::file_stream<zdd_from_sets_prefix> ps(prefixes);
+        internal::file_stream<size_t> ends_s(ends);
+
+        const auto leaf = [&aw](const zdd_from_sets_prefix &p) {
+          aw.push_terminal(arc(arc::uid_type(p.label, p.id), true, arc::pointer_type(true)));
+        };
+
+        while (cs.can_pull()) {
+          const size_t parent = cs.peek().parent;
+
+          // All prefixes prior to 'parent' have no children
+          while (ps.can_pull() && ps.peek().id < parent) { leaf(ps.pull()); }
+          if (ps.can_pull() && ps.peek().id == parent) { ps.pull(); }
+
+          zdd_from_sets_prefix c = cs.pull();
+
+          if (parent != zdd_from_sets_root) {
+            iw << arc(arc::uid_type(c.parent_label, parent), true,
+                      arc::pointer_type(c.label, c.id));
+            internal_arcs++;
+          }
+
+          while (cs.can_pull() && cs.peek().parent == parent) {
+            const zdd_from_sets_prefix next = cs.pull();
+            iw << arc(arc::uid_type(c.label, c.id), false,
+                      arc::pointer_type(next.label, next.id));
+            internal_arcs++;
+            c = next;
+          }
+
+          // The prefix itself may also be one of the sets
+          while (ends_s.can_pull() && ends_s.peek() < parent) { ends_s.pull(); }
+          const bool is_end = parent == zdd_from_sets_root
+            ? has_empty
+            : ends_s.can_pull() && ends_s.peek() == parent;
+
+          aw.push_terminal(arc(arc::uid_type(c.label, c.id), false, arc::pointer_type(is_end)));
+        }
+        while (ps.can_pull()) { leaf(ps.pull()); }
+      }
+      internal_af->sort(internal::arc_target_lt());
+
+      internal::file_stream<arc> is(internal_af);
+      while (is.can_pull()) { aw.push_internal(is.pull()); }
+
+      // Each level's width is the number of prefixes with that label
+      prefixes->sort(zdd_from_sets_level_lt());
+
+      internal::file_stream<zdd_from_sets_prefix> ls(prefixes);
+      while (ls.can_pull()) {
+        const zdd::label_type label = ls.pull().label;
+
+        size_t width = 1u;
+        while (ls.can_pull() && ls.peek().label == label) {
+          ls.pull();
+          width++;
+        }
+        aw.push(internal::level_info(label, width));
+      }
+    }
+
+    // Sets passing through the prefixes below a 1-level cut are disjoint.
+    af->max_1level_cut = std::min(internal_arcs, nonempty_sets);
+
+    return __zdd(af, ep);
+  }
+
+  __zdd zdd_from_sets(const size_t n,
+                      const generator<pair<size_t, zdd::label_type>> &sets)
+  {
+    return zdd_from_sets(exec_policy(), n, sets);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  zdd zdd_atmost(const generator<zdd::label_type> &vars, const uint64_t k)
+  {
+    return internal::build_linear<zdd_policy>(vars, 0u, k);
+  }
+
+  zdd zdd_exactly(const generator<zdd::label_type> &vars, const uint64_t k)
+  {
+    return internal::build_linear<zdd_policy>(vars, k, k);
+  }
+
+  zdd zdd_linear_leq(const generator<pair<zdd::label_type, uint64_t>> &terms,
+                     const uint64_t bound)
+  {
+    return internal::build_linear<zdd_policy>(terms, 0u, bound);
+  }
 }
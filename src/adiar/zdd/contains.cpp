@@ -1,8 +1,19 @@
 #include <adiar/zdd.h>
 
+#include <algorithm>
+#include <vector>
+
+#include <adiar/exception.h>
+
+#include <adiar/internal/memory.h>
+#include <adiar/internal/algorithms/count.h>
 #include <adiar/internal/algorithms/traverse.h>
+#include <adiar/internal/data_structures/priority_queue.h>
 #include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/file.h>
 #include <adiar/internal/io/file_stream.h>
+#include <adiar/internal/io/file_writer.h>
+#include <adiar/internal/io/node_stream.h>
 
 namespace adiar
 {
@@ -70,4 +81,303 @@ namespace adiar
     internal::traverse(zdd, v);
     return v.get_result();
   }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Batched membership as a variant of the Count algorithm: each query is
+  // forwarded as a request (query-id, next label) through the levelized
+  // priority queue. Every query has exactly one request in flight and only
+  // needs to know the next label it still has to match. When that label is
+  // matched, the label after it is looked up in the query's elements, which
+  // are sorted by (label, query-id) for this purpose such that the lookups of
+  // a level are merged with them in a single scan.
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Placeholder label for a query with no more elements to match.
+  //////////////////////////////////////////////////////////////////////////////
+  constexpr zdd::label_type zdd_contains_many_none = zdd::max_label + 1u;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// Auxiliary data for the Priority Queue in the batched membership.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_contains_many_data
+  {
+    /// Identifier of the query
+    size_t query;
+
+    /// Next label of the query that is yet to be matched
+    zdd::label_type next;
+
+    static constexpr bool sort_on_tiebreak = false;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// An element of a query together with the query's next element.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_contains_many_elem
+  {
+    zdd::label_type label;
+    size_t query;
+    zdd::label_type next;
+
+    /// Ordered by the label first and only then by the query
+    bool operator< (const zdd_contains_many_elem &o) const
+    { return this->label < o.label || (this->label == o.label && this->query < o.query); }
+
+    zdd_contains_many_elem operator! () const
+    { return *this; }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// A query that has matched the label of the current level and needs to
+  /// look up its next element before continuing to `target`.
+  //////////////////////////////////////////////////////////////////////////////
+  struct zdd_contains_many_lookup
+  {
+    size_t query;
+    zdd::pointer_type target;
+  };
+
+  struct zdd_contains_many_lookup_lt
+  {
+    bool operator() (const zdd_contains_many_lookup &a,
+                     const zdd_contains_many_lookup &b) const
+    {
+      return a.query < b.query;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// Validation of the (query, label) pairs of the batched membership, such
+  /// that the same input is rejected independently of the shape of the ZDD.
+  //////////////////////////////////////////////////////////////////////////////
+  class zdd_contains_many_checker
+  {
+    const size_t _queries;
+    optional<pair<size_t, zdd::label_type>> _prev;
+
+  public:
+    zdd_contains_many_checker(const size_t queries)
+      : _queries(queries)
+    { }
+
+    void operator() (const pair<size_t, zdd::label_type> &x)
+    {
+      const size_t query = x.first;
+      const zdd::label_type label = x.second;
+
+      if (_queries <= query) {
+        throw invalid_argument("Query identifiers must be smaller than the number of queries");
+      }
+      if (zdd::max_label < label) {
+        throw invalid_argument("Labels must be smaller than or equal to 'zdd::max_label'");
+      }
+      if (_prev && (query < _prev.value().first
+                    || (query == _prev.value().first && label <= _prev.value().second))) {
+        throw invalid_argument("Queries must be given in ascending order");
+      }
+      _prev = x;
+    }
+  };
+
+  template<typename PriorityQueue, typename LookupQueue>
+  internal::shared_file<size_t>
+  __zdd_contains_many(const zdd &A,
+                      const size_t queries,
+                      const generator<pair<size_t, zdd::label_type>> &sets,
+                      const size_t pq_max_memory,
+                      const size_t pq_max_size)
+  {
+    // Set up output: the queries that are included in A
+    internal::shared_file<size_t> members;
+    internal::file_writer<size_t> mw(members);
+
+    // Set up input
+    internal::node_stream<> ns(A);
+    const zdd::pointer_type root = ns.peek().uid();
+
+    // Set up cross-level priority queue and the per-level lookups
+    PriorityQueue contains_pq({A}, pq_max_memory / 2u, pq_max_size, internal::stats_count.lpq);
+    LookupQueue lookup_pq(pq_max_memory / 2u, pq_max_size);
+
+    const auto forward = [&](const zdd::pointer_type &target,
+                             const size_t query,
+                             const zdd::label_type next) {
+      if (target.is_terminal()) {
+        if (target.value() && next == zdd_contains_many_none) { mw << query; }
+      } else if (target.label() <= next) {
+        contains_pq.push({ {target}, {}, { query, next } });
+      }
+      // Otherwise, the query misses the level of its next label.
+    };
+
+    // Split up the queries into their elements and start each query at the root
+    internal::shared_file<zdd_contains_many_elem> elems;
+    {
+      internal::file_writer<zdd_contains_many_elem> ew(elems);
+
+      size_t started = 0u;
+      optional<zdd_contains_many_elem> prev;
+      zdd_contains_many_checker check(queries);
+
+      for (optional<pair<size_t, zdd::label_type>> x = sets(); x; x = sets()) {
+        check(x.value());
+
+        const size_t query = x.value().first;
+        const zdd::label_type label = x.value().second;
+
+        if (prev && prev.value().query == query) {
+          ew << zdd_contains_many_elem{ prev.value().label, query, label };
+        } else {
+          if (prev) {
+            ew << zdd_contains_many_elem{ prev.value().label, prev.value().query,
+                                          zdd_contains_many_none };
+          }
+          for (; started < query; ++started) {
+            forward(root, started, zdd_contains_many_none);
+          }
+          forward(root, query, label);
+          started = query + 1u;
+        }
+        prev = make_optional<zdd_contains_many_elem>({ label, query, label });
+      }
+      if (prev) {
+        ew << zdd_contains_many_elem{ prev.value().label, prev.value().query,
+                                      zdd_contains_many_none };
+      }
+      for (; started < queries; ++started) {
+        forward(root, started, zdd_contains_many_none);
+      }
+    }
+    elems->sort();
+
+    internal::file_stream<zdd_contains_many_elem> es(elems);
+
+    while (!contains_pq.empty()) {
+      contains_pq.setup_next_level();
+
+      const zdd::label_type level = contains_pq.current_level();
+
+      while (!contains_pq.empty_level()) {
+        const typename PriorityQueue::value_type request = contains_pq.top();
+
+        // Skip nodes no query reaches
+        while (ns.peek().uid() != request.target.first()) { ns.pull(); }
+        const zdd::node_type n = ns.pull();
+
+        // Split the queries between the children
+        while (contains_pq.can_pull() && contains_pq.top().target == request.target) {
+          const zdd_contains_many_data d = contains_pq.pull().data;
+
+          if (d.next == level) {
+            lookup_pq.push({ d.query, n.high() });
+          } else {
+            forward(n.low(), d.query, d.next);
+          }
+        }
+      }
+
+      // Look up the next label of all queries that went high
+      while (!lookup_pq.empty()) {
+        const zdd_contains_many_lookup l = lookup_pq.top();
+        lookup_pq.pop();
+
+        const zdd_contains_many_elem e = es.seek(zdd_contains_many_elem{ level, l.query, 0u });
+        adiar_assert(e.label == level && e.query == l.query,
+                     "Element of a query must exist");
+
+        forward(l.target, l.query, e.next);
+      }
+    }
+
+    mw.detach();
+    members->sort();
+
+    return members;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Output the result of each of the `n` queries in order.
+  //////////////////////////////////////////////////////////////////////////////
+  inline void
+  __zdd_contains_many_output(const internal::shared_file<size_t> &members,
+                             const size_t n,
+                             const consumer<bool> &out)
+  {
+    internal::file_stream<size_t> ms(members);
+    for (size_t q = 0u; q < n; ++q) {
+      const bool is_member = ms.can_pull() && ms.peek() == q;
+      if (is_member) { ms.pull(); }
+      out(is_member);
+    }
+  }
+
+  void zdd_contains_many(const exec_policy &ep,
+                         const zdd &A,
+                         const size_t n,
+                         const generator<pair<size_t, zdd::label_type>> &sets,
+                         const consumer<bool> &out)
+  {
+    if (zdd_isterminal(A)) {
+      // Only the queries for Ø can be in { Ø }.
+      std::vector<bool> empty_query(n, true);
+      zdd_contains_many_checker check(n);
+
+      for (optional<pair<size_t, zdd::label_type>> x = sets(); x; x = sets()) {
+        check(x.value());
+        empty_query[x.value().first] = false;
+      }
+
+      const bool is_null = zdd_isnull(A);
+      for (size_t q = 0u; q < n; ++q) { out(is_null && empty_query[q]); }
+      return;
+    }
+
+    using data_type = zdd_contains_many_data;
+
+    // Compute amount of memory available for auxiliary data structures after
+    // having opened all streams.
+    const size_t aux_available_memory = internal::memory_available(ep)
+      - internal::node_stream<>::memory_usage()
+      - internal::file_stream<zdd_contains_many_elem>::memory_usage()
+      - 2u * internal::file_writer<size_t>::memory_usage();
+
+    const size_t pq_memory_fits = std::min(
+      internal::count_priority_queue_t<data_type, ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Internal>
+        ::memory_fits(aux_available_memory / 2u),
+      internal::internal_priority_queue<zdd_contains_many_lookup, zdd_contains_many_lookup_lt>
+        ::memory_fits(aux_available_memory / 2u));
+
+    const bool internal_only = ep.memory_mode() == exec_policy::memory::Internal;
+    const bool external_only = ep.memory_mode() == exec_policy::memory::External;
+
+    // Each query has at most one request in flight.
+    const size_t pq_bound = std::max<size_t>(n, 1u);
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if(!external_only && max_pq_size <= internal::no_lookahead_bound()) {
+      __zdd_contains_many_output(__zdd_contains_many
+        <internal::count_priority_queue_t<data_type, 0, internal::memory_mode::Internal>,
+         internal::internal_priority_queue<zdd_contains_many_lookup, zdd_contains_many_lookup_lt>>
+        (A, n, sets, aux_available_memory, max_pq_size), n, out);
+    } else if(!external_only && max_pq_size <= pq_memory_fits) {
+      __zdd_contains_many_output(__zdd_contains_many
+        <internal::count_priority_queue_t<data_type, ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Internal>,
+         internal::internal_priority_queue<zdd_contains_many_lookup, zdd_contains_many_lookup_lt>>
+        (A, n, sets, aux_available_memory, max_pq_size), n, out);
+    } else {
+      __zdd_contains_many_output(__zdd_contains_many
+        <internal::count_priority_queue_t<data_type, ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::External>,
+         internal::external_priority_queue<zdd_contains_many_lookup, zdd_contains_many_lookup_lt>>
+        (A, n, sets, aux_available_memory, max_pq_size), n, out);
+    }
+  }
+
+  void zdd_contains_many(const zdd &A,
+                         const size_t n,
+                         const generator<pair<size_t, zdd::label_type>> &sets,
+                         const consumer<bool> &out)
+  {
+    zdd_contains_many(exec_policy(), A, n, sets, out);
+  }
 }
@@ -69,53 +69,12 @@ namespace adiar
   }
 
   //////////////////////////////////////////////////////////////////////////////
-  template<internal::cut::type ct_1, internal::cut::type ct_2>
-  class ignore_levels
-  {
-  public:
-    static size_t pq1_upper_bound(const internal::shared_levelized_file<zdd::node_type> &in_1,
-                                  const internal::shared_levelized_file<zdd::node_type> &in_2)
-    {
-      const internal::safe_size_t max_2level_cut_1 = in_1->max_2level_cut[ct_1];
-      const internal::safe_size_t max_2level_cut_2 = in_2->max_2level_cut[ct_2];
-
-      return internal::to_size(max_2level_cut_1 * max_2level_cut_2);
-    }
-
-    static size_t pq2_upper_bound(const internal::shared_levelized_file<zdd::node_type> &in_1,
-                                  const internal::shared_levelized_file<zdd::node_type> &in_2)
-    {
-      const internal::safe_size_t max_1level_cut_1 = in_1->max_1level_cut[ct_1];
-      const internal::safe_size_t max_1level_cut_2 = in_2->max_1level_cut[ct_2];
-
-      return internal::to_size(max_1level_cut_1 * max_1level_cut_2);
-    }
-
-    static constexpr size_t memory_usage()
-    {
-      return 0u;
-    }
-
-  public:
-    ignore_levels(const internal::shared_levelized_file<zdd::node_type> &/*f1*/,
-                  const internal::shared_levelized_file<zdd::node_type> &/*f2*/)
-    { /* do nothing */ }
-
-    void next_level(zdd::label_type /* level */)
-    { /* do nothing */ }
-
-    bool on_step()
-    { return false; }
-
-    static constexpr bool termination_value = false;
-  };
-
   class zdd_subseteq_policy
     : public zdd_policy
     , public internal::prod2_mixed_level_merger<zdd_policy>
   {
   public:
-    using level_check_t = ignore_levels<internal::cut::Internal_True, internal::cut::Internal_True>;
+    using level_check_t = internal::ignore_levels<internal::cut::Internal_True, internal::cut::Internal_True>;
 
   public:
     static constexpr size_t lookahead_bound()
@@ -208,7 +167,7 @@ namespace adiar
     , public internal::prod2_mixed_level_merger<zdd_policy>
   {
   public:
-    using level_check_t = ignore_levels<internal::cut::All, internal::cut::All>;
+    using level_check_t = internal::ignore_levels<internal::cut::All, internal::cut::All>;
 
   public:
     static constexpr size_t lookahead_bound()
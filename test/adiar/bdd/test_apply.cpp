@@ -1926,7 +1926,7 @@ go_bandit([]() {
           //      T F   F F    F T
           */
 
-          __bdd out = bdd_xor(bdd_ra, bdd_0xnor2);
+          __bdd out = bdd_xor(ep, bdd_ra, bdd_0xnor2);
 
 
           arc_test_stream arcs(out);
@@ -1,5 +1,7 @@
 #include "../../test.h"
 
+#include <vector>
+
 go_bandit([]() {
   describe("adiar/bdd/build.cpp", []() {
     ptr_uint64 terminal_T = ptr_uint64(true);
@@ -2182,5 +2184,193 @@ go_bandit([]() {
         AssertThat(res->number_of_terminals[true],  Is().EqualTo(1u));
       });
     });
+
+    describe("bdd_from_cubes(n, cubes)", [&]() {
+      using literals_t = std::vector<pair<size_t, pair<bdd::label_type, bool>>>;
+
+      it("creates false for no cubes", [&]() {
+        const literals_t in = {};
+        const bdd res = bdd_from_cubes(0, make_generator(in.begin(), in.end()));
+        AssertThat(bdd_isfalse(res), Is().True());
+      });
+
+      it("creates true for an empty cube", [&]() {
+        const literals_t in = { {0, {1, false}} };
+        const bdd res = bdd_from_cubes(2, make_generator(in.begin(), in.end()));
+        AssertThat(bdd_istrue(res), Is().True());
+      });
+
+      it("creates a single cube [x1 & !x3]", [&]() {
+        const literals_t in = { {0, {3, true}}, {0, {1, false}} };
+        const bdd res = bdd_from_cubes(1, make_generator(in.begin(), in.end()));
+
+        const bdd expected = bdd_and(bdd_ithvar(1), bdd_nithvar(3));
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("creates (x0 & x1) | (!x0 & x2) | (x1 & !x2)", [&]() {
+        const literals_t in = {
+          {2, {2, true}}, {0, {0, false}}, {1, {2, false}},
+          {1, {0, true}}, {2, {1, false}}, {0, {1, false}},
+        };
+        const bdd res = bdd_from_cubes(3, make_generator(in.begin(), in.end()));
+
+        const bdd expected = (bdd_ithvar(0) & bdd_ithvar(1))
+                           | (bdd_nithvar(0) & bdd_ithvar(2))
+                           | (bdd_ithvar(1) & bdd_nithvar(2));
+        AssertThat(res, Is().EqualTo(expected));
+      });
+
+      it("ignores contradicting cubes", [&]() {
+        const literals_t in = { {0, {0, false}}, {0, {0, true}}, {1, {4, false}} };
+        const bdd res = bdd_from_cubes(2, make_generator(in.begin(), in.end()));
+
+        AssertThat(res, Is().EqualTo(bdd_ithvar(4)));
+      });
+
+      it("throws if a cube identifier is out of range", [&]() {
+        const literals_t in = { {1, {0, false}} };
+        AssertThrows(invalid_argument,
+                     bdd_from_cubes(1, make_generator(in.begin(), in.end())));
+      });
+    });
+
+    describe("bdd_atmost(vars, k)", [&]() {
+      using vars_t = std::vector<bdd::label_type>;
+
+      it("creates true for no variables", [&]() {
+        const vars_t vars = {};
+        const bdd res = bdd_atmost(vars.begin(), vars.end(), 0);
+        AssertThat(bdd_istrue(res), Is().True());
+      });
+
+      it("creates true if k is at least the number of variables", [&]() {
+        const vars_t vars = { 2, 1, 0 };
+        const bdd res = bdd_atmost(vars.begin(), vars.end(), 3);
+        AssertThat(bdd_istrue(res), Is().True());
+      });
+
+      it("creates !(x0 & x1) for [x1, x0] and k = 1", [&]() {
+        const vars_t vars = { 1, 0 };
+        const bdd res = bdd_atmost(vars.begin(), vars.end(), 1);
+
+        node_test_stream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(1, node::max_id, terminal_T, terminal_F)));
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(0, node::max_id,
+                                                terminal_T,
+                                                ptr_uint64(1, ptr_uint64::max_id))));
+
+        AssertThat(ns.can_pull(), Is().False());
+
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("creates at-most-one for [x2, x1, x0]", [&]() {
+        const vars_t vars = { 2, 1, 0 };
+        const bdd res = bdd_atmost(vars.begin(), vars.end(), 1);
+
+        const bdd expected = ~(bdd_ithvar(0) & bdd_ithvar(1))
+                           & ~(bdd_ithvar(0) & bdd_ithvar(2))
+                           & ~(bdd_ithvar(1) & bdd_ithvar(2));
+
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("throws if variables are not in descending order", [&]() {
+        const vars_t vars = { 0, 1 };
+        AssertThrows(invalid_argument, bdd_atmost(vars.begin(), vars.end(), 1));
+      });
+    });
+
+    describe("bdd_exactly(vars, k)", [&]() {
+      using vars_t = std::vector<bdd::label_type>;
+
+      it("creates false if k exceeds the number of variables", [&]() {
+        const vars_t vars = { 1, 0 };
+        const bdd res = bdd_exactly(vars.begin(), vars.end(), 3);
+        AssertThat(bdd_isfalse(res), Is().True());
+      });
+
+      it("creates x0 & x2 for [x2, x0] and k = 2", [&]() {
+        const vars_t vars = { 2, 0 };
+        const bdd res = bdd_exactly(vars.begin(), vars.end(), 2);
+
+        AssertThat(res, Is().EqualTo(bdd(bdd_and(bdd_ithvar(0), bdd_ithvar(2)))));
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("creates exactly-two for [x2, x1, x0]", [&]() {
+        const vars_t vars = { 2, 1, 0 };
+        const bdd res = bdd_exactly(vars.begin(), vars.end(), 2);
+
+        const bdd expected =
+          (bdd_ithvar(0) & bdd_ithvar(1) & bdd_nithvar(2))
+          | (bdd_ithvar(0) & bdd_nithvar(1) & bdd_ithvar(2))
+          | (bdd_nithvar(0) & bdd_ithvar(1) & bdd_ithvar(2));
+
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+    });
+
+    describe("bdd_linear_leq(terms, bound)", [&]() {
+      using terms_t = std::vector<pair<bdd::label_type, uint64_t>>;
+
+      it("creates 2x2 + 3x1 + x0 <= 3", [&]() {
+        const terms_t terms = { {2, 2}, {1, 3}, {0, 1} };
+        const bdd res = bdd_linear_leq(terms.begin(), terms.end(), 3);
+
+        const bdd expected = bdd_or(bdd_nithvar(1),
+                                    bdd_and(bdd_and(bdd_ithvar(1), bdd_nithvar(0)),
+                                            bdd_nithvar(2)));
+
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("skips variables with a coefficient of 0", [&]() {
+        const terms_t terms = { {3, 0}, {1, 1} };
+        const bdd res = bdd_linear_leq(terms.begin(), terms.end(), 0);
+
+        AssertThat(res, Is().EqualTo(bdd_nithvar(1)));
+      });
+
+      it("excludes variables with a coefficient larger than the bound", [&]() {
+        const terms_t terms = { {1, 5} };
+        AssertThat(bdd_linear_leq(terms.begin(), terms.end(), 4),
+                   Is().EqualTo(bdd_nithvar(1)));
+      });
+
+      it("merges budgets that suffice for all variables below [2^i x_i <= 2^40]", [&]() {
+        terms_t terms;
+        for (bdd::label_type x = 40; 0 < x; --x) { terms.push_back({x-1, uint64_t(1) << (x-1)}); }
+
+        const bdd res = bdd_linear_leq(terms.begin(), terms.end(), uint64_t(1) << 40);
+        AssertThat(bdd_istrue(res), Is().True());
+      });
+
+      it("merges budgets that suffice for all variables below [2^i x_i <= 2^40 - 2]", [&]() {
+        terms_t terms;
+        for (bdd::label_type x = 40; 0 < x; --x) { terms.push_back({x-1, uint64_t(1) << (x-1)}); }
+
+        // All but the assignment with all variables set to true
+        const bdd res = bdd_linear_leq(terms.begin(), terms.end(), (uint64_t(1) << 40) - 2u);
+        AssertThat(bdd_nodecount(res), Is().EqualTo(40u));
+        AssertThat(bdd_eval(res, [](const bdd::label_type) { return true; }), Is().False());
+        AssertThat(bdd_eval(res, [](const bdd::label_type x) { return x != 39u; }), Is().True());
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("throws if labels are not in descending order", [&]() {
+        const terms_t terms = { {1, 1}, {1, 2} };
+        AssertThrows(invalid_argument, bdd_linear_leq(terms.begin(), terms.end(), 2));
+      });
+    });
   });
  });
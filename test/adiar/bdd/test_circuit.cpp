@@ -0,0 +1,217 @@
+#include "../../test.h"
+
+#include <sstream>
+#include <string>
+
+go_bandit([]() {
+  describe("adiar/bdd/circuit.cpp", []() {
+    // Half-adder with the carry as the first and the sum as the second output.
+    const auto carry = [](const bdd::label_type a, const bdd::label_type b) -> bdd {
+      return bdd_and(bdd_ithvar(a), bdd_ithvar(b));
+    };
+    const auto sum = [](const bdd::label_type a, const bdd::label_type b) -> bdd {
+      return bdd_xor(bdd_ithvar(a), bdd_ithvar(b));
+    };
+
+    describe("bdd_from_aiger(in)", [&]() {
+      const std::string aag_half_adder = "aag 6 2 0 2 4\n"
+                                         "2\n"
+                                         "4\n"
+                                         "6\n"
+                                         "13\n"
+                                         "6 2 4\n"
+                                         "8 2 5\n"
+                                         "10 3 4\n"
+                                         "12 9 11\n"
+                                         "i0 a\n"
+                                         "c a half-adder\n";
+
+      it("creates the outputs of an ASCII half-adder", [&]() {
+        std::istringstream in(aag_half_adder);
+        const bdd_circuit res = bdd_from_aiger(in);
+
+        AssertThat(res.inputs.size(), Is().EqualTo(2u));
+        AssertThat(res.inputs[0], Is().EqualTo(0u));
+        AssertThat(res.inputs[1], Is().EqualTo(1u));
+
+        AssertThat(res.outputs.size(), Is().EqualTo(2u));
+        AssertThat(res.outputs[0], Is().EqualTo(carry(0, 1)));
+        AssertThat(res.outputs[1], Is().EqualTo(sum(0, 1)));
+      });
+
+      it("creates the outputs of a binary half-adder", [&]() {
+        std::string aig_half_adder = "aig 6 2 0 2 4\n"
+                                     "6\n"
+                                     "13\n";
+        for (const char delta : { 2, 2, 3, 3, 6, 1, 1, 2 }) {
+          aig_half_adder.push_back(delta);
+        }
+
+        std::istringstream in(aig_half_adder);
+        const bdd_circuit res = bdd_from_aiger(in);
+
+        AssertThat(res.outputs.size(), Is().EqualTo(2u));
+        AssertThat(res.outputs[0], Is().EqualTo(carry(0, 1)));
+        AssertThat(res.outputs[1], Is().EqualTo(sum(0, 1)));
+      });
+
+      it("creates constant outputs", [&]() {
+        std::istringstream in("aag 0 0 0 2 0\n"
+                              "0\n"
+                              "1\n");
+        const bdd_circuit res = bdd_from_aiger(in);
+
+        AssertThat(res.outputs.size(), Is().EqualTo(2u));
+        AssertThat(bdd_isfalse(res.outputs[0]), Is().True());
+        AssertThat(bdd_istrue(res.outputs[1]), Is().True());
+      });
+
+      it("orders inputs by a depth-first traversal of the fan-in", [&]() {
+        std::istringstream in("aag 3 2 0 1 1\n"
+                              "2\n"
+                              "4\n"
+                              "6\n"
+                              "6 4 2\n");
+        const bdd_circuit res = bdd_from_aiger(in, circuit_order::Depth_First);
+
+        AssertThat(res.inputs.size(), Is().EqualTo(2u));
+        AssertThat(res.inputs[0], Is().EqualTo(1u));
+        AssertThat(res.inputs[1], Is().EqualTo(0u));
+
+        AssertThat(res.outputs[0], Is().EqualTo(carry(0, 1)));
+      });
+
+      it("orders inputs with the FORCE heuristic", [&]() {
+        std::istringstream in(aag_half_adder);
+        const bdd_circuit res = bdd_from_aiger(in, circuit_order::Force);
+
+        AssertThat(res.inputs.size(), Is().EqualTo(2u));
+        AssertThat(res.inputs[0], Is().Not().EqualTo(res.inputs[1]));
+        AssertThat(res.inputs[0] <= 1u && res.inputs[1] <= 1u, Is().True());
+
+        AssertThat(res.outputs[0], Is().EqualTo(carry(res.inputs[0], res.inputs[1])));
+        AssertThat(res.outputs[1], Is().EqualTo(sum(res.inputs[0], res.inputs[1])));
+      });
+
+      it("creates the outputs of an ASCII half-adder with sparse variables", [&]() {
+        std::istringstream in("aag 1000000000000 2 0 2 4\n"
+                              "200\n"
+                              "14\n"
+                              "600\n"
+                              "1999999999999\n"
+                              "600 200 14\n"
+                              "602 200 15\n"
+                              "10 201 14\n"
+                              "1999999999998 603 11\n");
+        const bdd_circuit res = bdd_from_aiger(in);
+
+        AssertThat(res.outputs.size(), Is().EqualTo(2u));
+        AssertThat(res.outputs[0], Is().EqualTo(carry(0, 1)));
+        AssertThat(res.outputs[1], Is().EqualTo(sum(0, 1)));
+      });
+
+      it("throws on an undefined variable of a sparse ASCII file", [&]() {
+        std::istringstream in("aag 1000 1 0 1 1\n"
+                              "2\n"
+                              "10\n"
+                              "10 2 1000\n");
+        AssertThrows(invalid_argument, bdd_from_aiger(in));
+      });
+
+      it("throws on a binary header with more variables than inputs and gates", [&]() {
+        std::istringstream in("aig 1000000000000 0 0 0 0\n");
+        AssertThrows(invalid_argument, bdd_from_aiger(in));
+      });
+
+      it("throws on latches", [&]() {
+        std::istringstream in("aag 1 0 1 0 0\n"
+                              "2 3\n");
+        AssertThrows(invalid_argument, bdd_from_aiger(in));
+      });
+
+      it("throws on a combinational cycle", [&]() {
+        std::istringstream in("aag 2 0 0 1 2\n"
+                              "2\n"
+                              "2 4 1\n"
+                              "4 2 1\n");
+        AssertThrows(invalid_argument, bdd_from_aiger(in));
+      });
+
+      it("throws on a malformed header", [&]() {
+        std::istringstream in("aig 2 1\n");
+        AssertThrows(invalid_argument, bdd_from_aiger(in));
+      });
+    });
+
+    describe("bdd_from_blif(in)", [&]() {
+      it("creates the outputs of a half-adder", [&]() {
+        std::istringstream in(".model half_adder\n"
+                              ".inputs a b\n"
+                              ".outputs c s\n"
+                              ".names a b s\n"
+                              "10 1\n"
+                              "01 1\n"
+                              ".names a b c\n"
+                              "11 1\n"
+                              ".end\n");
+        const bdd_circuit res = bdd_from_blif(in);
+
+        AssertThat(res.inputs.size(), Is().EqualTo(2u));
+        AssertThat(res.outputs.size(), Is().EqualTo(2u));
+        AssertThat(res.outputs[0], Is().EqualTo(carry(0, 1)));
+        AssertThat(res.outputs[1], Is().EqualTo(sum(0, 1)));
+      });
+
+      it("supports off-set covers, constants, comments, and continuations", [&]() {
+        std::istringstream in("# a comment\n"
+                              ".model misc\n"
+                              ".inputs a \\\n"
+                              "  b c\n"
+                              ".outputs n one zero m\n"
+                              ".names m c n   # n = !(m & c)\n"
+                              "11 0\n"
+                              ".names one\n"
+                              "1\n"
+                              ".names zero\n"
+                              ".names a b m\n"
+                              "1- 1\n"
+                              "-1 1\n"
+                              ".end\n");
+        const bdd_circuit res = bdd_from_blif(in);
+
+        AssertThat(res.outputs.size(), Is().EqualTo(4u));
+
+        const bdd m = bdd_or(bdd_ithvar(0), bdd_ithvar(1));
+        AssertThat(res.outputs[0], Is().EqualTo(bdd_not(bdd_and(m, bdd_ithvar(2)))));
+        AssertThat(bdd_istrue(res.outputs[1]), Is().True());
+        AssertThat(bdd_isfalse(res.outputs[2]), Is().True());
+        AssertThat(res.outputs[3], Is().EqualTo(m));
+      });
+
+      it("throws on an undefined signal", [&]() {
+        std::istringstream in(".inputs a\n"
+                              ".outputs o\n"
+                              ".names a b o\n"
+                              "11 1\n");
+        AssertThrows(invalid_argument, bdd_from_blif(in));
+      });
+
+      it("throws on a combinational cycle", [&]() {
+        std::istringstream in(".inputs a\n"
+                              ".outputs o\n"
+                              ".names a p o\n"
+                              "11 1\n"
+                              ".names o p\n"
+                              "1 1\n");
+        AssertThrows(invalid_argument, bdd_from_blif(in));
+      });
+
+      it("throws on latches", [&]() {
+        std::istringstream in(".inputs a\n"
+                              ".outputs o\n"
+                              ".latch a o 0\n");
+        AssertThrows(invalid_argument, bdd_from_blif(in));
+      });
+    });
+  });
+ });
@@ -0,0 +1,157 @@
+#include "../../test.h"
+
+#include <sstream>
+
+go_bandit([]() {
+  describe("adiar/bdd/cnf.cpp", []() {
+    describe("bdd_from_cnf(in)", []() {
+      it("creates true for a CNF without clauses", []() {
+        std::istringstream in("p cnf 0 0\n");
+        AssertThat(bdd_istrue(bdd_from_cnf(in)), Is().True());
+      });
+
+      it("creates false for a CNF with an empty clause", []() {
+        std::istringstream in("p cnf 2 2\n"
+                              "1 2 0\n"
+                              "0\n");
+        AssertThat(bdd_isfalse(bdd_from_cnf(in)), Is().True());
+      });
+
+      it("creates a single clause [x0 | !x2]", []() {
+        std::istringstream in("c a single clause\n"
+                              "p cnf 3 1\n"
+                              "1 -3 0\n");
+
+        const bdd res = bdd_from_cnf(in);
+        AssertThat(res, Is().EqualTo(bdd(bdd_or(bdd_ithvar(0), bdd_nithvar(2)))));
+        AssertThat(bdd_iscanonical(res), Is().True());
+      });
+
+      it("ignores tautologies and duplicate literals", []() {
+        std::istringstream in("p cnf 2 2\n"
+                              "1 -1 0\n"
+                              "2 2 0\n");
+
+        AssertThat(bdd_from_cnf(in), Is().EqualTo(bdd_ithvar(1)));
+      });
+
+      it("accepts clauses across lines and a missing final '0'", []() {
+        std::istringstream in("p cnf 3 2\n"
+                              "1 2\n"
+                              "0 -2 3 0 -1\n"
+                              "-3\n");
+
+        const bdd expected = (bdd_ithvar(0) | bdd_ithvar(1))
+                           & (bdd_nithvar(1) | bdd_ithvar(2))
+                           & (bdd_nithvar(0) | bdd_nithvar(2));
+
+        AssertThat(bdd_from_cnf(in), Is().EqualTo(expected));
+      });
+
+      it("stops at a '%' end marker", []() {
+        std::istringstream in("p cnf 2 1\n"
+                              "-2 0\n"
+                              "%\n"
+                              "0\n");
+
+        AssertThat(bdd_from_cnf(in), Is().EqualTo(bdd_nithvar(1)));
+      });
+
+      // (x0 | x1) & (!x0 | x2) & (!x1 | !x2) & (x2 | x3) & (!x3 | x1)
+      const std::string cnf_5 = "p cnf 4 5\n"
+                                "1 2 0\n"
+                                "-1 3 0\n"
+                                "-2 -3 0\n"
+                                "3 4 0\n"
+                                "-4 2 0\n";
+
+      const bdd expected_5 =
+        (bdd_ithvar(0) | bdd_ithvar(1))
+        & (bdd_nithvar(0) | bdd_ithvar(2))
+        & (bdd_nithvar(1) | bdd_nithvar(2))
+        & (bdd_ithvar(2) | bdd_ithvar(3))
+        & (bdd_nithvar(3) | bdd_ithvar(1));
+
+      it("conjoins clauses with a 'Balanced' schedule", [&]() {
+        std::istringstream in(cnf_5);
+        AssertThat(bdd_from_cnf(exec_policy::schedule::Balanced, in), Is().EqualTo(expected_5));
+      });
+
+      it("conjoins clauses with a 'Min_Width' schedule", [&]() {
+        std::istringstream in(cnf_5);
+        AssertThat(bdd_from_cnf(exec_policy::schedule::Min_Width, in), Is().EqualTo(expected_5));
+      });
+
+      it("throws if the problem line is missing", []() {
+        std::istringstream in("1 2 0\n");
+        AssertThrows(invalid_argument, bdd_from_cnf(in));
+      });
+
+      it("throws if the problem line is not for a CNF", []() {
+        std::istringstream in("p sat 2\n");
+        AssertThrows(invalid_argument, bdd_from_cnf(in));
+      });
+
+      it("throws if a literal exceeds the number of variables", []() {
+        std::istringstream in("p cnf 2 1\n"
+                              "1 -3 0\n");
+        AssertThrows(invalid_argument, bdd_from_cnf(in));
+      });
+
+      it("throws if a clause is malformed", []() {
+        std::istringstream in("p cnf 2 1\n"
+                              "1 x 0\n");
+        AssertThrows(invalid_argument, bdd_from_cnf(in));
+      });
+    });
+
+    describe("bdd_from_cnf(in, vars)", []() {
+      // (x0 | x1) & (!x1 | x2) & (x3 | x4)
+      const std::string cnf_3 = "p cnf 5 3\n"
+                                "1 2 0\n"
+                                "-2 3 0\n"
+                                "4 5 0\n";
+
+      it("quantifies x1", [&]() {
+        std::istringstream in(cnf_3);
+        const bdd res = bdd_from_cnf(in, [](const bdd::label_type x) { return x == 1u; });
+
+        const bdd expected = (bdd_ithvar(0) | bdd_ithvar(2))
+                           & (bdd_ithvar(3) | bdd_ithvar(4));
+        AssertThat(res, Is().EqualTo(expected));
+      });
+
+      it("quantifies x1 with a 'Min_Width' schedule", [&]() {
+        std::istringstream in(cnf_3);
+        const bdd res = bdd_from_cnf(exec_policy::schedule::Min_Width, in,
+                                     [](const bdd::label_type x) { return x == 1u; });
+
+        const bdd expected = (bdd_ithvar(0) | bdd_ithvar(2))
+                           & (bdd_ithvar(3) | bdd_ithvar(4));
+        AssertThat(res, Is().EqualTo(expected));
+      });
+
+      it("quantifies all but x0 [projected model counting]", [&]() {
+        std::istringstream in(cnf_3);
+        const bdd res = bdd_from_cnf(in, [](const bdd::label_type x) { return x != 0u; });
+
+        AssertThat(bdd_istrue(res), Is().True());
+      });
+
+      it("quantifies variables that occur in a single cluster", [&]() {
+        std::istringstream in(cnf_3);
+        const bdd res = bdd_from_cnf(in, [](const bdd::label_type x) { return x == 4u; });
+
+        const bdd expected = (bdd_ithvar(0) | bdd_ithvar(1))
+                           & (bdd_nithvar(1) | bdd_ithvar(2));
+        AssertThat(res, Is().EqualTo(expected));
+      });
+    });
+
+    describe("bdd_from_cnf(file_name)", []() {
+      it("throws if the file does not exist", []() {
+        AssertThrows(runtime_error, bdd_from_cnf(std::string("this/file/does/not/exist.cnf")));
+      });
+    });
+  });
+ });
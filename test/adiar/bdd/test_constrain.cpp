@@ -0,0 +1,107 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/bdd/constrain.cpp", []() {
+    const bdd x0 = bdd_ithvar(0);
+    const bdd x1 = bdd_ithvar(1);
+    const bdd x2 = bdd_ithvar(2);
+
+    // (x0 & x1) | x2
+    const bdd f = bdd_or(bdd_and(x0, x1), x2);
+
+    // x0 ^ x1
+    const bdd x0_xor_x1 = bdd_xor(x0, x1);
+
+    describe("bdd_constrain(f, c)", [&]() {
+      it("returns f for c = T", [&]() {
+        AssertThat(bdd_constrain(f, bdd_true()) == f, Is().True());
+      });
+
+      it("returns F for c = F", [&]() {
+        AssertThat(bdd_isfalse(bdd_constrain(f, bdd_false())), Is().True());
+      });
+
+      it("returns terminal f for any c", [&]() {
+        AssertThat(bdd_istrue(bdd_constrain(bdd_true(), x0_xor_x1)), Is().True());
+        AssertThat(bdd_isfalse(bdd_constrain(bdd_false(), x0_xor_x1)), Is().True());
+      });
+
+      it("returns T for f = c [same file]", [&]() {
+        AssertThat(bdd_istrue(bdd_constrain(f, f)), Is().True());
+      });
+
+      it("returns F for f = ~c [same file]", [&]() {
+        AssertThat(bdd_isfalse(bdd_constrain(f, bdd_not(f))), Is().True());
+      });
+
+      it("computes (x0 & x1) | x2 constrained to x0", [&]() {
+        AssertThat(bdd_constrain(f, x0) == bdd_or(x1, x2), Is().True());
+      });
+
+      it("computes (x0 & x1) | x2 constrained to ~x2", [&]() {
+        AssertThat(bdd_constrain(f, bdd_not(x2)) == bdd_and(x0, x1), Is().True());
+      });
+
+      it("computes x1 constrained to x0 & x1", [&]() {
+        AssertThat(bdd_istrue(bdd_constrain(x1, bdd_and(x0, x1))), Is().True());
+      });
+
+      it("computes x1 constrained to x0 ^ x1 [new variable]", [&]() {
+        AssertThat(bdd_constrain(x1, x0_xor_x1) == bdd_not(x0), Is().True());
+      });
+
+      it("agrees with f inside of c", [&]() {
+        const bdd c = bdd_or(x0_xor_x1, x2);
+        const bdd res = bdd_constrain(f, c);
+
+        AssertThat(bdd_and(res, c) == bdd_and(f, c), Is().True());
+      });
+
+      it("agrees with f inside of c [Priority_Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+
+        const bdd c = bdd_or(x0_xor_x1, x2);
+        const bdd res = bdd_constrain(ep, f, c);
+
+        AssertThat(bdd_and(res, c) == bdd_and(f, c), Is().True());
+        AssertThat(res == bdd_constrain(f, c), Is().True());
+      });
+
+      it("agrees with f inside of c [Random_Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+
+        const bdd c = bdd_or(x0_xor_x1, x2);
+        const bdd res = bdd_constrain(ep, f, c);
+
+        AssertThat(bdd_and(res, c) == bdd_and(f, c), Is().True());
+        AssertThat(res == bdd_constrain(f, c), Is().True());
+      });
+    });
+
+    describe("bdd_simplify(f, c)", [&]() {
+      it("returns f for c = T", [&]() {
+        AssertThat(bdd_simplify(f, bdd_true()) == f, Is().True());
+      });
+
+      it("returns F for c = F", [&]() {
+        AssertThat(bdd_isfalse(bdd_simplify(f, bdd_false())), Is().True());
+      });
+
+      it("computes (x0 & x1) | x2 simplified with x0", [&]() {
+        AssertThat(bdd_simplify(f, x0) == bdd_or(x1, x2), Is().True());
+      });
+
+      it("does not introduce variables outside of the support of f", [&]() {
+        AssertThat(bdd_simplify(x1, x0_xor_x1) == x1, Is().True());
+      });
+
+      it("agrees with f inside of c and is not larger than f", [&]() {
+        const bdd c = bdd_and(bdd_or(x0, x2), bdd_ithvar(3));
+        const bdd res = bdd_simplify(f, c);
+
+        AssertThat(bdd_and(res, c) == bdd_and(f, c), Is().True());
+        AssertThat(res.size(), Is().LessThanOrEqualTo(f.size()));
+      });
+    });
+  });
+ });
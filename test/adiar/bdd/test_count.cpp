@@ -1,5 +1,12 @@
 #include "../../test.h"
 
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <adiar/internal/algorithms/count.h>
+
 go_bandit([]() {
   describe("adiar/bdd/count.cpp", []() {
     ptr_uint64 terminal_T = ptr_uint64(true);
@@ -329,5 +336,204 @@ go_bandit([]() {
         AssertThat(bdd_satcount(bdd_root_1), Is().EqualTo(64u * 1u));
       });
     });
+
+    describe("bdd_pathcount(ep, f) + bdd_satcount(ep, f, varcount) [threads]", [&]() {
+      // x0 x1 ... x10 == x11 x12 ... x21, where level 11 has 2^11 nodes. Hence,
+      // multiple workers are used for it.
+      bdd bdd_eq = bdd_true();
+      for (bdd::label_type i = 0; i < 11; ++i) {
+        bdd_eq = bdd_and(bdd_eq, bdd_equiv(bdd_ithvar(i), bdd_ithvar(11+i)));
+      }
+
+      const exec_policy ep_threads = exec_policy::threads(4);
+
+      it("can count paths with multiple threads", [&]() {
+        AssertThat(bdd_pathcount(ep_threads, bdd_eq), Is().EqualTo(2048u));
+        AssertThat(bdd_pathcount(ep_threads, bdd_not(bdd_eq)),
+                   Is().EqualTo(bdd_pathcount(bdd_not(bdd_eq))));
+      });
+
+      it("can count assignments with multiple threads", [&]() {
+        AssertThat(bdd_satcount(ep_threads, bdd_eq, 22), Is().EqualTo(2048u));
+        AssertThat(bdd_satcount(ep_threads, bdd_eq, 23), Is().EqualTo(2u * 2048u));
+        AssertThat(bdd_satcount(ep_threads, bdd_not(bdd_eq), 22),
+                   Is().EqualTo((1u << 22) - 2048u));
+      });
+
+      it("can count small BDDs with multiple threads", [&]() {
+        AssertThat(bdd_pathcount(ep_threads, bdd_4), Is().EqualTo(6u));
+        AssertThat(bdd_satcount(ep_threads, bdd_1, 4), Is().EqualTo(5u));
+      });
+
+      it("can count paths with multiple threads for levels wider than a chunk", [&]() {
+        // Complete (unreduced) binary tree over x0, x1, ..., x16 whose 2^16
+        // nodes on level 16 all have the node for x17 as their low child.
+        // Hence, level 16 is split between all workers and the node for x17
+        // has requests from each of them.
+        shared_levelized_file<bdd::node_type> tree;
+        {
+          node_writer nw(tree);
+          nw << node(17, 0, terminal_F, terminal_T);
+
+          for (size_t i = 1u << 16; 0 < i; --i) {
+            nw << node(16, i-1, ptr_uint64(17, 0), terminal_T);
+          }
+          for (ptr_uint64::label_type l = 16; 0 < l; --l) {
+            for (size_t i = 1u << (l-1); 0 < i; --i) {
+              nw << node(l-1, i-1, ptr_uint64(l, 2*(i-1)), ptr_uint64(l, 2*(i-1)+1));
+            }
+          }
+        }
+
+        AssertThat(bdd_pathcount(ep_threads, tree), Is().EqualTo(1u << 17));
+        AssertThat(bdd_satcount(ep_threads, tree, 18), Is().EqualTo(3u * (1u << 16)));
+      });
+
+      it("rethrows the exception of another worker on the calling thread", [&]() {
+        count_worker_pool pool(3u);
+
+        std::atomic<size_t> calls(0u);
+        AssertThrows(std::runtime_error, pool.run(3u, [&calls](const size_t w) {
+          calls++;
+          if (w == 2u) { throw std::runtime_error("worker 2"); }
+        }));
+        AssertThat(calls.load(), Is().EqualTo(3u));
+
+        // The pool is still usable afterwards
+        calls = 0u;
+        pool.run(3u, [&calls](const size_t) { calls++; });
+        AssertThat(calls.load(), Is().EqualTo(3u));
+      });
+
+      it("rethrows the exception of the calling thread after all workers finished", [&]() {
+        count_worker_pool pool(3u);
+
+        std::atomic<size_t> calls(0u);
+        AssertThrows(std::runtime_error, pool.run(3u, [&calls](const size_t w) {
+          if (w == 0u) { throw std::runtime_error("worker 0"); }
+          calls++;
+        }));
+        AssertThat(calls.load(), Is().EqualTo(2u));
+      });
+    });
+
+    describe("bdd_wmc(f, w)", [&]() {
+      const auto w = [](const bdd::label_type /*x*/, const bool value) {
+        return value ? 2.0 : 3.0;
+      };
+
+      it("is the same as bdd_satcount for unit weights [1]", [&]() {
+        domain_unset();
+        const auto unit = [](const bdd::label_type, const bool) { return 1.0; };
+        AssertThat(bdd_wmc(bdd_1, unit), Is().EqualTo(5.0));
+      });
+
+      it("is the same as bdd_satcount for unit weights [2]", [&]() {
+        domain_unset();
+        const auto unit = [](const bdd::label_type, const bool) { return 1.0; };
+        AssertThat(bdd_wmc(bdd_4, unit), Is().EqualTo(double(bdd_satcount(bdd_4))));
+      });
+
+      it("sums the weights of satisfying assignments [empty dom]", [&]() {
+        domain_unset();
+
+        // x1 | x2: x1 (2 * (2+3)) and ~x1 & x2 (3 * 2)
+        AssertThat(bdd_wmc(bdd_2, w), Is().EqualTo(16.0));
+        AssertThat(bdd_wmc(bdd_not(bdd_2), w), Is().EqualTo(9.0));
+      });
+
+      it("weights skipped levels in the domain [non-empty dom]", [&]() {
+        domain_set(4);
+
+        // (2+3) for each of x0 and x3
+        AssertThat(bdd_wmc(bdd_2, w), Is().EqualTo(25.0 * 16.0));
+        AssertThat(bdd_wmc(bdd_not(bdd_2), w), Is().EqualTo(25.0 * 9.0));
+
+        domain_unset();
+      });
+
+      it("weights terminals with the domain", [&]() {
+        domain_set(4);
+
+        AssertThat(bdd_wmc(bdd_T, w), Is().EqualTo(625.0));
+        AssertThat(bdd_wmc(bdd_F, w), Is().EqualTo(0.0));
+
+        domain_unset();
+
+        AssertThat(bdd_wmc(bdd_T, w), Is().EqualTo(1.0));
+      });
+
+      it("can be run with multiple threads", [&]() {
+        domain_unset();
+        AssertThat(bdd_wmc(exec_policy::threads(2), bdd_2, w), Is().EqualTo(16.0));
+      });
+    });
+
+    describe("bdd_wmc_log(f, w)", [&]() {
+      const auto w = [](const bdd::label_type /*x*/, const bool value) {
+        return value ? 2.0 : 3.0;
+      };
+
+      it("is the logarithm of bdd_wmc", [&]() {
+        domain_set(4);
+
+        AssertThat(bdd_wmc_log(bdd_2, w), Is().EqualToWithDelta(std::log(400.0), 1e-9));
+        AssertThat(bdd_wmc_log(bdd_4, w), Is().EqualToWithDelta(std::log(bdd_wmc(bdd_4, w)), 1e-9));
+
+        domain_unset();
+      });
+
+      it("is -infinity for an unsatisfiable BDD", [&]() {
+        AssertThat(bdd_wmc_log(bdd_F, w), Is().EqualTo(-std::numeric_limits<double>::infinity()));
+      });
+
+      it("does not underflow for many variables with small weights", [&]() {
+        domain_set(2000);
+
+        const auto w_small = [](const bdd::label_type, const bool) { return 1e-200; };
+
+        // Everything is multiplied with (2 * 1e-200)^1999
+        AssertThat(bdd_wmc(bdd_root_1, w_small), Is().EqualTo(0.0));
+
+        const double expected = 1999.0 * std::log(2e-200) + std::log(1e-200);
+        AssertThat(bdd_wmc_log(bdd_root_1, w_small), Is().EqualToWithDelta(expected, 1e-6));
+
+        domain_unset();
+      });
+
+      it("throws for negative weights", [&]() {
+        const auto w_neg = [](const bdd::label_type, const bool value) { return value ? 1.0 : -1.0; };
+
+        AssertThrows(invalid_argument, bdd_wmc_log(bdd_2, w_neg));
+
+        // Yet, they are fine outside of log-space: x1 (1 * (1-1)) and ~x1 & x2
+        // (-1 * 1).
+        AssertThat(bdd_wmc(bdd_2, w_neg), Is().EqualTo(-1.0));
+      });
+    });
+
+    describe("bdd_probability(f, p)", [&]() {
+      it("computes the probability of x1 | x2", [&]() {
+        domain_set(4);
+
+        const auto p = [](const bdd::label_type x) { return x == 1 ? 0.5 : 0.25; };
+        AssertThat(bdd_probability(bdd_2, p), Is().EqualTo(1.0 - 0.5 * 0.75));
+        AssertThat(bdd_probability(bdd_not(bdd_2), p), Is().EqualTo(0.5 * 0.75));
+
+        domain_unset();
+      });
+
+      it("is 1 for the true terminal", [&]() {
+        domain_set(4);
+        AssertThat(bdd_probability(bdd_T, [](const bdd::label_type) { return 0.3; }),
+                   Is().EqualToWithDelta(1.0, 1e-12));
+        domain_unset();
+      });
+
+      it("throws on an invalid probability", [&]() {
+        AssertThrows(invalid_argument,
+                     bdd_probability(bdd_2, [](const bdd::label_type) { return 1.5; }));
+      });
+    });
   });
  });
@@ -69,6 +69,21 @@ go_bandit([]() {
         nw << node(1,0, terminal_F, terminal_T);
       }
 
+      shared_levelized_file<bdd::node_type> canonical_bdd;
+      // Same as 'bdd' above, but with canonical identifiers.
+      {
+        const node c5 = node(3, node::max_id,   terminal_F, terminal_T);
+        const node c4 = node(2, node::max_id-1, terminal_T, c5.uid());
+        const node c3 = node(2, node::max_id,   terminal_F, terminal_T);
+        const node c2 = node(1, node::max_id,   c3.uid(),   c4.uid());
+        const node c1 = node(0, node::max_id,   c3.uid(),   c2.uid());
+
+        { // Garbage collect writer to free write-lock
+          node_writer nw(canonical_bdd);
+          nw << c5 << c3 << c4 << c2 << c1;
+        }
+      }
+
       shared_levelized_file<bdd::node_type> bdd_F;
       { // Garbage collect writer to free write-lock
         node_writer nw(bdd_F);
@@ -270,6 +285,16 @@ go_bandit([]() {
       });
 
       describe("bdd_eval(bdd, predicate<...>)", [&]() {
+        it("returns the same on canonical test BDD", [&]() {
+          AssertThat(canonical_bdd->canonical, Is().True());
+
+          for (uint64_t j = 0u; j < 16u; ++j) {
+            const auto af = [j](const bdd::label_type l) { return ((j >> l) & 1u) != 0u; };
+            AssertThat(bdd_eval(canonical_bdd, af), Is().EqualTo(bdd_eval(bdd, af)));
+            AssertThat(bdd_eval(bdd_not(canonical_bdd), af), Is().EqualTo(!bdd_eval(bdd, af)));
+          }
+        });
+
         it("returns F on test BDD with assignment 'l -> l = 3'", [&]() {
           auto af = [](const bdd::label_type l) {
             return l == 3;
@@ -361,6 +386,84 @@ go_bandit([]() {
           AssertThat(bdd_eval(bdd_T, af), Is().True());
         });
       });
+
+      describe("bdd_eval_batch(bdd, function<...>)", [&]() {
+        // Lane 'j' assigns to variable 'i' the value of the 'i'th bit of 'j'.
+        const auto xs = [](const bdd::label_type i) {
+          uint64_t ret = 0u;
+          for (uint64_t j = 0u; j < 64u; ++j) {
+            ret |= ((j >> i) & 1u) << j;
+          }
+          return ret;
+        };
+
+        const auto expected = [](const adiar::bdd &f) {
+          uint64_t ret = 0u;
+          for (uint64_t j = 0u; j < 64u; ++j) {
+            const bool res_j = bdd_eval(f, [j](const bdd::label_type i) { return ((j >> i) & 1u) != 0u; });
+            ret |= static_cast<uint64_t>(res_j) << j;
+          }
+          return ret;
+        };
+
+        it("returns all-ones on T terminal", [&]() {
+          AssertThat(bdd_eval_batch(bdd_T, xs), Is().EqualTo(~static_cast<uint64_t>(0u)));
+        });
+
+        it("returns all-zeroes on F terminal", [&]() {
+          AssertThat(bdd_eval_batch(bdd_F, xs), Is().EqualTo(0u));
+        });
+
+        it("agrees with 'bdd_eval' on test BDD", [&]() {
+          AssertThat(bdd_eval_batch(bdd, xs), Is().EqualTo(expected(bdd)));
+        });
+
+        it("agrees with 'bdd_eval' on negated test BDD", [&]() {
+          const adiar::bdd not_bdd = bdd_not(bdd);
+          AssertThat(bdd_eval_batch(not_bdd, xs), Is().EqualTo(expected(not_bdd)));
+        });
+
+        it("agrees with 'bdd_eval' on BDD with skipped levels", [&]() {
+          AssertThat(bdd_eval_batch(skip_bdd, xs), Is().EqualTo(expected(skip_bdd)));
+        });
+
+        it("agrees with 'bdd_eval' on BDD with non-zero root", [&]() {
+          AssertThat(bdd_eval_batch(non_zero_bdd, xs), Is().EqualTo(expected(non_zero_bdd)));
+        });
+
+        it("agrees with 'bdd_eval' with external memory", [&]() {
+          const exec_policy ep = exec_policy::memory::External;
+          AssertThat(bdd_eval_batch(ep, bdd, xs), Is().EqualTo(expected(bdd)));
+        });
+
+        it("calls the assignment function in ascending order", [&]() {
+          std::vector<bdd::label_type> calls;
+          bdd_eval_batch(bdd, [&calls](const bdd::label_type i) {
+            calls.push_back(i);
+            return ~static_cast<uint64_t>(0u);
+          });
+
+          // With all variables true, x0 -> x1 -> x2 (node 4) -> x3.
+          AssertThat(calls.size(), Is().EqualTo(4u));
+          AssertThat(calls.at(0), Is().EqualTo(0u));
+          AssertThat(calls.at(1), Is().EqualTo(1u));
+          AssertThat(calls.at(2), Is().EqualTo(2u));
+          AssertThat(calls.at(3), Is().EqualTo(3u));
+        });
+
+        it("does not visit levels no assignment reaches", [&]() {
+          std::vector<bdd::label_type> calls;
+          bdd_eval_batch(bdd, [&calls](const bdd::label_type i) {
+            calls.push_back(i);
+            return static_cast<uint64_t>(0u);
+          });
+
+          // With all variables false, x0 -> x2 (node 3) -> F.
+          AssertThat(calls.size(), Is().EqualTo(2u));
+          AssertThat(calls.at(0), Is().EqualTo(0u));
+          AssertThat(calls.at(1), Is().EqualTo(2u));
+        });
+      });
     } // bdd_eval
 
     { // bdd_satmin, bdd_satmax
@@ -253,6 +253,9 @@ go_bandit([]() {
         ;
     }
 
+    // Pin the levelized algorithms, since their unreduced output is tested.
+    const exec_policy ep = exec_policy::engine::Levelized;
+
     describe("Trivial evaluations", [&]() {
       // Trivial evaluations by given a terminal
       it("should give back first file on if-true (true ? x0 : x1)", [&]() {
@@ -305,7 +308,7 @@ go_bandit([]() {
 
     describe("Inputs boiling down to an apply", [&]() {
       it("should create XNOR of x0 and x1 (x0 ? x1 : ~x1) due to same file", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_x1, bdd_not(bdd_x1));
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x1, bdd_not(bdd_x1));
 
         arc_test_stream arcs(out);
 
@@ -348,7 +351,7 @@ go_bandit([]() {
       });
 
       it("should create XNOR of x0 and ~x1 (x0 ? ~x1 : x1) due to same file", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_not(bdd_x1), bdd_x1);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_not(bdd_x1), bdd_x1);
 
         arc_test_stream arcs(out);
 
@@ -391,7 +394,7 @@ go_bandit([]() {
       });
 
       it("should create OR of x0 and x1 (x0 ? x0 : x1) due to same file", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_x0, bdd_x1);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x0, bdd_x1);
 
         arc_test_stream arcs(out);
 
@@ -428,7 +431,7 @@ go_bandit([]() {
       });
 
       it("should create AND of x0 (negated) and x1 (x0 ? ~x0 : x1) due to same file", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_not(bdd_x0), bdd_x1);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_not(bdd_x0), bdd_x1);
 
         arc_test_stream arcs(out);
 
@@ -465,7 +468,7 @@ go_bandit([]() {
       });
 
       it("should create AND of x0 and x1 (x0 ? x1 : x0) due to same file", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_x1, bdd_x0);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x1, bdd_x0);
 
         arc_test_stream arcs(out);
 
@@ -502,7 +505,7 @@ go_bandit([]() {
       });
 
       it("should create IMPLIES of x0 and x1 (x0 ? x1 : ~x0) due to same file", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_x1, bdd_not(bdd_x0));
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x1, bdd_not(bdd_x0));
 
         arc_test_stream arcs(out);
 
@@ -539,7 +542,7 @@ go_bandit([]() {
       });
 
       it("should create OR of x0 and x1 (x0 ? T : x1)", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_T, bdd_x1);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_T, bdd_x1);
 
         arc_test_stream arcs(out);
 
@@ -576,7 +579,7 @@ go_bandit([]() {
       });
 
       it("should create AND of x0 (negated) and x1 (x0 ? F : x1)", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_F, bdd_x1);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_F, bdd_x1);
 
         arc_test_stream arcs(out);
 
@@ -613,7 +616,7 @@ go_bandit([]() {
       });
 
       it("should create IMPLIES of x0 and x1 (x0 ? x1 : T)", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_x1, bdd_T);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x1, bdd_T);
 
         arc_test_stream arcs(out);
 
@@ -650,7 +653,7 @@ go_bandit([]() {
       });
 
       it("should create AND of x0 and x1 (x0 ? x1 : F)", [&]() {
-        __bdd out = bdd_ite(bdd_x0, bdd_x1, bdd_F);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x1, bdd_F);
 
         arc_test_stream arcs(out);
 
@@ -698,7 +701,7 @@ go_bandit([]() {
         //
         //      The low arc is resolved first, since F < T
         */
-        __bdd out = bdd_ite(bdd_x0, bdd_not_x1, bdd_x1);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_not_x1, bdd_x1);
 
         arc_test_stream arcs(out);
 
@@ -750,7 +753,7 @@ go_bandit([]() {
         //
         //        The high arc is resolved first, since T > F on the second coordinate
         */
-        __bdd out = bdd_ite(bdd_x1, bdd_not_x0, bdd_x0);
+        __bdd out = bdd_ite(ep, bdd_x1, bdd_not_x0, bdd_x0);
 
         arc_test_stream arcs(out);
 
@@ -802,7 +805,7 @@ go_bandit([]() {
         //
         //    The low arc is resolved first, since F < T on the second coordinate.
         */
-        __bdd out = bdd_ite(bdd_x1, bdd_x0, bdd_not_x0);
+        __bdd out = bdd_ite(ep, bdd_x1, bdd_x0, bdd_not_x0);
 
         arc_test_stream arcs(out);
 
@@ -868,7 +871,7 @@ go_bandit([]() {
         //                         / \               / \
         //                         F T               T F
         */
-        __bdd out = bdd_ite(bdd_not(bdd_x2), bdd_x0_xor_x1, bdd_x0_xnor_x1);
+        __bdd out = bdd_ite(ep, bdd_not(bdd_x2), bdd_x0_xor_x1, bdd_x0_xnor_x1);
 
         arc_test_stream arcs(out);
 
@@ -978,7 +981,7 @@ go_bandit([]() {
         //        the value of the 'if' conditional. The same goes for T terminal of
         //        (1,2,4).
         */
-        __bdd out = bdd_ite(bdd_x3, bdd_x1_and_x2, bdd_1);
+        __bdd out = bdd_ite(ep, bdd_x3, bdd_x1_and_x2, bdd_1);
 
         arc_test_stream arcs(out);
 
@@ -1086,7 +1089,7 @@ go_bandit([]() {
         //          The level for x3 equires to forward (6) in (6,7,F) once.
         */
 
-        __bdd out = bdd_ite(bdd_3, bdd_4, bdd_5);
+        __bdd out = bdd_ite(ep, bdd_3, bdd_4, bdd_5);
 
         arc_test_stream arcs(out);
 
@@ -1183,7 +1186,7 @@ go_bandit([]() {
         //          encountered simultaneously, so they are in one-go forwarded.
         */
 
-        __bdd out = bdd_ite(bdd_6, bdd_x0_xor_x2, bdd_not_6);
+        __bdd out = bdd_ite(ep, bdd_6, bdd_x0_xor_x2, bdd_not_6);
 
         arc_test_stream arcs(out);
 
@@ -1256,7 +1259,7 @@ go_bandit([]() {
         //          encountered simultaneously, so they are in one-go forwarded.
         */
 
-        __bdd out = bdd_ite(bdd_not_6, bdd_6, bdd_x0_xor_x2);
+        __bdd out = bdd_ite(ep, bdd_not_6, bdd_6, bdd_x0_xor_x2);
 
         arc_test_stream arcs(out);
 
@@ -1345,7 +1348,7 @@ go_bandit([]() {
         //        require forwarding two elements one at a time.
         */
 
-        __bdd out = bdd_ite(bdd_x0_xnor_x2, bdd_not(bdd_x2), bdd_1);
+        __bdd out = bdd_ite(ep, bdd_x0_xnor_x2, bdd_not(bdd_x2), bdd_1);
 
         arc_test_stream arcs(out);
 
@@ -1451,7 +1454,7 @@ go_bandit([]() {
         //                       /   \         /   \                    (To reproduce: look at actual ids and sorting)
         //                       F   T         F   T
         */
-        __bdd out = bdd_ite(bdd_x1_xor_x2_2, bdd_1, bdd_2);
+        __bdd out = bdd_ite(ep, bdd_x1_xor_x2_2, bdd_1, bdd_2);
 
         arc_test_stream arcs(out);
 
@@ -1566,7 +1569,7 @@ go_bandit([]() {
         //          (3,4,4) node needs to forward (3,4,_) information once.
         */
 
-        __bdd out = bdd_ite(bdd_if, bdd_2, bdd_4);
+        __bdd out = bdd_ite(ep, bdd_if, bdd_2, bdd_4);
 
         arc_test_stream arcs(out);
 
@@ -1672,7 +1675,7 @@ go_bandit([]() {
         //                  F   T          T   F
         */
 
-        __bdd out = bdd_ite(bdd_if, bdd_8, bdd_7);
+        __bdd out = bdd_ite(ep, bdd_if, bdd_8, bdd_7);
 
         arc_test_stream arcs(out);
 
@@ -1748,7 +1751,7 @@ go_bandit([]() {
         //                  T   F     F   T
         */
 
-        __bdd out = bdd_ite(bdd_6, bdd_4, bdd_2);
+        __bdd out = bdd_ite(ep, bdd_6, bdd_4, bdd_2);
 
         arc_test_stream arcs(out);
 
@@ -1844,7 +1847,7 @@ go_bandit([]() {
                        << node(1,0,terminal_F,ptr_uint64(3,42)); // 1
         }
 
-        __bdd out = bdd_ite(bdd_x0, bdd_x2, bdd_x1_and_x3);
+        __bdd out = bdd_ite(ep, bdd_x0, bdd_x2, bdd_x1_and_x3);
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>()->canonical, Is().False());
 
         node_test_stream ns(out);
@@ -1942,7 +1945,7 @@ go_bandit([]() {
             ;
         }
 
-        __bdd out = bdd_ite(bdd_not(bdd_x0_xor_x1), bdd_then, bdd_else);
+        __bdd out = bdd_ite(ep, bdd_not(bdd_x0_xor_x1), bdd_then, bdd_else);
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>()->canonical, Is().False());
 
         node_test_stream ns(out);
@@ -2070,16 +2073,16 @@ go_bandit([]() {
           nw_b << node(1, node::max_id,terminal_T,terminal_F);
         }
 
-        bdd out_1 = bdd_ite(bdd_if, bdd_a, bdd_b);
+        bdd out_1 = bdd_ite(ep, bdd_if, bdd_a, bdd_b);
         AssertThat(bdd_iscanonical(out_1), Is().True());
 
-        bdd out_1n = bdd_ite(bdd_not(bdd_if), bdd_a, bdd_b);
+        bdd out_1n = bdd_ite(ep, bdd_not(bdd_if), bdd_a, bdd_b);
         AssertThat(bdd_iscanonical(out_1n), Is().True());
 
-        bdd out_2 = bdd_ite(bdd_if, bdd_b, bdd_a);
+        bdd out_2 = bdd_ite(ep, bdd_if, bdd_b, bdd_a);
         AssertThat(bdd_iscanonical(out_2), Is().True());
 
-        bdd out_2n = bdd_ite(bdd_not(bdd_if), bdd_b, bdd_a);
+        bdd out_2n = bdd_ite(ep, bdd_not(bdd_if), bdd_b, bdd_a);
         AssertThat(bdd_iscanonical(out_2n), Is().True());
       });
 
@@ -2115,16 +2118,16 @@ go_bandit([]() {
         }
         AssertThat(bdd_iscanonical(bdd(bdd_c)), Is().True());
 
-        bdd out_1 = bdd_ite(bdd_if, bdd_not(bdd_a), bdd_b);
+        bdd out_1 = bdd_ite(ep, bdd_if, bdd_not(bdd_a), bdd_b);
         AssertThat(bdd_iscanonical(out_1), Is().True());
 
-        bdd out_2 = bdd_ite(bdd_if, bdd_a, bdd_not(bdd_b));
+        bdd out_2 = bdd_ite(ep, bdd_if, bdd_a, bdd_not(bdd_b));
         AssertThat(bdd_iscanonical(out_2), Is().False());
 
-        bdd out_3 = bdd_ite(bdd_if, bdd_a, bdd_not(bdd_c));
+        bdd out_3 = bdd_ite(ep, bdd_if, bdd_a, bdd_not(bdd_c));
         AssertThat(bdd_iscanonical(out_3), Is().True());
 
-        bdd out_4 = bdd_ite(bdd_if, bdd_not(bdd_b), bdd_not(bdd_a));
+        bdd out_4 = bdd_ite(ep, bdd_if, bdd_not(bdd_b), bdd_not(bdd_a));
         AssertThat(bdd_iscanonical(out_4), Is().False());
       });
 
@@ -2149,18 +2152,18 @@ go_bandit([]() {
           nw_b << node(2, node::max_id,terminal_T,terminal_F);
         }
 
-        bdd out_1 = bdd_ite(bdd_if, bdd_a, bdd_b);
+        bdd out_1 = bdd_ite(ep, bdd_if, bdd_a, bdd_b);
         AssertThat(bdd_iscanonical(out_1), Is().True());
 
-        bdd out_2 = bdd_ite(bdd_not(bdd_if), bdd_a, bdd_b);
+        bdd out_2 = bdd_ite(ep, bdd_not(bdd_if), bdd_a, bdd_b);
         AssertThat(bdd_iscanonical(out_2), Is().False());
 
-        bdd out_3 = bdd_ite(bdd_not(bdd_if), bdd_b, bdd_a);
+        bdd out_3 = bdd_ite(ep, bdd_not(bdd_if), bdd_b, bdd_a);
         AssertThat(bdd_iscanonical(out_3), Is().True());
       });
 
       it("should not zip if bdd_then is not beyond max_var of bdd_if", [&]() {
-        __bdd out = bdd_ite(bdd_x1, bdd_x0, bdd_x2);
+        __bdd out = bdd_ite(ep, bdd_x1, bdd_x0, bdd_x2);
 
         arc_test_stream arcs(out);
 
@@ -2212,7 +2215,7 @@ go_bandit([]() {
       });
 
       it("should not zip if bdd_else is not beyond max_var of bdd_if", [&]() {
-        __bdd out = bdd_ite(bdd_x1, bdd_x2, bdd_x0);
+        __bdd out = bdd_ite(ep, bdd_x1, bdd_x2, bdd_x0);
 
         arc_test_stream arcs(out);
 
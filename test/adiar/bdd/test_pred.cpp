@@ -291,5 +291,181 @@ go_bandit([]() {
         AssertThat(bdd_iscube(bdd_23_13), Is().False());
       });
     });
+
+    describe("bdd_implies", [&]() {
+      it("accepts F -> x0", [&]() {
+        AssertThat(bdd_implies(bdd_F, bdd_x0), Is().True());
+      });
+
+      it("accepts x0 -> T", [&]() {
+        AssertThat(bdd_implies(bdd_x0, bdd_T), Is().True());
+      });
+
+      it("rejects T -> x0", [&]() {
+        AssertThat(bdd_implies(bdd_T, bdd_x0), Is().False());
+      });
+
+      it("rejects x0 -> F", [&]() {
+        AssertThat(bdd_implies(bdd_x0, bdd_F), Is().False());
+      });
+
+      it("accepts x0 -> x0 [same file]", [&]() {
+        AssertThat(bdd_implies(bdd_x0, bdd_x0), Is().True());
+      });
+
+      it("rejects x0 -> ~x0 [complement flag]", [&]() {
+        AssertThat(bdd_implies(bdd_x0, bdd(bdd_x0, true)), Is().False());
+      });
+
+      it("rejects x0 -> x1", [&]() {
+        AssertThat(bdd_implies(bdd_x0, bdd_x1), Is().False());
+      });
+
+      it("accepts x0 & x2 -> x0", [&]() {
+        AssertThat(bdd_implies(bdd_0and2, bdd_x0), Is().True());
+      });
+
+      it("rejects x0 -> x0 & x2", [&]() {
+        AssertThat(bdd_implies(bdd_x0, bdd_0and2), Is().False());
+      });
+
+      it("accepts ~x0 -> ~(x0 & x2) [complement flag]", [&]() {
+        AssertThat(bdd_implies(bdd_not_x0, bdd(bdd_0and2, true)), Is().True());
+      });
+
+      it("accepts x0 & x2 -> x0 | x2", [&]() {
+        AssertThat(bdd_implies(bdd_0and2, bdd_0or2), Is().True());
+      });
+
+      it("rejects x0 | x2 -> x0 & x2", [&]() {
+        AssertThat(bdd_implies(bdd_0or2, bdd_0and2), Is().False());
+      });
+
+      it("accepts x0 & x2 -> (x0 | x1) & x2", [&]() {
+        AssertThat(bdd_implies(bdd_0and2, bdd_23_13), Is().True());
+      });
+
+      it("rejects (x0 | x1) & x2 -> x0 & x2", [&]() {
+        AssertThat(bdd_implies(bdd_23_13, bdd_0and2), Is().False());
+      });
+
+      it("accepts x0 & x2 -> (x0 | x1) & x2 [Priority_Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+        AssertThat(bdd_implies(ep, bdd_0and2, bdd_23_13), Is().True());
+      });
+
+      it("rejects (x0 | x1) & x2 -> x0 & x2 [Priority_Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+        AssertThat(bdd_implies(ep, bdd_23_13, bdd_0and2), Is().False());
+      });
+
+      it("accepts x0 & x2 -> (x0 | x1) & x2 [Random_Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+        AssertThat(bdd_implies(ep, bdd_0and2, bdd_23_13), Is().True());
+      });
+
+      it("rejects (x0 | x1) & x2 -> x0 & x2 [Random_Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+        AssertThat(bdd_implies(ep, bdd_23_13, bdd_0and2), Is().False());
+      });
+
+      it("agrees with bdd_imp(f,g) == T on (x0 | x1) & x2 and x1 | x2", [&]() {
+        const bdd f = bdd_23_13;
+        const bdd g = bdd_or(bdd_ithvar(1), bdd_ithvar(2));
+
+        AssertThat(bdd_implies(f, g), Is().EqualTo(bdd_istrue(bdd_imp(f, g))));
+        AssertThat(bdd_implies(g, f), Is().EqualTo(bdd_istrue(bdd_imp(g, f))));
+      });
+    });
+
+    describe("bdd_subseteq", [&]() {
+      it("accepts x0 & x2 <= x0 | x2", [&]() {
+        AssertThat(bdd_subseteq(bdd_0and2, bdd_0or2), Is().True());
+      });
+
+      it("rejects x0 | x2 <= x0 & x2", [&]() {
+        AssertThat(bdd_subseteq(bdd_0or2, bdd_0and2), Is().False());
+      });
+    });
+
+    describe("bdd_disjoint", [&]() {
+      it("accepts F and T", [&]() {
+        AssertThat(bdd_disjoint(bdd_F, bdd_T), Is().True());
+      });
+
+      it("rejects T and T", [&]() {
+        AssertThat(bdd_disjoint(bdd_T, bdd_T), Is().False());
+      });
+
+      it("rejects T and x0", [&]() {
+        AssertThat(bdd_disjoint(bdd_T, bdd_x0), Is().False());
+      });
+
+      it("accepts x0 and F", [&]() {
+        AssertThat(bdd_disjoint(bdd_x0, bdd_F), Is().True());
+      });
+
+      it("rejects x0 and x0 [same file]", [&]() {
+        AssertThat(bdd_disjoint(bdd_x0, bdd_x0), Is().False());
+      });
+
+      it("accepts x0 and ~x0 [complement flag]", [&]() {
+        AssertThat(bdd_disjoint(bdd_x0, bdd(bdd_x0, true)), Is().True());
+      });
+
+      it("accepts x0 and ~x0 [file content]", [&]() {
+        AssertThat(bdd_disjoint(bdd_x0, bdd_not_x0), Is().True());
+      });
+
+      it("rejects x0 and x1", [&]() {
+        AssertThat(bdd_disjoint(bdd_x0, bdd_x1), Is().False());
+      });
+
+      it("accepts x0 & x2 and ~x0", [&]() {
+        AssertThat(bdd_disjoint(bdd_0and2, bdd_not_x0), Is().True());
+      });
+
+      it("rejects x0 & x2 and x1", [&]() {
+        AssertThat(bdd_disjoint(bdd_0and2, bdd_x1), Is().False());
+      });
+
+      it("accepts (x0 | x1) & x2 and ~(x0 | x2) [complement flag]", [&]() {
+        AssertThat(bdd_disjoint(bdd_23_13, bdd(bdd_0or2, true)), Is().True());
+      });
+
+      it("rejects (x0 | x1) & x2 and ~(x0 & x2) [complement flag]", [&]() {
+        AssertThat(bdd_disjoint(bdd_23_13, bdd(bdd_0and2, true)), Is().False());
+      });
+
+      it("accepts (x0 | x1) & x2 and ~(x0 | x2) [Priority_Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+        AssertThat(bdd_disjoint(ep, bdd_23_13, bdd(bdd_0or2, true)), Is().True());
+      });
+
+      it("rejects (x0 | x1) & x2 and ~(x0 & x2) [Priority_Queue]", [&]() {
+        const exec_policy ep = exec_policy::access::Priority_Queue;
+        AssertThat(bdd_disjoint(ep, bdd_23_13, bdd(bdd_0and2, true)), Is().False());
+      });
+
+      it("accepts (x0 | x1) & x2 and ~(x0 | x2) [Random_Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+        AssertThat(bdd_disjoint(ep, bdd_23_13, bdd(bdd_0or2, true)), Is().True());
+      });
+
+      it("rejects (x0 | x1) & x2 and ~(x0 & x2) [Random_Access]", [&]() {
+        const exec_policy ep = exec_policy::access::Random_Access;
+        AssertThat(bdd_disjoint(ep, bdd_23_13, bdd(bdd_0and2, true)), Is().False());
+      });
+    });
+
+    describe("bdd_intersects", [&]() {
+      it("rejects x0 & x2 and ~x0", [&]() {
+        AssertThat(bdd_intersects(bdd_0and2, bdd_not_x0), Is().False());
+      });
+
+      it("accepts x0 & x2 and x1", [&]() {
+        AssertThat(bdd_intersects(bdd_0and2, bdd_x1), Is().True());
+      });
+    });
   });
  });
@@ -781,22 +781,25 @@ go_bandit([]() {
 
     ////////////////////////////////////////////////////////////////////////////
     describe("bdd_exists(const bdd&, bdd::label_type)", [&]() {
+      // Pin the levelized algorithms, since their unreduced output is tested.
+      const exec_policy ep = exec_policy::engine::Levelized;
+
       it("should quantify T terminal-only BDD as itself", [&]() {
-        __bdd out = bdd_exists(terminal_T, 42);
+        __bdd out = bdd_exists(ep, terminal_T, 42);
 
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>(), Is().EqualTo(terminal_T));
         AssertThat(out.negate, Is().False());
       });
 
       it("should quantify F terminal-only BDD as itself", [&]() {
-        __bdd out = bdd_exists(terminal_F, 21);
+        __bdd out = bdd_exists(ep, terminal_F, 21);
 
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>(), Is().EqualTo(terminal_F));
         AssertThat(out.negate, Is().False());
       });
 
       it("should shortcut quantification of root into T terminal [BDD 1]", [&]() {
-        __bdd out = bdd_exists(bdd_1, 0);
+        __bdd out = bdd_exists(ep, bdd_1, 0);
 
         node_test_stream out_nodes(out);
 
@@ -816,7 +819,7 @@ go_bandit([]() {
       });
 
       it("should shortcut quantification of root into T terminal [x2]", [&]() {
-        __bdd out = bdd_exists(bdd_x2, 2);
+        __bdd out = bdd_exists(ep, bdd_x2, 2);
 
         node_test_stream out_nodes(out);
 
@@ -836,14 +839,14 @@ go_bandit([]() {
       });
 
       it("should shortcut quantification on non-existent label in input [BDD 1]", [&]() {
-        __bdd out = bdd_exists(bdd_1, 42);
+        __bdd out = bdd_exists(ep, bdd_1, 42);
 
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>(), Is().EqualTo(bdd_1));
         AssertThat(out.negate, Is().False());
       });
 
       it("should quantify bottom-most nodes [BDD 1]", [&]() {
-        __bdd out = bdd_exists(bdd_1, 1);
+        __bdd out = bdd_exists(ep, bdd_1, 1);
 
         arc_test_stream arcs(out);
         AssertThat(arcs.can_pull_internal(), Is().False());
@@ -872,7 +875,7 @@ go_bandit([]() {
       });
 
       it("should quantify root without terminal arcs [BDD 2]", [&]() {
-        __bdd out = bdd_exists(bdd_2, 0);
+        __bdd out = bdd_exists(ep, bdd_2, 0);
 
         arc_test_stream arcs(out);
 
@@ -921,7 +924,7 @@ go_bandit([]() {
       });
 
       it("should quantify root with F terminal [BDD 5]", [&]() {
-        __bdd out = bdd_exists(bdd_5, 0);
+        __bdd out = bdd_exists(ep, bdd_5, 0);
 
         arc_test_stream arcs(out);
 
@@ -972,7 +975,7 @@ go_bandit([]() {
       });
 
       it("should quantify nodes with terminal or nodes as children [BDD 2]", [&]() {
-        __bdd out = bdd_exists(bdd_2, 1);
+        __bdd out = bdd_exists(ep, bdd_2, 1);
 
         arc_test_stream arcs(out);
 
@@ -1021,7 +1024,7 @@ go_bandit([]() {
       });
 
       it("should output terminal arcs in order, despite the order of resolvement [BDD 2]", [&]() {
-        __bdd out = bdd_exists(bdd_2, 2);
+        __bdd out = bdd_exists(ep, bdd_2, 2);
 
         arc_test_stream arcs(out);
 
@@ -1070,7 +1073,7 @@ go_bandit([]() {
       });
 
       it("should keep nodes as is when skipping quantified level [BDD 3]", [&]() {
-        __bdd out = bdd_exists(bdd_3, 1);
+        __bdd out = bdd_exists(ep, bdd_3, 1);
 
         arc_test_stream arcs(out);
 
@@ -1121,7 +1124,7 @@ go_bandit([]() {
       });
 
       it("should output terminal arcs in order, despite the order of resolvement [BDD 3]", [&]() {
-        __bdd out = bdd_exists(bdd_3, 2);
+        __bdd out = bdd_exists(ep, bdd_3, 2);
 
         arc_test_stream arcs(out);
 
@@ -1164,7 +1167,7 @@ go_bandit([]() {
       });
 
       it("should resolve terminal-terminal requests in [BDD 5]", [&]() {
-        __bdd out = bdd_exists(bdd_5, 1);
+        __bdd out = bdd_exists(ep, bdd_5, 1);
 
         arc_test_stream arcs(out);
 
@@ -1219,7 +1222,7 @@ go_bandit([]() {
           bdd_chain_w << n4 << n3 << n2 << n1;
         }
 
-        __bdd out = bdd_exists(bdd_chain, 2);
+        __bdd out = bdd_exists(ep, bdd_chain, 2);
 
         arc_test_stream arcs(out);
 
@@ -1259,7 +1262,7 @@ go_bandit([]() {
       });
 
       it("can forward information across a level [BDD 6]", [&]() {
-        __bdd out = bdd_exists(bdd_6, 1);
+        __bdd out = bdd_exists(ep, bdd_6, 1);
 
         arc_test_stream arcs(out);
 
@@ -1324,7 +1327,7 @@ go_bandit([]() {
       });
 
       it("can forward multiple arcs to the same node across a level [BDD 7]", [&]() {
-        __bdd out = bdd_exists(bdd_7, 1);
+        __bdd out = bdd_exists(ep, bdd_7, 1);
 
         arc_test_stream arcs(out);
 
@@ -1363,7 +1366,7 @@ go_bandit([]() {
       });
 
       it("should collapse tuple requests of the same node back into request on a single node [BDD 8a]", [&]() {
-        __bdd out = bdd_exists(bdd_8a, 1);
+        __bdd out = bdd_exists(ep, bdd_8a, 1);
 
         arc_test_stream arcs(out);
 
@@ -1414,7 +1417,7 @@ go_bandit([]() {
       });
 
       it("should collapse tuple requests of the same node back into request on a single node [BDD 8b]", [&]() {
-        __bdd out = bdd_exists(bdd_8b, 1);
+        __bdd out = bdd_exists(ep, bdd_8b, 1);
 
         arc_test_stream arcs(out);
 
@@ -4315,22 +4318,25 @@ go_bandit([]() {
     // We will not test the Forall operator as much, since it is the same
     // underlying algorithm, but just with the AND operator.
     describe("bdd_forall(const bdd&, bdd::label_type)", [&]() {
+      // Pin the levelized algorithms, since their unreduced output is tested.
+      const exec_policy ep = exec_policy::engine::Levelized;
+
       it("quantifies T terminal-only BDD as itself", [&]() {
-        __bdd out = bdd_forall(terminal_T, 42);
+        __bdd out = bdd_forall(ep, terminal_T, 42);
 
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>(), Is().EqualTo(terminal_T));
         AssertThat(out.negate, Is().False());
       });
 
       it("quantifies F terminal-only BDD as itself", [&]() {
-        __bdd out = bdd_forall(terminal_F, 21);
+        __bdd out = bdd_forall(ep, terminal_F, 21);
 
         AssertThat(out.get<shared_levelized_file<bdd::node_type>>(), Is().EqualTo(terminal_F));
         AssertThat(out.negate, Is().False());
       });
 
       it("quantifies root with non-shortcutting terminal [BDD 1]", [&]() {
-        __bdd out = bdd_forall(bdd_1, 0);
+        __bdd out = bdd_forall(ep, bdd_1, 0);
 
         arc_test_stream arcs(out);
 
@@ -4360,7 +4366,7 @@ go_bandit([]() {
       });
 
       it("quantifies root of [BDD 3]", [&]() {
-        __bdd out = bdd_forall(bdd_3, 0);
+        __bdd out = bdd_forall(ep, bdd_3, 0);
 
         arc_test_stream arcs(out);
 
@@ -4409,7 +4415,7 @@ go_bandit([]() {
       });
 
       it("should prune shortcuttable requests [BDD 4]", [&]() {
-        __bdd out = bdd_forall(bdd_4, 2);
+        __bdd out = bdd_forall(ep, bdd_4, 2);
 
         arc_test_stream arcs(out);
 
@@ -4461,7 +4467,7 @@ go_bandit([]() {
       });
 
       it("can forward information across a level [BDD 6]", [&]() {
-        __bdd out = bdd_forall(bdd_6, 1);
+        __bdd out = bdd_forall(ep, bdd_6, 1);
 
         arc_test_stream arcs(out);
 
@@ -4526,7 +4532,7 @@ go_bandit([]() {
       });
 
       it("should collapse tuple requests of the same node back into request on a single node [BDD 8a]", [&]() {
-        __bdd out = bdd_forall(bdd_8a, 1);
+        __bdd out = bdd_forall(ep, bdd_8a, 1);
 
         arc_test_stream arcs(out);
 
@@ -0,0 +1,248 @@
+#include "../../../test.h"
+
+#include <adiar/bdd/bdd_policy.h>
+#include <adiar/internal/algorithms/depth_first.h>
+
+go_bandit([]() {
+  describe("adiar/internal/algorithms/depth_first.h", []() {
+    const ptr_uint64 terminal_F = ptr_uint64(false);
+    const ptr_uint64 terminal_T = ptr_uint64(true);
+
+    shared_levelized_file<bdd::node_type> nf_x0;
+    {
+      node_writer nw(nf_x0);
+      nw << node(0, node::max_id, terminal_F, terminal_T);
+    }
+    const bdd bdd_x0(nf_x0);
+
+    shared_levelized_file<bdd::node_type> nf_x1;
+    {
+      node_writer nw(nf_x1);
+      nw << node(1, node::max_id, terminal_F, terminal_T);
+    }
+    const bdd bdd_x1(nf_x1);
+
+    shared_levelized_file<bdd::node_type> nf_x2;
+    {
+      node_writer nw(nf_x2);
+      nw << node(2, node::max_id, terminal_F, terminal_T);
+    }
+    const bdd bdd_x2(nf_x2);
+
+    /*
+    //        1         ---- x0
+    //       / \
+    //       2  \       ---- x1
+    //      / \ /
+    //      F  3        ---- x2
+    //        / \
+    //        F T
+    */
+    shared_levelized_file<bdd::node_type> nf_1;
+    {
+      node_writer nw(nf_1);
+      nw << node(2, node::max_id,   terminal_F, terminal_T)
+         << node(1, node::max_id,   terminal_F, ptr_uint64(2, ptr_uint64::max_id))
+         << node(0, node::max_id,   ptr_uint64(1, ptr_uint64::max_id), ptr_uint64(2, ptr_uint64::max_id));
+    }
+    const bdd bdd_1(nf_1);
+
+    const exec_policy ep_df = exec_policy::engine::Depth_First;
+    const exec_policy ep_lvl = exec_policy::engine::Levelized;
+
+    describe("depth_first_fits(ep, size)", [&]() {
+      it("is true for 'Depth_First' independent of size", [&]() {
+        AssertThat(depth_first_fits(ep_df, 0u), Is().True());
+        AssertThat(depth_first_fits(ep_df, depth_first_threshold + 1u), Is().True());
+      });
+
+      it("is false for 'Levelized' independent of size", [&]() {
+        AssertThat(depth_first_fits(ep_lvl, 0u), Is().False());
+        AssertThat(depth_first_fits(ep_lvl, depth_first_threshold), Is().False());
+      });
+
+      it("is true for 'Auto' below the threshold", [&]() {
+        AssertThat(depth_first_fits(exec_policy(), depth_first_threshold), Is().True());
+      });
+
+      it("is false for 'Auto' above the threshold", [&]() {
+        AssertThat(depth_first_fits(exec_policy(), depth_first_threshold + 1u), Is().False());
+      });
+
+      it("is false for 'Auto' if other settings are pinned", [&]() {
+        AssertThat(depth_first_fits(exec_policy::access::Random_Access, 2u), Is().False());
+        AssertThat(depth_first_fits(exec_policy::memory::Internal, 2u), Is().False());
+        AssertThat(depth_first_fits(exec_policy::quantify::Nested, 2u), Is().False());
+      });
+
+      it("is false for 'Auto' with a progress callback or cancellation token", [&]() {
+        const exec_policy::progress p([](size_t, size_t, size_t) { });
+        AssertThat(depth_first_fits(p, 2u), Is().False());
+
+        const exec_policy::cancellation c;
+        AssertThat(depth_first_fits(c, 2u), Is().False());
+        AssertThat(depth_first_fits(exec_policy::cancellation::none(), 2u), Is().True());
+      });
+
+      it("is false for 'Auto' with a deadline or arc budget", [&]() {
+        const exec_policy::deadline d(std::chrono::hours(1));
+        AssertThat(depth_first_fits(d, 2u), Is().False());
+
+        const exec_policy::arc_budget ab(1024u);
+        AssertThat(depth_first_fits(ab, 2u), Is().False());
+      });
+    });
+
+    describe("depth_first_engine<bdd_policy>", [&]() {
+      it("applies reduction rule 1", [&]() {
+        depth_first_engine<bdd_policy> engine(8u);
+
+        const ptr_uint64 res = engine.make_node(0, terminal_T, terminal_T);
+        AssertThat(res, Is().EqualTo(terminal_T));
+        AssertThat(engine.size(), Is().EqualTo(0u));
+      });
+
+      it("applies reduction rule 2", [&]() {
+        depth_first_engine<bdd_policy> engine(8u);
+
+        const ptr_uint64 res_1 = engine.make_node(0, terminal_F, terminal_T);
+        const ptr_uint64 res_2 = engine.make_node(0, terminal_F, terminal_T);
+        AssertThat(res_1, Is().EqualTo(res_2));
+        AssertThat(engine.size(), Is().EqualTo(1u));
+      });
+
+      it("shares nodes between imported diagrams", [&]() {
+        depth_first_engine<bdd_policy> engine(8u);
+
+        engine.import(bdd_x2);
+        AssertThat(engine.size(), Is().EqualTo(1u));
+
+        engine.import(bdd_1);
+        AssertThat(engine.size(), Is().EqualTo(3u));
+      });
+
+      it("throws when exceeding its budget", [&]() {
+        depth_first_engine<bdd_policy> engine(2u);
+
+        AssertThrows(depth_first_overflow, engine.import(bdd_1));
+      });
+
+      it("exports a canonical node file", [&]() {
+        depth_first_engine<bdd_policy> engine(8u);
+
+        const ptr_uint64 root = engine.import(bdd_1);
+        const bdd out(engine.export_to_file(root));
+
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(1, node::max_id,
+                                                       terminal_F,
+                                                       ptr_uint64(2, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(0, node::max_id,
+                                                       ptr_uint64(1, ptr_uint64::max_id),
+                                                       ptr_uint64(2, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        AssertThat(out->canonical, Is().True());
+        AssertThat(out->width, Is().EqualTo(1u));
+        AssertThat(out->number_of_terminals[false], Is().EqualTo(2u));
+        AssertThat(out->number_of_terminals[true],  Is().EqualTo(1u));
+      });
+    });
+
+    describe("bdd_apply(ep, f, g, op)", [&]() {
+      it("computes x0 & x1 as a reduced BDD", [&]() {
+        __bdd out = bdd_and(ep_df, bdd_x0, bdd_x1);
+
+        AssertThat(out.has<shared_levelized_file<bdd::node_type>>(), Is().True());
+
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(1, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(0, node::max_id,
+                                                       terminal_F,
+                                                       ptr_uint64(1, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().False());
+      });
+
+      it("computes the same as the levelized algorithm [x0 ^ BDD 1]", [&]() {
+        const bdd out_df  = bdd_xor(ep_df,  bdd_x0, bdd_1);
+        const bdd out_lvl = bdd_xor(ep_lvl, bdd_x0, bdd_1);
+
+        AssertThat(bdd_iscanonical(out_df), Is().True());
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+
+      it("computes the same as the levelized algorithm [~BDD 1 | x1]", [&]() {
+        const bdd out_df  = bdd_or(ep_df,  bdd_not(bdd_1), bdd_x1);
+        const bdd out_lvl = bdd_or(ep_lvl, bdd_not(bdd_1), bdd_x1);
+
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+
+      it("collapses to a terminal [x2 & ~x2]", [&]() {
+        const bdd out = bdd_and(ep_df, bdd_x2, bdd_nithvar(2));
+
+        AssertThat(bdd_isfalse(out), Is().True());
+      });
+    });
+
+    describe("bdd_ite(ep, f, g, h)", [&]() {
+      it("computes the same as the levelized algorithm [x0 ? x1 : x2]", [&]() {
+        const bdd out_df  = bdd_ite(ep_df,  bdd_x0, bdd_x1, bdd_x2);
+        const bdd out_lvl = bdd_ite(ep_lvl, bdd_x0, bdd_x1, bdd_x2);
+
+        AssertThat(bdd_iscanonical(out_df), Is().True());
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+
+      it("computes the same as the levelized algorithm [x1 ? BDD 1 : ~x2]", [&]() {
+        const bdd out_df  = bdd_ite(ep_df,  bdd_x1, bdd_1, bdd_not(bdd_x2));
+        const bdd out_lvl = bdd_ite(ep_lvl, bdd_x1, bdd_1, bdd_not(bdd_x2));
+
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+    });
+
+    describe("bdd_exists(ep, f, i)", [&]() {
+      it("computes the same as the levelized algorithm [BDD 1, x1]", [&]() {
+        const bdd out_df  = bdd_exists(ep_df,  bdd_1, 1);
+        const bdd out_lvl = bdd_exists(ep_lvl, bdd_1, 1);
+
+        AssertThat(bdd_iscanonical(out_df), Is().True());
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+
+      it("computes the same as the levelized algorithm [BDD 1, x2]", [&]() {
+        const bdd out_df  = bdd_exists(ep_df,  bdd_1, 2);
+        const bdd out_lvl = bdd_exists(ep_lvl, bdd_1, 2);
+
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+    });
+
+    describe("bdd_forall(ep, f, i)", [&]() {
+      it("computes the same as the levelized algorithm [BDD 1, x0]", [&]() {
+        const bdd out_df  = bdd_forall(ep_df,  bdd_1, 0);
+        const bdd out_lvl = bdd_forall(ep_lvl, bdd_1, 0);
+
+        AssertThat(out_df, Is().EqualTo(out_lvl));
+      });
+    });
+  });
+ });
@@ -1,5 +1,7 @@
 #include "../../../test.h"
 
+#include <adiar/internal/algorithms/reduce.h>
+
 go_bandit([]() {
   describe("adiar/internal/algorithms/reduce.h", [&]() {
     // The reduce<dd_policy> function is used within the constructors of the BDD
@@ -49,6 +51,64 @@ go_bandit([]() {
       AssertThat(out.is_negated(), Is().True());
     });
 
+    describe("reduce_rule2_table", [&]() {
+      it("finds duplicates independent of flags", [&]() {
+        reduce_rule2_table table(4u);
+
+        AssertThat(table.insert(node(1, 3, terminal_F, terminal_T)), Is().True());
+        AssertThat(table.insert(node(1, 2, terminal_T, terminal_F)), Is().True());
+        AssertThat(table.insert(node(1, 1, flag(terminal_F), terminal_T)), Is().False());
+        AssertThat(table.insert(node(1, 0, terminal_T, flag(terminal_F))), Is().False());
+
+        AssertThat(table.unique_size(), Is().EqualTo(2u));
+      });
+
+      it("sorts unique nodes in canonical order", [&]() {
+        reduce_rule2_table table(3u);
+
+        table.insert(node(1, 2, terminal_F, terminal_T));
+        table.insert(node(1, 1, terminal_T, terminal_F));
+        table.insert(node(1, 0, terminal_F, terminal_F));
+
+        table.sort();
+
+        AssertThat(table.unique(0).high(), Is().EqualTo(terminal_T));
+        AssertThat(table.unique(1).high(), Is().EqualTo(terminal_F));
+        AssertThat(table.unique(1).low(),  Is().EqualTo(terminal_T));
+        AssertThat(table.unique(2).low(),  Is().EqualTo(terminal_F));
+      });
+
+      it("provides mappings in order of insertion", [&]() {
+        reduce_rule2_table table(3u);
+
+        table.insert(node(1, 2, terminal_F, terminal_T));
+        table.insert(node(1, 1, terminal_T, terminal_F));
+        table.insert(node(1, 0, terminal_F, terminal_T));
+
+        table.sort();
+
+        table.set_unique(0, node(1, node::max_id,   terminal_F, terminal_T));
+        table.set_unique(1, node(1, node::max_id-1, terminal_T, terminal_F));
+
+        AssertThat(table.can_pull(), Is().True());
+        mapping m = table.pull();
+        AssertThat(m.old_uid, Is().EqualTo(node::uid_type(1, 2)));
+        AssertThat(m.new_uid, Is().EqualTo(node::uid_type(1, node::max_id)));
+
+        AssertThat(table.can_pull(), Is().True());
+        m = table.pull();
+        AssertThat(m.old_uid, Is().EqualTo(node::uid_type(1, 1)));
+        AssertThat(m.new_uid, Is().EqualTo(node::uid_type(1, node::max_id-1)));
+
+        AssertThat(table.can_pull(), Is().True());
+        m = table.pull();
+        AssertThat(m.old_uid, Is().EqualTo(node::uid_type(1, 0)));
+        AssertThat(m.new_uid, Is().EqualTo(node::uid_type(1, node::max_id)));
+
+        AssertThat(table.can_pull(), Is().False());
+      });
+    });
+
     describe("Reduction Rule 2", [&]() {
       it("applies to terminal arcs [1]", [&]() {
         /*
@@ -228,6 +228,37 @@ go_bandit([]() {
         AssertThat(merger.pull(), Is().EqualTo(4u));
       });
 
+      it("can peek width of merge of two level_info stream", [&]() {
+        shared_levelized_file<int> f1;
+        shared_levelized_file<int> f2;
+
+        { // Garbage collect the writers
+          levelized_file_writer<int> fw1(f1);
+
+          fw1.push(level_info(4,2u));
+          fw1.push(level_info(2,1u));
+
+          levelized_file_writer<int> fw2(f2);
+
+          fw2.push(level_info(4,3u));
+          fw2.push(level_info(3,2u));
+          fw2.push(level_info(1,1u));
+        }
+
+        level_merger<shared_levelized_file<int>, std::less<>, 2> merger;
+
+        merger.hook({f1, f2});
+
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(1u));
+        AssertThat(merger.peek_width(), Is().EqualTo(1u));
+        AssertThat(merger.pull(), Is().EqualTo(2u));
+        AssertThat(merger.peek_width(), Is().EqualTo(2u));
+        AssertThat(merger.pull(), Is().EqualTo(3u));
+        AssertThat(merger.peek_width(), Is().EqualTo(5u));
+        AssertThat(merger.pull(), Is().EqualTo(4u));
+      });
+
       it("can merge levels in reverse", [&]() {
         shared_levelized_file<int> f1;
         shared_levelized_file<int> f2;
@@ -315,6 +346,23 @@ go_bandit([]() {
         AssertThat(merger.can_pull(), Is().False());
       });
 
+      it("has no width of levels in a label_file", [&]() {
+        shared_file<ptr_uint64::label_type> f;
+
+        { // Garbage collect the writers
+          label_writer w(f);
+          w << 0 << 2;
+        }
+
+        level_merger<shared_file<ptr_uint64::label_type>, std::less<>, 1> merger;
+
+        merger.hook({f});
+
+        AssertThat(merger.peek_width(), Is().EqualTo(0u));
+        AssertThat(merger.pull(), Is().EqualTo(0u));
+        AssertThat(merger.peek_width(), Is().EqualTo(0u));
+      });
+
       it("can merge two label_files", [&]() {
         shared_file<ptr_uint64::label_type> f1;
         shared_file<ptr_uint64::label_type> f2;
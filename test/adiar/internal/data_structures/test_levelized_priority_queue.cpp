@@ -5645,6 +5645,255 @@ go_bandit([]() {
 
           AssertThat(pq.can_pull(), Is().False());
         });
+
+        it("uses fewer buckets for wide levels", []() {
+          lpq_test_file f;
+
+          { // Garbage collect the writer early
+            lpq_test_writer fw(f);
+
+            fw.push(level_info(6,1u));  // .
+            fw.push(level_info(5,1u));  // .
+            fw.push(level_info(4,1u));  // overflow
+            fw.push(level_info(3,20u)); // bucket
+            fw.push(level_info(2,20u)); // bucket
+            fw.push(level_info(1,1u));  // skipped
+          }
+
+          test_priority_queue<lpq_test_file, 3> pq({f}, memory_available(), 32, stats_lpq_tests);
+
+          AssertThat(pq.buckets_used(), Is().EqualTo(2u));
+
+          AssertThat(pq.has_next_level(), Is().True());
+          AssertThat(pq.next_level(), Is().EqualTo(2u));
+
+          pq.push(lpq_test_data {2, 1});
+          pq.push(lpq_test_data {3, 1});
+          pq.push(lpq_test_data {5, 1});
+          pq.push(lpq_test_data {6, 1});
+          pq.push(lpq_test_data {4, 1});
+          AssertThat(pq.size(), Is().EqualTo(5u));
+
+          pq.setup_next_level(); // 2
+
+          AssertThat(pq.current_level(), Is().EqualTo(2u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {2, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 3
+
+          AssertThat(pq.current_level(), Is().EqualTo(3u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {3, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.push(lpq_test_data {4, 2});
+          AssertThat(pq.size(), Is().EqualTo(4u));
+
+          pq.setup_next_level(); // 4
+
+          AssertThat(pq.current_level(), Is().EqualTo(4u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {4, 1}));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {4, 2}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 5
+
+          AssertThat(pq.current_level(), Is().EqualTo(5u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {5, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 6
+
+          AssertThat(pq.current_level(), Is().EqualTo(6u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {6, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          AssertThat(pq.empty(), Is().True());
+        });
+
+        it("uses more buckets again for narrow levels", []() {
+          lpq_test_file f;
+
+          { // Garbage collect the writer early
+            lpq_test_writer fw(f);
+
+            fw.push(level_info(12,1u)); // .
+            fw.push(level_info(11,1u)); // .
+            fw.push(level_info(10,1u)); // bucket (after relabelling)
+            fw.push(level_info(9,1u));  // bucket (after relabelling)
+            fw.push(level_info(8,1u));  // bucket (after relabelling)
+            fw.push(level_info(7,1u));  // bucket (after relabelling)
+            fw.push(level_info(6,1u));  // overflow
+            fw.push(level_info(5,1u));  // .
+            fw.push(level_info(4,1u));  // .
+            fw.push(level_info(3,20u)); // bucket
+            fw.push(level_info(2,20u)); // bucket
+            fw.push(level_info(1,1u));  // skipped
+          }
+
+          test_priority_queue<lpq_test_file, 3> pq({f}, memory_available(), 32, stats_lpq_tests);
+
+          AssertThat(pq.buckets_used(), Is().EqualTo(2u));
+
+          pq.push(lpq_test_data {6, 1});
+          pq.push(lpq_test_data {8, 1});
+          AssertThat(pq.size(), Is().EqualTo(2u));
+
+          pq.setup_next_level(); // 6
+
+          AssertThat(pq.buckets_used(), Is().EqualTo(4u));
+
+          AssertThat(pq.current_level(), Is().EqualTo(6u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {6, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.push(lpq_test_data {9, 1});
+          pq.push(lpq_test_data {7, 1});
+          pq.push(lpq_test_data {12, 1});
+          AssertThat(pq.size(), Is().EqualTo(4u));
+
+          pq.setup_next_level(); // 7
+
+          AssertThat(pq.current_level(), Is().EqualTo(7u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {7, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 8
+
+          AssertThat(pq.current_level(), Is().EqualTo(8u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {8, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 9
+
+          AssertThat(pq.current_level(), Is().EqualTo(9u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {9, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 12
+
+          AssertThat(pq.current_level(), Is().EqualTo(12u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {12, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          AssertThat(pq.empty(), Is().True());
+        });
+
+        it("accounts for the width of kept levels when relabelling", []() {
+          lpq_test_file f;
+
+          { // Garbage collect the writer early
+            lpq_test_writer fw(f);
+
+            fw.push(level_info(9,1u));  // .
+            fw.push(level_info(8,1u));  // .
+            fw.push(level_info(7,1u));  // .
+            fw.push(level_info(6,1u));  // overflow
+            fw.push(level_info(5,1u));  // bucket (after relabelling)
+            fw.push(level_info(4,20u)); // bucket (kept)
+            fw.push(level_info(3,1u));  // bucket
+            fw.push(level_info(2,1u));  // bucket
+            fw.push(level_info(1,1u));  // skipped
+          }
+
+          test_priority_queue<lpq_test_file, 3> pq({f}, memory_available(), 32, stats_lpq_tests);
+
+          AssertThat(pq.buckets_used(), Is().EqualTo(3u));
+
+          pq.setup_next_level(3u);
+
+          AssertThat(pq.buckets_used(), Is().EqualTo(2u));
+          AssertThat(pq.current_level(), Is().EqualTo(3u));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.push(lpq_test_data {6, 1});
+          pq.push(lpq_test_data {5, 1});
+          pq.push(lpq_test_data {4, 1});
+          AssertThat(pq.size(), Is().EqualTo(3u));
+
+          pq.setup_next_level(); // 4
+
+          AssertThat(pq.current_level(), Is().EqualTo(4u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {4, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 5
+
+          AssertThat(pq.current_level(), Is().EqualTo(5u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {5, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 6
+
+          AssertThat(pq.current_level(), Is().EqualTo(6u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {6, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          AssertThat(pq.empty(), Is().True());
+        });
+
+        it("uses only as many buckets as fit into the given memory", []() {
+          shared_file<ptr_uint64::label_type> f;
+
+          { // Garbage collect the writer early
+            label_writer fw(f);
+            for (ptr_uint64::label_type l = 1u; l <= 20u; l++) { fw << l; }
+          }
+
+          using pq_t = test_priority_queue<shared_file<ptr_uint64::label_type>, 15>;
+
+          pq_t pq_unbounded({f}, memory_available(), 32, stats_lpq_tests);
+          AssertThat(pq_unbounded.buckets_used(), Is().EqualTo(16u));
+
+          size_t memory = pq_t::memory_usage(32u);
+          while (pq_t::memory_fits(memory) < 32u) { memory += 64u; }
+
+          pq_t pq({f}, memory, 32, stats_lpq_tests);
+          AssertThat(pq.buckets_used(), Is().GreaterThanOrEqualTo(2u));
+          AssertThat(pq.buckets_used(), Is().LessThan(16u));
+
+          pq.push(lpq_test_data {2, 1});
+          pq.push(lpq_test_data {20, 1});
+          pq.push(lpq_test_data {17, 1});
+          AssertThat(pq.size(), Is().EqualTo(3u));
+
+          pq.setup_next_level(); // 2
+
+          AssertThat(pq.current_level(), Is().EqualTo(2u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {2, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 17
+
+          AssertThat(pq.current_level(), Is().EqualTo(17u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {17, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          pq.setup_next_level(); // 20
+
+          AssertThat(pq.current_level(), Is().EqualTo(20u));
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data {20, 1}));
+          AssertThat(pq.can_pull(), Is().False());
+
+          AssertThat(pq.empty(), Is().True());
+        });
       });
 
       describe(".top() / .peek()", []{
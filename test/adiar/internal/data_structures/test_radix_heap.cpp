@@ -0,0 +1,196 @@
+#include "../../../test.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <adiar/internal/data_structures/radix_heap.h>
+
+struct radix_heap_test_data {
+  ptr_uint64::label_type label;
+  uint64_t nonce;
+
+  ptr_uint64::label_type level() const
+  { return label; }
+};
+
+struct radix_heap_test_lt {
+  bool operator()(const radix_heap_test_data &a, const radix_heap_test_data &b) const
+  {
+    return a.label < b.label || (a.label == b.label && a.nonce < b.nonce);
+  }
+};
+
+struct radix_heap_test_gt {
+  bool operator()(const radix_heap_test_data &a, const radix_heap_test_data &b) const
+  {
+    return a.label > b.label || (a.label == b.label && a.nonce > b.nonce);
+  }
+};
+
+go_bandit([]() {
+  describe("adiar/internal/data_structures/radix_heap.h", []() {
+    using test_radix_heap_lt = radix_heap<radix_heap_test_data, radix_heap_test_lt, std::less<>>;
+    using test_radix_heap_gt = radix_heap<radix_heap_test_data, radix_heap_test_gt, std::greater<>>;
+
+    it("agrees on 'memory_fits' and 'memory_usage'", []() {
+      const size_t memory = 1024u * 1024u;
+      const size_t fits = test_radix_heap_lt::memory_fits(memory);
+
+      AssertThat(fits, Is().GreaterThan(0u));
+      AssertThat(test_radix_heap_lt::memory_usage(fits), Is().LessThanOrEqualTo(memory));
+      AssertThat(test_radix_heap_lt::memory_usage(fits+1), Is().GreaterThan(memory));
+    });
+
+    it("is initially empty", []() {
+      test_radix_heap_lt pq(test_radix_heap_lt::memory_usage(8u), 8u);
+
+      AssertThat(pq.empty(), Is().True());
+      AssertThat(pq.size(), Is().EqualTo(0u));
+    });
+
+    it("obtains elements on a single level in order", []() {
+      test_radix_heap_lt pq(test_radix_heap_lt::memory_usage(8u), 8u);
+
+      pq.push({ 2, 3 });
+      pq.push({ 2, 1 });
+      pq.push({ 2, 2 });
+
+      AssertThat(pq.size(), Is().EqualTo(3u));
+      AssertThat(pq.top_level(), Is().EqualTo(2u));
+
+      AssertThat(pq.top().nonce, Is().EqualTo(1u));
+      pq.pop();
+      AssertThat(pq.top().nonce, Is().EqualTo(2u));
+      pq.pop();
+      AssertThat(pq.top().nonce, Is().EqualTo(3u));
+      pq.pop();
+
+      AssertThat(pq.empty(), Is().True());
+    });
+
+    it("obtains elements across levels in order", []() {
+      test_radix_heap_lt pq(test_radix_heap_lt::memory_usage(8u), 8u);
+
+      pq.push({ 7, 1 });
+      pq.push({ 1, 2 });
+      pq.push({ 4, 1 });
+      pq.push({ 1, 1 });
+      pq.push({ 12, 1 });
+
+      AssertThat(pq.top_level(), Is().EqualTo(1u));
+      AssertThat(pq.top().nonce, Is().EqualTo(1u));
+      pq.pop();
+      AssertThat(pq.top().nonce, Is().EqualTo(2u));
+      pq.pop();
+
+      AssertThat(pq.top_level(), Is().EqualTo(4u));
+      pq.pop();
+      AssertThat(pq.top_level(), Is().EqualTo(7u));
+      pq.pop();
+      AssertThat(pq.top_level(), Is().EqualTo(12u));
+      pq.pop();
+
+      AssertThat(pq.empty(), Is().True());
+    });
+
+    it("can push below 'top_level()' after only peeking", []() {
+      test_radix_heap_lt pq(test_radix_heap_lt::memory_usage(8u), 8u);
+
+      pq.push({ 10, 1 });
+      AssertThat(pq.top_level(), Is().EqualTo(10u));
+
+      pq.push({ 5, 1 });
+      AssertThat(pq.top_level(), Is().EqualTo(5u));
+
+      AssertThat(pq.top().label, Is().EqualTo(5u));
+      pq.pop();
+
+      pq.push({ 6, 1 });
+      AssertThat(pq.top().label, Is().EqualTo(6u));
+      pq.pop();
+      AssertThat(pq.top().label, Is().EqualTo(10u));
+      pq.pop();
+
+      AssertThat(pq.empty(), Is().True());
+    });
+
+    it("can push to the current level", []() {
+      test_radix_heap_lt pq(test_radix_heap_lt::memory_usage(8u), 8u);
+
+      pq.push({ 3, 2 });
+      pq.push({ 3, 4 });
+      AssertThat(pq.top().nonce, Is().EqualTo(2u));
+      pq.pop();
+
+      pq.push({ 3, 3 });
+      AssertThat(pq.top().nonce, Is().EqualTo(3u));
+      pq.pop();
+      AssertThat(pq.top().nonce, Is().EqualTo(4u));
+      pq.pop();
+
+      AssertThat(pq.empty(), Is().True());
+    });
+
+    it("obtains elements bottom-up with 'std::greater<>'", []() {
+      test_radix_heap_gt pq(test_radix_heap_gt::memory_usage(8u), 8u);
+
+      pq.push({ 2, 1 });
+      pq.push({ 9, 1 });
+      pq.push({ 9, 2 });
+      pq.push({ 0, 1 });
+
+      AssertThat(pq.top_level(), Is().EqualTo(9u));
+      AssertThat(pq.top().nonce, Is().EqualTo(2u));
+      pq.pop();
+      AssertThat(pq.top().nonce, Is().EqualTo(1u));
+      pq.pop();
+
+      AssertThat(pq.top_level(), Is().EqualTo(2u));
+      pq.pop();
+      AssertThat(pq.top_level(), Is().EqualTo(0u));
+      pq.pop();
+
+      AssertThat(pq.empty(), Is().True());
+    });
+
+    it("agrees with sorting for a monotone sequence of pushes and pops", []() {
+      const size_t max_size = 2000u;
+      test_radix_heap_lt pq(test_radix_heap_lt::memory_usage(max_size), max_size);
+
+      std::vector<radix_heap_test_data> expected;
+      std::vector<radix_heap_test_data> actual;
+
+      uint64_t seed = 42u;
+      ptr_uint64::label_type level = 0u;
+
+      for (size_t i = 0; i < max_size; ++i) {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+        const radix_heap_test_data d = { level + 1u + static_cast<ptr_uint64::label_type>((seed >> 33) % 300u), i };
+        pq.push(d);
+        expected.push_back(d);
+
+        // Now and then, obtain all elements of the next level.
+        if ((seed >> 20) % 4 == 0) {
+          level = pq.top_level();
+          while (!pq.empty() && pq.top_level() == level) {
+            actual.push_back(pq.top());
+            pq.pop();
+          }
+        }
+      }
+      while (!pq.empty()) {
+        actual.push_back(pq.top());
+        pq.pop();
+      }
+
+      std::sort(expected.begin(), expected.end(), radix_heap_test_lt());
+
+      AssertThat(actual.size(), Is().EqualTo(expected.size()));
+      for (size_t i = 0; i < expected.size(); ++i) {
+        AssertThat(actual[i].label, Is().EqualTo(expected[i].label));
+        AssertThat(actual[i].nonce, Is().EqualTo(expected[i].nonce));
+      }
+    });
+  });
+ });
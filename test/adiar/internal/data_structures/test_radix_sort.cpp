@@ -0,0 +1,103 @@
+#include "../../../test.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <adiar/internal/algorithms/reduce.h>
+#include <adiar/internal/data_structures/radix_sort.h>
+
+go_bandit([]() {
+  describe("adiar/internal/data_structures/radix_sort.h", []() {
+    const ptr_uint64 terminal_F = ptr_uint64(false);
+    const ptr_uint64 terminal_T = ptr_uint64(true);
+
+    // Deterministic pseudo-random children for nodes on level 0.
+    const auto make_nodes = [&](const size_t n) {
+      std::vector<node> nodes;
+      uint64_t seed = 42u;
+
+      for (size_t i = 0; i < n; ++i) {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+        const ptr_uint64 low  = (seed >> 33) % 4 == 0
+          ? ((seed >> 20) % 2 ? terminal_T : terminal_F)
+          : ptr_uint64(1 + (seed >> 40) % 3, (seed >> 45) % 64);
+        const ptr_uint64 high = (seed >> 34) % 4 == 0
+          ? ((seed >> 21) % 2 ? terminal_T : terminal_F)
+          : ptr_uint64(1 + (seed >> 50) % 3, (seed >> 55) % 64);
+
+        nodes.push_back(node(0, n-i, (seed >> 19) % 2 ? flag(low) : low, high));
+      }
+      return nodes;
+    };
+
+    it("does not specialize 'radix_sort_key' for arbitrary comparators", [&]() {
+      AssertThat((has_radix_sort_key<node, std::less<node>>), Is().False());
+      AssertThat((has_radix_sort_key<int, std::less<int>>), Is().False());
+    });
+
+    it("specializes 'radix_sort_key' for Reduce's comparators", [&]() {
+      AssertThat((has_radix_sort_key<node, reduce_node_children_lt>), Is().True());
+      AssertThat((has_radix_sort_key<mapping, reduce_uid_lt>), Is().True());
+      AssertThat((has_radix_sort_key<reduce_arc, reduce_queue_lt>), Is().True());
+    });
+
+    it("sorts few nodes like 'reduce_node_children_lt'", [&]() {
+      std::vector<node> nodes = make_nodes(8u);
+      radix_sort<radix_sort_key<node, reduce_node_children_lt>>(nodes.begin(), nodes.end());
+
+      AssertThat(std::is_sorted(nodes.begin(), nodes.end(), reduce_node_children_lt()),
+                 Is().True());
+    });
+
+    it("sorts many nodes like 'reduce_node_children_lt'", [&]() {
+      std::vector<node> nodes = make_nodes(2000u);
+      std::vector<node> expected = nodes;
+
+      radix_sort<radix_sort_key<node, reduce_node_children_lt>>(nodes.begin(), nodes.end());
+      std::sort(expected.begin(), expected.end(), reduce_node_children_lt());
+
+      AssertThat(std::is_sorted(nodes.begin(), nodes.end(), reduce_node_children_lt()),
+                 Is().True());
+
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        AssertThat(unflag(nodes[i].low()),  Is().EqualTo(unflag(expected[i].low())));
+        AssertThat(unflag(nodes[i].high()), Is().EqualTo(unflag(expected[i].high())));
+      }
+    });
+
+    it("sorts many arcs like 'reduce_queue_lt'", [&]() {
+      std::vector<reduce_arc> arcs;
+      uint64_t seed = 7u;
+
+      for (size_t i = 0; i < 1000u; ++i) {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+        arcs.push_back(arc(ptr_uint64(seed % 5, (seed >> 8) % 200, (seed >> 16) % 2),
+                           ptr_uint64(8, i)));
+      }
+
+      radix_sort<radix_sort_key<reduce_arc, reduce_queue_lt>>(arcs.begin(), arcs.end());
+
+      AssertThat(std::is_sorted(arcs.begin(), arcs.end(), reduce_queue_lt()),
+                 Is().True());
+    });
+
+    it("is used by 'internal_sorter'", [&]() {
+      const std::vector<node> nodes = make_nodes(500u);
+
+      const size_t memory_bytes = internal_sorter<node>::memory_usage(nodes.size());
+      internal_sorter<node, reduce_node_children_lt> sorter(memory_bytes, nodes.size());
+
+      for (const node &n : nodes) { sorter.push(n); }
+      sorter.sort();
+
+      node prev = sorter.pull();
+      while (sorter.can_pull()) {
+        const node next = sorter.pull();
+        AssertThat(reduce_node_children_lt()(next, prev), Is().False());
+        prev = next;
+      }
+    });
+  });
+ });
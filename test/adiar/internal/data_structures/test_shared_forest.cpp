@@ -0,0 +1,270 @@
+#include "../../../test.h"
+
+#include <vector>
+
+#include <adiar/bdd/bdd_policy.h>
+#include <adiar/zdd/zdd_policy.h>
+#include <adiar/internal/data_structures/shared_forest.h>
+
+go_bandit([]() {
+  describe("adiar/internal/data_structures/shared_forest.h", []() {
+    const ptr_uint64 terminal_F = ptr_uint64(false);
+    const ptr_uint64 terminal_T = ptr_uint64(true);
+
+    shared_levelized_file<bdd::node_type> nf_x0;
+    {
+      node_writer nw(nf_x0);
+      nw << node(0, node::max_id, terminal_F, terminal_T);
+    }
+    const bdd bdd_x0(nf_x0);
+
+    shared_levelized_file<bdd::node_type> nf_x2;
+    {
+      node_writer nw(nf_x2);
+      nw << node(2, node::max_id, terminal_F, terminal_T);
+    }
+    const bdd bdd_x2(nf_x2);
+
+    /*
+    //        1         ---- x0
+    //       / \
+    //       2  \       ---- x1
+    //      / \ /
+    //      F  3        ---- x2
+    //        / \
+    //        F T
+    */
+    shared_levelized_file<bdd::node_type> nf_1;
+    {
+      node_writer nw(nf_1);
+      nw << node(2, node::max_id,   terminal_F, terminal_T)
+         << node(1, node::max_id,   terminal_F, ptr_uint64(2, ptr_uint64::max_id))
+         << node(0, node::max_id,   ptr_uint64(1, ptr_uint64::max_id), ptr_uint64(2, ptr_uint64::max_id));
+    }
+    const bdd bdd_1(nf_1);
+
+    /*
+    //        1         ---- x0
+    //       / \
+    //       T  2       ---- x2
+    //         / \
+    //         F T
+    */
+    shared_levelized_file<bdd::node_type> nf_2;
+    {
+      node_writer nw(nf_2);
+      nw << node(2, node::max_id,   terminal_F, terminal_T)
+         << node(0, node::max_id,   terminal_T, ptr_uint64(2, ptr_uint64::max_id));
+    }
+    const bdd bdd_2(nf_2);
+
+    describe("shared_forest<bdd_policy>", [&]() {
+      it("is initially empty", [&]() {
+        shared_forest<bdd_policy> forest;
+        AssertThat(forest.size(), Is().EqualTo(0u));
+        AssertThat(forest.levels(), Is().EqualTo(0u));
+      });
+
+      it("inserts terminals without adding nodes", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        AssertThat(forest.insert(bdd_true()), Is().EqualTo(terminal_T));
+        AssertThat(forest.insert(bdd_not(bdd_true())), Is().EqualTo(terminal_F));
+        AssertThat(forest.size(), Is().EqualTo(0u));
+      });
+
+      it("inserts all nodes of a single BDD", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        const ptr_uint64 root = forest.insert(bdd_1);
+        AssertThat(root.is_node(), Is().True());
+        AssertThat(root.label(), Is().EqualTo(0u));
+
+        AssertThat(forest.size(), Is().EqualTo(3u));
+        AssertThat(forest.levels(), Is().EqualTo(3u));
+      });
+
+      it("inserts all nodes of a single BDD within a memory budget", [&]() {
+        shared_forest<bdd_policy> forest(exec_policy::memory_budget(exec_policy::memory_budget::minimum));
+
+        const ptr_uint64 root = forest.insert(bdd_1);
+        AssertThat(forest.size(), Is().EqualTo(3u));
+
+        AssertThat(forest.get(root), Is().EqualTo(bdd_1));
+      });
+
+      it("returns the same root for equivalent BDDs", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        const ptr_uint64 root_a = forest.insert(bdd_1);
+        const ptr_uint64 root_b = forest.insert(bdd_1);
+
+        AssertThat(root_a, Is().EqualTo(root_b));
+        AssertThat(forest.size(), Is().EqualTo(3u));
+      });
+
+      it("shares nodes between different BDDs", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        const ptr_uint64 root_1 = forest.insert(bdd_1);
+        const ptr_uint64 root_x2 = forest.insert(bdd_x2);
+        AssertThat(root_x2, Is().Not().EqualTo(root_1));
+        AssertThat(forest.size(), Is().EqualTo(3u));
+
+        const ptr_uint64 root_2 = forest.insert(bdd_2);
+        AssertThat(root_2, Is().Not().EqualTo(root_1));
+        AssertThat(forest.size(), Is().EqualTo(4u));
+      });
+
+      it("inserts the negation as new nodes", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        const ptr_uint64 root = forest.insert(bdd_x2);
+        const ptr_uint64 root_not = forest.insert(bdd_not(bdd_x2));
+
+        AssertThat(root_not, Is().Not().EqualTo(root));
+        AssertThat(forest.size(), Is().EqualTo(2u));
+      });
+
+      it("exports a terminal", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        AssertThat(bdd_istrue(forest.get(terminal_T)), Is().True());
+        AssertThat(bdd_isfalse(forest.get(terminal_F)), Is().True());
+      });
+
+      it("exports a canonical node file", [&]() {
+        shared_forest<bdd_policy> forest;
+        forest.insert(bdd_2);
+
+        const ptr_uint64 root = forest.insert(bdd_1);
+        const bdd out = forest.get(root);
+
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(1, node::max_id,
+                                                       terminal_F,
+                                                       ptr_uint64(2, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(0, node::max_id,
+                                                       ptr_uint64(1, ptr_uint64::max_id),
+                                                       ptr_uint64(2, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        AssertThat(out->canonical, Is().True());
+        AssertThat(out->width, Is().EqualTo(1u));
+        AssertThat(out->number_of_terminals[false], Is().EqualTo(2u));
+        AssertThat(out->number_of_terminals[true],  Is().EqualTo(1u));
+      });
+
+      it("exports the same BDD as was inserted [x0 & x2]", [&]() {
+        shared_forest<bdd_policy> forest;
+        forest.insert(bdd_1);
+
+        const bdd in = bdd_and(bdd_x0, bdd_x2);
+        const bdd out = forest.get(forest.insert(in));
+
+        AssertThat(out, Is().EqualTo(in));
+      });
+
+      it("reduces the result of an operation into the forest", [&]() {
+        bdd_forest forest;
+        const ptr_uint64 root_1 = forest.insert(bdd_1);
+
+        // (x0 ? x2 : x1 & x2) & x2 is unreduced, but equivalent to 'bdd_1'
+        const __bdd in = bdd_and(bdd_1, bdd_x2);
+        const ptr_uint64 root_in = forest.insert(in);
+
+        AssertThat(root_in, Is().EqualTo(root_1));
+        AssertThat(forest.size(), Is().EqualTo(3u));
+
+        const ptr_uint64 root_x0x2 = forest.insert(bdd_and(bdd_x0, bdd_x2));
+        AssertThat(forest.get(root_x0x2), Is().EqualTo(bdd(bdd_and(bdd_x0, bdd_x2))));
+        AssertThat(forest.size(), Is().EqualTo(4u));
+      });
+
+      it("removes unreachable nodes on garbage collection", [&]() {
+        shared_forest<bdd_policy> forest;
+        forest.insert(bdd_1);
+
+        const ptr_uint64 root_2 = forest.insert(bdd_2);
+        AssertThat(forest.size(), Is().EqualTo(4u));
+
+        const std::vector<ptr_uint64> roots = forest.gc({ root_2 });
+        AssertThat(roots.size(), Is().EqualTo(1u));
+        AssertThat(forest.size(), Is().EqualTo(2u));
+        AssertThat(forest.levels(), Is().EqualTo(2u));
+
+        AssertThat(forest.get(roots[0]), Is().EqualTo(bdd_2));
+      });
+
+      it("keeps shared nodes and terminal roots on garbage collection", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        forest.insert(bdd_x0);
+        const ptr_uint64 root_1  = forest.insert(bdd_1);
+        const ptr_uint64 root_2  = forest.insert(bdd_2);
+        AssertThat(forest.size(), Is().EqualTo(5u));
+
+        const std::vector<ptr_uint64> roots = forest.gc({ root_2, terminal_T, root_1 });
+        AssertThat(forest.size(), Is().EqualTo(4u));
+
+        AssertThat(roots.size(), Is().EqualTo(3u));
+        AssertThat(roots[1], Is().EqualTo(terminal_T));
+
+        AssertThat(forest.get(roots[0]), Is().EqualTo(bdd_2));
+        AssertThat(forest.get(roots[2]), Is().EqualTo(bdd_1));
+
+        // Previously removed nodes can be added anew
+        const ptr_uint64 root_x0_new = forest.insert(bdd_x0);
+        AssertThat(forest.size(), Is().EqualTo(5u));
+        AssertThat(forest.get(root_x0_new), Is().EqualTo(bdd_x0));
+      });
+
+      it("maintains sharing after garbage collection", [&]() {
+        shared_forest<bdd_policy> forest;
+
+        forest.insert(bdd_x0);
+        const ptr_uint64 root_1 = forest.insert(bdd_1);
+
+        const std::vector<ptr_uint64> roots = forest.gc({ root_1 });
+        AssertThat(forest.insert(bdd_1), Is().EqualTo(roots[0]));
+        AssertThat(forest.size(), Is().EqualTo(3u));
+      });
+    });
+
+    describe("shared_forest<zdd_policy>", [&]() {
+      it("inserts and exports ZDDs", [&]() {
+        shared_forest<zdd_policy> forest;
+
+        const zdd in_a = zdd_singleton(1);
+        const zdd in_b = zdd_union(zdd_singleton(0), zdd_singleton(1));
+
+        const ptr_uint64 root_a = forest.insert(in_a);
+        const ptr_uint64 root_b = forest.insert(in_b);
+        AssertThat(root_a, Is().Not().EqualTo(root_b));
+        AssertThat(forest.size(), Is().EqualTo(2u));
+
+        AssertThat(forest.get(root_a), Is().EqualTo(in_a));
+        AssertThat(forest.get(root_b), Is().EqualTo(in_b));
+        AssertThat(forest.insert(zdd_singleton(1)), Is().EqualTo(root_a));
+      });
+
+      it("reduces the result of an operation into the forest", [&]() {
+        zdd_forest forest;
+
+        const ptr_uint64 root_b = forest.insert(zdd_union(zdd_singleton(0), zdd_singleton(1)));
+        AssertThat(forest.get(root_b), Is().EqualTo(zdd(zdd_union(zdd_singleton(0), zdd_singleton(1)))));
+        AssertThat(forest.insert(zdd_union(zdd_singleton(1), zdd_singleton(0))), Is().EqualTo(root_b));
+      });
+    });
+  });
+ });
@@ -2,6 +2,9 @@
 
 #include <filesystem>
 
+#include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_structures/sorter.h>
+
 go_bandit([]() {
   describe("adiar/internal/io/file.h , file_stream.h , file_writer.h", []() {
     // The default folder for temporary files is '/tmp/' on Ubuntu and '/var/tmp/'
@@ -1136,5 +1139,155 @@ go_bandit([]() {
         std::filesystem::remove(path);
       });
     });
+
+    describe("file() + set_temp_dirs(dirs)", [&tmp_path]() {
+      const std::string dir_a = tmp_path + "adiar_test_temp_dir_a";
+      const std::string dir_b = tmp_path + "adiar_test_temp_dir_b";
+
+      std::filesystem::create_directories(dir_a);
+      std::filesystem::create_directories(dir_b);
+
+      it("places files in the default directory for a single directory", [&]() {
+        set_temp_dirs({ dir_a });
+
+        file<int> f;
+        AssertThat(std::filesystem::path(f.path()).parent_path(),
+                   Is().Not().EqualTo(std::filesystem::path(dir_a)));
+
+        set_temp_dirs({});
+      });
+
+      it("stripes files across all directories", [&]() {
+        set_temp_dirs({ dir_a, dir_b });
+
+        file<int> f1;
+        file<int> f2;
+        file<int> f3;
+
+        AssertThat(std::filesystem::path(f1.path()).parent_path(),
+                   Is().EqualTo(std::filesystem::path(dir_a)));
+        AssertThat(std::filesystem::path(f2.path()).parent_path(),
+                   Is().EqualTo(std::filesystem::path(dir_b)));
+        AssertThat(std::filesystem::path(f3.path()).parent_path(),
+                   Is().EqualTo(std::filesystem::path(dir_a)));
+
+        set_temp_dirs({});
+      });
+
+      it("can write to and read from striped files", [&]() {
+        set_temp_dirs({ dir_a, dir_b });
+
+        file<int> f1;
+        file<int> f2;
+        {
+          file_writer<int> fw1(f1);
+          fw1 << 1 << 2;
+
+          file_writer<int> fw2(f2);
+          fw2 << 3;
+        }
+
+        AssertThat(f1.size(), Is().EqualTo(2u));
+        AssertThat(f2.size(), Is().EqualTo(1u));
+
+        set_temp_dirs({});
+      });
+
+      it("removes striped files after destruct", [&]() {
+        set_temp_dirs({ dir_a, dir_b });
+
+        std::string path;
+        {
+          file<int> f;
+          f.touch();
+
+          path = f.path();
+          AssertThat(std::filesystem::exists(path), Is().True());
+        }
+        AssertThat(std::filesystem::exists(path), Is().False());
+
+        set_temp_dirs({});
+      });
+    });
+
+    describe("disk_check(bytes)", []() {
+      it("is unlimited by default", []() {
+        AssertThat(disk_limit(), Is().EqualTo(disk_unlimited));
+        AssertThat(disk_check(), Is().EqualTo(disk_usage()));
+      });
+
+      it("accepts bytes up to the limit", []() {
+        set_disk_limit(disk_usage() + 10u);
+        AssertThat(disk_check(10u), Is().EqualTo(disk_usage()));
+
+        set_disk_limit(disk_unlimited);
+      });
+
+      it("throws if bytes exceed the limit", []() {
+        set_disk_limit(disk_usage() + 10u);
+        AssertThrows(runtime_error, disk_check(11u));
+
+        set_disk_limit(disk_unlimited);
+      });
+
+      it("throws if the usage already exceeds the limit", []() {
+        file<int> f;
+        {
+          file_writer<int> fw(f);
+          for (int i = 0; i < 1024; ++i) { fw << i; }
+        }
+
+        if (0u < disk_usage()) {
+          set_disk_limit(disk_usage() - 1u);
+          AssertThrows(runtime_error, disk_check());
+        }
+
+        set_disk_limit(disk_unlimited);
+      });
+
+      it("updates the peak", []() {
+        disk_peak_reset();
+        {
+          file<int> f;
+          {
+            file_writer<int> fw(f);
+            for (int i = 0; i < 1024; ++i) { fw << i; }
+          }
+          disk_check();
+        }
+        AssertThat(disk_peak(), Is().GreaterThanOrEqualTo(disk_usage()));
+      });
+
+      it("is given the predicted size of an external sorter", []() {
+        set_disk_limit(disk_usage() + 10u);
+        AssertThrows(runtime_error,
+                     (sorter<memory_mode::External, int>(1024u, 1024u * 1024u, 1u)));
+
+        set_disk_limit(disk_unlimited);
+      });
+
+      it("is given the predicted size of an external priority queue", []() {
+        const size_t memory = 16u * 1024u * 1024u;
+        const size_t max_size = 1024u * 1024u * 1024u;
+
+        set_disk_limit(disk_usage() + 10u);
+        AssertThrows(runtime_error,
+                     (priority_queue<memory_mode::External, int, std::less<int>>(memory, max_size)));
+
+        set_disk_limit(disk_unlimited);
+      });
+    });
+
+    describe("disk_peak_update(peak, usage)", []() {
+      it("only raises the peak", []() {
+        size_t peak = 0u;
+
+        disk_peak_update(peak, 42u);
+        AssertThat(peak, Is().EqualTo(42u));
+
+        disk_peak_update(peak, 21u);
+        AssertThat(peak, Is().EqualTo(42u));
+      });
+    });
   });
  });
@@ -811,6 +811,72 @@ go_bandit([]() {
         // TODO: reversed
       });
 
+      describe(".seek_index(i)", []() {
+        it("can seek to each node when reading top-down", [&]() {
+          levelized_file<node> nf;
+          {
+            node_writer nw(nf);
+            nw << node(1,1, node::pointer_type(false), node::pointer_type(true))
+               << node(1,0, node::pointer_type(true),  node::pointer_type(false))
+               << node(0,0, node::pointer_type(1,0),   node::pointer_type(1,1))
+              ;
+          }
+
+          node_stream<> ns(nf);
+
+          ns.seek_index(1u);
+          AssertThat(ns.pull(), Is().EqualTo(node(1,0, node::pointer_type(true),  node::pointer_type(false))));
+          AssertThat(ns.pull(), Is().EqualTo(node(1,1, node::pointer_type(false), node::pointer_type(true))));
+          AssertThat(ns.can_pull(), Is().False());
+
+          ns.seek_index(2u);
+          AssertThat(ns.pull(), Is().EqualTo(node(0,0, node::pointer_type(1,0),   node::pointer_type(1,1))));
+
+          ns.seek_index(0u);
+          AssertThat(ns.pull(), Is().EqualTo(node(1,1, node::pointer_type(false), node::pointer_type(true))));
+          AssertThat(ns.can_pull(), Is().False());
+        });
+
+        it("can seek to each node when reading bottom-up", [&]() {
+          levelized_file<node> nf;
+          {
+            node_writer nw(nf);
+            nw << node(1,1, node::pointer_type(false), node::pointer_type(true))
+               << node(1,0, node::pointer_type(true),  node::pointer_type(false))
+               << node(0,0, node::pointer_type(1,0),   node::pointer_type(1,1))
+              ;
+          }
+
+          node_stream<true> ns(nf);
+
+          ns.seek_index(1u);
+          AssertThat(ns.pull(), Is().EqualTo(node(1,0, node::pointer_type(true),  node::pointer_type(false))));
+          AssertThat(ns.pull(), Is().EqualTo(node(0,0, node::pointer_type(1,0),   node::pointer_type(1,1))));
+          AssertThat(ns.can_pull(), Is().False());
+
+          ns.seek_index(0u);
+          AssertThat(ns.pull(), Is().EqualTo(node(1,1, node::pointer_type(false), node::pointer_type(true))));
+        });
+
+        it("discards a peeked node", [&]() {
+          levelized_file<node> nf;
+          {
+            node_writer nw(nf);
+            nw << node(1,1, node::pointer_type(false), node::pointer_type(true))
+               << node(1,0, node::pointer_type(true),  node::pointer_type(false))
+               << node(0,0, node::pointer_type(1,0),   node::pointer_type(1,1))
+              ;
+          }
+
+          node_stream<> ns(nf);
+
+          AssertThat(ns.peek(), Is().EqualTo(node(0,0, node::pointer_type(1,0), node::pointer_type(1,1))));
+
+          ns.seek_index(0u);
+          AssertThat(ns.pull(), Is().EqualTo(node(1,1, node::pointer_type(false), node::pointer_type(true))));
+        });
+      });
+
       describe("node_writer + node_random_access", []() {
         /*
         //              1      ---- A
@@ -1,5 +1,7 @@
 #include "../../test.h"
 
+#include <adiar/internal/util.h>
+
 go_bandit([]() {
   describe("adiar/internal/util.h", []() {
     describe("transpose", []() {
@@ -1219,5 +1219,161 @@ go_bandit([]() {
         AssertThrows(domain_error, b.build());
       });
     });
+
+    describe("builder(canonicalise = true)", [&]() {
+      it("merges duplicate nodes", [&]() {
+        bdd_builder b(true);
+
+        const bdd_ptr p3 = b.add_node(2,false,true);
+        const bdd_ptr p2 = b.add_node(2,false,true);
+        const bdd_ptr p1 = b.add_node(1,p3,p2);
+
+        bdd out = b.build();
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        AssertThat(out->canonical, Is().True());
+      });
+
+      it("outputs the nodes of a level in canonical order", [&]() {
+        /*
+                           1      ---- x1
+                          / \
+                         2   3    ---- x2
+                        / \ / \
+                        T F F T
+        */
+        bdd_builder b(true);
+
+        const bdd_ptr p2 = b.add_node(2,true,false);
+        const bdd_ptr p3 = b.add_node(2,false,true);
+        const bdd_ptr p1 = b.add_node(1,p2,p3);
+
+        bdd out = b.build();
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id-1,
+                                                       terminal_T,
+                                                       terminal_F)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(1, node::max_id,
+                                                       ptr_uint64(2, ptr_uint64::max_id-1),
+                                                       ptr_uint64(2, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        level_info_test_stream out_meta(out);
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(2,2u)));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(1,1u)));
+
+        AssertThat(out_meta.can_pull(), Is().False());
+
+        AssertThat(out->canonical, Is().True());
+
+        AssertThat(out->max_1level_cut[cut::Internal], Is().EqualTo(2u));
+        AssertThat(out->max_1level_cut[cut::All], Is().EqualTo(4u));
+
+        AssertThat(out->number_of_terminals[false], Is().EqualTo(2u));
+        AssertThat(out->number_of_terminals[true],  Is().EqualTo(2u));
+      });
+
+      it("does not count duplicates as additional roots", [&]() {
+        bdd_builder b(true);
+
+        const bdd_ptr p3 = b.add_node(2,false,true);
+        const bdd_ptr p2 = b.add_node(2,false,true);
+        const bdd_ptr p1 = b.add_node(1,p2,true);
+
+        bdd out = b.build();
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(1, node::max_id,
+                                                       ptr_uint64(2, ptr_uint64::max_id),
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().False());
+        AssertThat(out->canonical, Is().True());
+      });
+
+      it("throws an exception when there is more than one root", [&]() {
+        bdd_builder b(true);
+
+        const bdd_ptr p3 = b.add_node(2,false,true);
+        const bdd_ptr p2 = b.add_node(2,true,false);
+        const bdd_ptr p1 = b.add_node(1,p2,true);
+
+        AssertThrows(domain_error, b.build());
+      });
+
+      it("throws an exception if pointers are used after create", [&]() {
+        bdd_builder b(true);
+
+        builder_ptr p = b.add_node(1,true,false);
+        b.build();
+
+        AssertThrows(invalid_argument, b.add_node(0,p,false));
+      });
+
+      it("can create two different BDDs", [&]() {
+        bdd_builder b(true);
+
+        b.add_node(0,b.add_node(1,false,true),true);
+        bdd out_1 = b.build();
+
+        b.add_node(2,true,false);
+        bdd out_2 = b.build();
+
+        AssertThat(out_1, Is().EqualTo(bdd(bdd_or(bdd_ithvar(0), bdd_ithvar(1)))));
+        AssertThat(out_2, Is().EqualTo(bdd_nithvar(2)));
+        AssertThat(out_2->canonical, Is().True());
+      });
+
+      it("merges duplicate ZDD nodes and applies the ZDD reduction rule", [&]() {
+        zdd_builder b(true);
+
+        const zdd_ptr p4 = b.add_node(2,false,true);
+        const zdd_ptr p3 = b.add_node(2,false,true);
+        const zdd_ptr p2 = b.add_node(1,p3,false);
+        const zdd_ptr p1 = b.add_node(0,p4,p2);
+
+        zdd out = b.build();
+        node_test_stream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(2, node::max_id,
+                                                       terminal_F,
+                                                       terminal_T)));
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(0, node::max_id,
+                                                       ptr_uint64(2, ptr_uint64::max_id),
+                                                       ptr_uint64(2, ptr_uint64::max_id))));
+
+        AssertThat(out_nodes.can_pull(), Is().False());
+        AssertThat(out->canonical, Is().True());
+      });
+    });
   });
 });
@@ -35,6 +35,34 @@ go_bandit([]() {
           AssertThat(ep.memory_mode(),  Is().EqualTo(exec_policy::memory::Auto));
           AssertThat(ep.quantify_alg(), Is().EqualTo(exec_policy::quantify::Nested));
         });
+
+        it("can be conversion constructed from 'engine'", []() {
+          exec_policy ep = exec_policy::engine::Levelized;
+
+          AssertThat(ep.access_mode(),  Is().EqualTo(exec_policy::access::Auto));
+          AssertThat(ep.memory_mode(),  Is().EqualTo(exec_policy::memory::Auto));
+          AssertThat(ep.quantify_alg(), Is().EqualTo(exec_policy::quantify::Auto));
+          AssertThat(ep.engine_mode(),  Is().EqualTo(exec_policy::engine::Levelized));
+        });
+
+        it("is default constructed with an unlimited 'memory budget'", []() {
+          exec_policy ep;
+
+          AssertThat(ep.memory_limit().bytes(), Is().EqualTo(exec_policy::memory_budget::unlimited));
+        });
+
+        it("can be conversion constructed from 'memory budget'", []() {
+          exec_policy ep = exec_policy::memory_budget(256u * 1024u * 1024u);
+
+          AssertThat(ep.access_mode(),          Is().EqualTo(exec_policy::access::Auto));
+          AssertThat(ep.memory_mode(),          Is().EqualTo(exec_policy::memory::Auto));
+          AssertThat(ep.memory_limit().bytes(), Is().EqualTo(256u * 1024u * 1024u));
+        });
+
+        it("cannot construct a 'memory budget' below the minimum", []() {
+          AssertThrows(invalid_argument, exec_policy::memory_budget(1024u));
+          AssertThrows(invalid_argument, exec_policy::memory_budget(exec_policy::memory_budget::minimum - 1u));
+        });
       });
 
       describe("set(const __ &)", []() {
@@ -83,6 +111,30 @@ go_bandit([]() {
           AssertThat(ep.quantify_alg(), Is().EqualTo(exec_policy::quantify::Auto));
         });
 
+        it("can set 'engine'", []() {
+          exec_policy ep;
+          AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Auto));
+
+          ep.set(exec_policy::engine::Depth_First);
+          AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Depth_First));
+
+          ep.set(exec_policy::engine::Levelized);
+          AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Levelized));
+
+          ep.set(exec_policy::engine::Auto);
+          AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Auto));
+        });
+
+        it("can set 'memory budget'", []() {
+          exec_policy ep;
+
+          ep.set(exec_policy::memory_budget(512u * 1024u * 1024u));
+          AssertThat(ep.memory_limit().bytes(), Is().EqualTo(512u * 1024u * 1024u));
+
+          ep.set(exec_policy::memory_budget());
+          AssertThat(ep.memory_limit().bytes(), Is().EqualTo(exec_policy::memory_budget::unlimited));
+        });
+
         it("can set settigs akin to Adiar v1.0", []() {
           exec_policy ep;
 
@@ -150,6 +202,20 @@ go_bandit([]() {
 
           AssertThat(ep1, Is().Not().EqualTo(ep2));
         });
+
+        it("mismatches on 'engine'", []() {
+          exec_policy ep1 = exec_policy::engine::Depth_First;
+          exec_policy ep2 = exec_policy::engine::Levelized;
+
+          AssertThat(ep1, Is().Not().EqualTo(ep2));
+        });
+
+        it("mismatches on 'memory budget'", []() {
+          exec_policy ep1 = exec_policy::memory_budget(256u * 1024u * 1024u);
+          exec_policy ep2 = exec_policy::memory_budget(512u * 1024u * 1024u);
+
+          AssertThat(ep1, Is().Not().EqualTo(ep2));
+        });
       });
 
       describe("operator &(const exec_policy&)", []() {
@@ -239,6 +305,382 @@ go_bandit([]() {
           AssertThat(ep.memory_mode(),  Is().EqualTo(exec_policy::memory::External));
           AssertThat(ep.quantify_alg(), Is().EqualTo(exec_policy::quantify::Nested));
         });
+
+        it("can create a copy with another 'engine'", []() {
+          exec_policy in = exec_policy::memory::Internal;
+          exec_policy out = in & exec_policy::engine::Levelized;
+
+          AssertThat(in.memory_mode(),  Is().EqualTo(exec_policy::memory::Internal));
+          AssertThat(in.engine_mode(),  Is().EqualTo(exec_policy::engine::Auto));
+
+          AssertThat(out.memory_mode(), Is().EqualTo(exec_policy::memory::Internal));
+          AssertThat(out.engine_mode(), Is().EqualTo(exec_policy::engine::Levelized));
+        });
+
+        it("can lift enum values [engine & access]", []() {
+          exec_policy ep = exec_policy::engine::Levelized & exec_policy::access::Random_Access;
+
+          AssertThat(ep.access_mode(), Is().EqualTo(exec_policy::access::Random_Access));
+          AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Levelized));
+        });
+
+        it("can lift enum values [quantify & engine]", []() {
+          exec_policy ep = exec_policy::quantify::Nested & exec_policy::engine::Depth_First;
+
+          AssertThat(ep.quantify_alg(), Is().EqualTo(exec_policy::quantify::Nested));
+          AssertThat(ep.engine_mode(),  Is().EqualTo(exec_policy::engine::Depth_First));
+        });
+
+        it("can create a copy with another 'memory budget'", []() {
+          exec_policy in = exec_policy::memory::Internal;
+          exec_policy out = in & exec_policy::memory_budget(768u * 1024u * 1024u);
+
+          AssertThat(in.memory_limit().bytes(),  Is().EqualTo(exec_policy::memory_budget::unlimited));
+
+          AssertThat(out.memory_mode(),          Is().EqualTo(exec_policy::memory::Internal));
+          AssertThat(out.memory_limit().bytes(), Is().EqualTo(768u * 1024u * 1024u));
+        });
+
+        it("can lift enum values [memory & memory budget]", []() {
+          exec_policy ep = exec_policy::memory::External & exec_policy::memory_budget(768u * 1024u * 1024u);
+
+          AssertThat(ep.memory_mode(),          Is().EqualTo(exec_policy::memory::External));
+          AssertThat(ep.memory_limit().bytes(), Is().EqualTo(768u * 1024u * 1024u));
+        });
+
+        it("can lift enum values [memory budget & engine]", []() {
+          exec_policy ep = exec_policy::memory_budget(768u * 1024u * 1024u) & exec_policy::engine::Levelized;
+
+          AssertThat(ep.engine_mode(),          Is().EqualTo(exec_policy::engine::Levelized));
+          AssertThat(ep.memory_limit().bytes(), Is().EqualTo(768u * 1024u * 1024u));
+        });
+
+        it("only lifts options", []() {
+          AssertThat(exec_policy::is_option<exec_policy::memory>,        Is().True());
+          AssertThat(exec_policy::is_option<exec_policy::memory_budget>, Is().True());
+          AssertThat(exec_policy::is_option<exec_policy::cancellation>,  Is().True());
+
+          AssertThat(exec_policy::is_option<exec_policy>, Is().False());
+          AssertThat(exec_policy::is_option<size_t>,      Is().False());
+        });
+      });
+    });
+
+    describe("memory_available(const exec_policy &)", []() {
+      it("is the available memory for an unlimited budget", []() {
+        AssertThat(memory_available(exec_policy()), Is().EqualTo(memory_available()));
+      });
+
+      it("is capped by the budget", []() {
+        const exec_policy ep = exec_policy::memory_budget(256u * 1024u * 1024u);
+        AssertThat(memory_available(ep), Is().EqualTo(256u * 1024u * 1024u));
+      });
+
+      it("is capped by the available memory", []() {
+        const exec_policy ep = exec_policy::memory_budget(memory_available() + 1024u);
+        AssertThat(memory_available(ep), Is().EqualTo(memory_available()));
+      });
+
+      it("can be used to run operations with the minimum budget", []() {
+        const exec_policy ep = exec_policy::memory_budget(exec_policy::memory_budget::minimum)
+                             & exec_policy::engine::Levelized;
+
+        const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+
+        const bdd g = bdd_xor(ep, f, bdd_ithvar(2));
+        AssertThat(g, Is().EqualTo(bdd(bdd_xor(f, bdd_ithvar(2)))));
+
+        const bdd h = bdd_ite(ep, bdd_ithvar(3), g, f);
+        AssertThat(h, Is().EqualTo(bdd(bdd_ite(bdd_ithvar(3), g, f))));
+
+        const bdd h_exists = bdd_exists(ep, h, 2);
+        AssertThat(h_exists, Is().EqualTo(bdd(bdd_exists(h, 2))));
+
+        AssertThat(bdd_satcount(ep, h, 4), Is().EqualTo(bdd_satcount(h, 4)));
+        AssertThat(bdd_equal(ep, h, g), Is().False());
+      });
+
+      it("can be used to run operations in external memory with the minimum budget", []() {
+        const exec_policy ep = exec_policy::memory_budget(exec_policy::memory_budget::minimum)
+                             & exec_policy::memory::External
+                             & exec_policy::engine::Levelized;
+
+        const bdd f = bdd_or(bdd_ithvar(0), bdd_ithvar(1));
+
+        const bdd g = bdd_and(ep, f, bdd_nithvar(2));
+        AssertThat(g, Is().EqualTo(bdd(bdd_and(f, bdd_nithvar(2)))));
+
+        const bdd g_forall = bdd_forall(ep, g, 0);
+        AssertThat(g_forall, Is().EqualTo(bdd(bdd_forall(g, 0))));
+
+        AssertThat(bdd_satcount(ep, g, 3), Is().EqualTo(bdd_satcount(g, 3)));
+      });
+    });
+
+    describe("exec_policy::progress", []() {
+      it("has no callback by default", []() {
+        const exec_policy ep;
+        AssertThat(static_cast<bool>(ep.progress_callback()), Is().False());
+      });
+
+      it("can be set", []() {
+        const exec_policy ep = exec_policy::progress([](size_t, size_t, size_t) { });
+        AssertThat(static_cast<bool>(ep.progress_callback()), Is().True());
+      });
+
+      it("is not part of the equality of settings", []() {
+        const exec_policy ep = exec_policy::progress([](size_t, size_t, size_t) { });
+        AssertThat(ep, Is().EqualTo(exec_policy()));
+      });
+
+      it("can lift enum values [progress & engine]", []() {
+        exec_policy ep = exec_policy::progress([](size_t, size_t, size_t) { })
+                       & exec_policy::engine::Levelized;
+
+        AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Levelized));
+        AssertThat(static_cast<bool>(ep.progress_callback()), Is().True());
+      });
+
+      it("is called for each level of an operation", []() {
+        std::vector<size_t> levels;
+
+        const exec_policy ep = exec_policy::engine::Levelized
+          & exec_policy::progress([&levels](size_t level, size_t, size_t) {
+              levels.push_back(level);
+            });
+
+        const bdd f = bdd_and(ep, bdd_ithvar(0), bdd_ithvar(1));
+        AssertThat(f, Is().EqualTo(bdd(bdd_and(bdd_ithvar(0), bdd_ithvar(1)))));
+
+        // Top-down sweep on level 0 and 1 followed by Reduce on level 1 and 0.
+        AssertThat(levels.size(), Is().GreaterThanOrEqualTo(2u));
+        AssertThat(levels.at(0), Is().EqualTo(0u));
+        AssertThat(levels.at(1), Is().EqualTo(1u));
+      });
+    });
+
+    describe("exec_policy::cancellation", []() {
+      it("is not cancelled by default", []() {
+        const exec_policy ep;
+        AssertThat(ep.cancellation_token().is_cancelled(), Is().False());
+      });
+
+      it("is cancelled after 'cancel()'", []() {
+        const exec_policy::cancellation c;
+        AssertThat(c.is_cancelled(), Is().False());
+
+        c.cancel();
+        AssertThat(c.is_cancelled(), Is().True());
+      });
+
+      it("shares its state with all copies", []() {
+        const exec_policy::cancellation c;
+        const exec_policy ep = c;
+
+        AssertThat(ep.cancellation_token().is_cancelled(), Is().False());
+        c.cancel();
+        AssertThat(ep.cancellation_token().is_cancelled(), Is().True());
+      });
+
+      it("cannot cancel 'none()'", []() {
+        const exec_policy::cancellation c = exec_policy::cancellation::none();
+        c.cancel();
+        AssertThat(c.is_cancelled(), Is().False());
+      });
+
+      it("is cancellable unless 'none()'", []() {
+        AssertThat(exec_policy::cancellation().is_cancellable(), Is().True());
+        AssertThat(exec_policy::cancellation::none().is_cancellable(), Is().False());
+        AssertThat(exec_policy().cancellation_token().is_cancellable(), Is().False());
+      });
+
+      it("aborts an operation", []() {
+        const exec_policy::cancellation c;
+        c.cancel();
+
+        const exec_policy ep = exec_policy::engine::Levelized & c;
+        AssertThrows(operation_cancelled, bdd_and(ep, bdd_ithvar(0), bdd_ithvar(1)));
+      });
+
+      it("aborts an operation half-way", []() {
+        const exec_policy::cancellation c;
+        const exec_policy ep = exec_policy::engine::Levelized
+          & c
+          & exec_policy::progress([&c](size_t level, size_t, size_t) {
+              if (level == 1u) { c.cancel(); }
+            });
+
+        // Cancelled on level 1 of the top-down sweep; aborted within Reduce.
+        AssertThrows(operation_cancelled, bdd(bdd_and(ep, bdd_ithvar(0), bdd_ithvar(1))));
+      });
+
+      it("does not affect operations with another token", []() {
+        const exec_policy::cancellation c;
+        c.cancel();
+
+        const exec_policy ep = exec_policy::engine::Levelized & exec_policy::cancellation();
+        const bdd f = bdd_and(ep, bdd_ithvar(0), bdd_ithvar(1));
+        AssertThat(bdd_satcount(f, 2), Is().EqualTo(1u));
+      });
+    });
+
+    describe("exec_policy::deadline", []() {
+      it("has no deadline by default", []() {
+        const exec_policy ep;
+        AssertThat(ep.time_limit().is_set(), Is().False());
+        AssertThat(ep.time_limit().has_passed(), Is().False());
+      });
+
+      it("can be set to a duration from now", []() {
+        const exec_policy ep = exec_policy::deadline(std::chrono::hours(1));
+        AssertThat(ep.time_limit().is_set(), Is().True());
+        AssertThat(ep.time_limit().has_passed(), Is().False());
+      });
+
+      it("has passed for a point in the past", []() {
+        const exec_policy::deadline d(exec_policy::deadline::clock_type::now()
+                                      - std::chrono::seconds(1));
+        AssertThat(d.has_passed(), Is().True());
+      });
+
+      it("is part of the equality of settings", []() {
+        const exec_policy ep = exec_policy::deadline(std::chrono::hours(1));
+        AssertThat(ep, Is().Not().EqualTo(exec_policy()));
+      });
+
+      it("can lift enum values [deadline & memory]", []() {
+        const exec_policy ep = exec_policy::deadline(std::chrono::hours(1))
+                             & exec_policy::memory::Internal;
+
+        AssertThat(ep.memory_mode(), Is().EqualTo(exec_policy::memory::Internal));
+        AssertThat(ep.time_limit().is_set(), Is().True());
+      });
+
+      it("aborts an operation that passed its deadline", []() {
+        const exec_policy ep = exec_policy::engine::Levelized
+          & exec_policy::deadline(std::chrono::seconds(0));
+
+        AssertThrows(deadline_exceeded, bdd_and(ep, bdd_ithvar(0), bdd_ithvar(1)));
+      });
+
+      it("does not abort an operation within its deadline", []() {
+        const exec_policy ep = exec_policy::engine::Levelized
+          & exec_policy::deadline(std::chrono::hours(1));
+
+        const bdd f = bdd_and(ep, bdd_ithvar(0), bdd_ithvar(1));
+        AssertThat(bdd_satcount(f, 2), Is().EqualTo(1u));
+      });
+    });
+
+    describe("exec_policy::arc_budget", []() {
+      it("is unlimited by default", []() {
+        const exec_policy ep;
+        AssertThat(ep.arc_limit().arcs(), Is().EqualTo(exec_policy::arc_budget::unlimited));
+      });
+
+      it("is part of the equality of settings", []() {
+        const exec_policy ep = exec_policy::arc_budget(42u);
+        AssertThat(ep, Is().Not().EqualTo(exec_policy()));
+        AssertThat(ep, Is().EqualTo(exec_policy(exec_policy::arc_budget(42u))));
+      });
+
+      it("can lift enum values [engine & arc budget]", []() {
+        const exec_policy ep = exec_policy::engine::Levelized & exec_policy::arc_budget(42u);
+
+        AssertThat(ep.engine_mode(), Is().EqualTo(exec_policy::engine::Levelized));
+        AssertThat(ep.arc_limit().arcs(), Is().EqualTo(42u));
+      });
+
+      it("aborts an operation that outputs too many arcs", []() {
+        // x0 & x1 & x2 requires 6 arcs; only 2 of them are output on level 0.
+        const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+        const exec_policy ep = exec_policy::engine::Levelized & exec_policy::arc_budget(1u);
+
+        AssertThrows(arc_budget_exceeded, bdd_and(ep, f, bdd_ithvar(2)));
+      });
+
+      it("does not abort an operation within its budget", []() {
+        const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+        const exec_policy ep = exec_policy::engine::Levelized & exec_policy::arc_budget(6u);
+
+        const bdd g = bdd_and(ep, f, bdd_ithvar(2));
+        AssertThat(bdd_satcount(g, 3), Is().EqualTo(1u));
+      });
+    });
+
+    describe("exec_policy::threads", []() {
+      it("is single-threaded by default", []() {
+        const exec_policy ep;
+        AssertThat(ep.thread_count().count(), Is().EqualTo(1u));
+      });
+
+      it("uses at least one thread", []() {
+        const exec_policy ep = exec_policy::threads(0u);
+        AssertThat(ep.thread_count().count(), Is().EqualTo(1u));
+      });
+
+      it("is part of the equality of settings", []() {
+        const exec_policy ep = exec_policy::threads(4u);
+        AssertThat(ep, Is().Not().EqualTo(exec_policy()));
+        AssertThat(ep, Is().EqualTo(exec_policy(exec_policy::threads(4u))));
+      });
+
+      it("can lift enum values [memory & threads]", []() {
+        const exec_policy ep = exec_policy::memory::Internal & exec_policy::threads(4u);
+
+        AssertThat(ep.memory_mode(), Is().EqualTo(exec_policy::memory::Internal));
+        AssertThat(ep.thread_count().count(), Is().EqualTo(4u));
+      });
+
+      it("can lift enum values [threads & arc budget]", []() {
+        const exec_policy ep = exec_policy::threads(2u) & exec_policy::arc_budget(42u);
+
+        AssertThat(ep.thread_count().count(), Is().EqualTo(2u));
+        AssertThat(ep.arc_limit().arcs(), Is().EqualTo(42u));
+      });
+    });
+
+    describe("exec_policy::schedule", []() {
+      it("is by default 'Balanced'", []() {
+        const exec_policy ep;
+        AssertThat(ep.schedule_mode(), Is().EqualTo(exec_policy::schedule::Balanced));
+      });
+
+      it("can be conversion constructed from 'schedule'", []() {
+        const exec_policy ep = exec_policy::schedule::Min_Width;
+
+        AssertThat(ep.engine_mode(),   Is().EqualTo(exec_policy::engine::Auto));
+        AssertThat(ep.schedule_mode(), Is().EqualTo(exec_policy::schedule::Min_Width));
+      });
+
+      it("can set 'schedule'", []() {
+        exec_policy ep;
+
+        ep.set(exec_policy::schedule::Min_Width);
+        AssertThat(ep.schedule_mode(), Is().EqualTo(exec_policy::schedule::Min_Width));
+
+        ep.set(exec_policy::schedule::Balanced);
+        AssertThat(ep.schedule_mode(), Is().EqualTo(exec_policy::schedule::Balanced));
+      });
+
+      it("is part of the equality of settings", []() {
+        const exec_policy ep = exec_policy::schedule::Min_Width;
+        AssertThat(ep, Is().Not().EqualTo(exec_policy()));
+        AssertThat(ep, Is().EqualTo(exec_policy(exec_policy::schedule::Min_Width)));
+      });
+
+      it("can lift enum values [schedule & quantify]", []() {
+        const exec_policy ep = exec_policy::schedule::Min_Width & exec_policy::quantify::Nested;
+
+        AssertThat(ep.schedule_mode(), Is().EqualTo(exec_policy::schedule::Min_Width));
+        AssertThat(ep.quantify_alg(),  Is().EqualTo(exec_policy::quantify::Nested));
+      });
+
+      it("can lift enum values [threads & schedule]", []() {
+        const exec_policy ep = exec_policy::threads(2u) & exec_policy::schedule::Min_Width;
+
+        AssertThat(ep.thread_count().count(), Is().EqualTo(2u));
+        AssertThat(ep.schedule_mode(), Is().EqualTo(exec_policy::schedule::Min_Width));
       });
     });
   });
@@ -0,0 +1,119 @@
+#include "../../test.h"
+
+#include <vector>
+
+go_bandit([]() {
+  describe("adiar/zdd/algebra.cpp", []() {
+    // Family with a single set (with its elements in descending order)
+    const auto set = [](std::vector<zdd::label_type> vars) {
+      return zdd(zdd_vars(vars.begin(), vars.end()));
+    };
+
+    // { {0,1}, {2} }
+    const zdd A = zdd_union(set({1,0}), set({2}));
+
+    // { {1}, {3} }
+    const zdd B = zdd_union(set({1}), set({3}));
+
+    describe("zdd_join", [&]() {
+      it("returns Ø when joining with Ø", [&]() {
+        AssertThat(zdd_join(A, zdd_empty()) == zdd_empty(), Is().True());
+        AssertThat(zdd_join(zdd_empty(), B) == zdd_empty(), Is().True());
+      });
+
+      it("returns the other family when joining with { Ø }", [&]() {
+        AssertThat(zdd_join(A, zdd_null()) == A, Is().True());
+        AssertThat(zdd_join(zdd_null(), B) == B, Is().True());
+      });
+
+      it("computes { {0,1}, {2} } ⊔ { {1}, {3} }", [&]() {
+        const zdd expected = zdd_union(zdd_union(set({1,0}), set({3,1,0})),
+                                       zdd_union(set({2,1}), set({3,2})));
+
+        AssertThat(zdd_join(A, B) == expected, Is().True());
+        AssertThat(zdd_join(B, A) == expected, Is().True());
+      });
+
+      it("computes { {0}, {1} } ⊔ { {0}, {1} }", [&]() {
+        const zdd in = zdd_union(set({0}), set({1}));
+        const zdd expected = zdd_union(in, set({1,0}));
+
+        AssertThat(zdd_join(in, in) == expected, Is().True());
+      });
+    });
+
+    describe("zdd_meet", [&]() {
+      it("returns Ø when meeting with Ø", [&]() {
+        AssertThat(zdd_meet(A, zdd_empty()) == zdd_empty(), Is().True());
+        AssertThat(zdd_meet(zdd_empty(), B) == zdd_empty(), Is().True());
+      });
+
+      it("returns { Ø } when meeting with { Ø }", [&]() {
+        AssertThat(zdd_meet(A, zdd_null()) == zdd_null(), Is().True());
+        AssertThat(zdd_meet(zdd_null(), B) == zdd_null(), Is().True());
+      });
+
+      it("computes { {0,1}, {2} } ⊓ { {1}, {3} }", [&]() {
+        const zdd expected = zdd_union(zdd_null(), set({1}));
+
+        AssertThat(zdd_meet(A, B) == expected, Is().True());
+        AssertThat(zdd_meet(B, A) == expected, Is().True());
+      });
+
+      it("computes { {0,1,2} } ⊓ { {0,2}, {1,2,3} }", [&]() {
+        const zdd in_1 = set({2,1,0});
+        const zdd in_2 = zdd_union(set({2,0}), set({3,2,1}));
+        const zdd expected = zdd_union(set({2,0}), set({2,1}));
+
+        AssertThat(zdd_meet(in_1, in_2) == expected, Is().True());
+      });
+    });
+
+    describe("zdd_div / zdd_rem", [&]() {
+      // { {0,1}, {0,3}, {1,2}, {2,3}, {4} }
+      const zdd C = zdd_union(zdd_union(zdd_union(set({1,0}), set({3,0})),
+                                        zdd_union(set({2,1}), set({3,2}))),
+                              set({4}));
+
+      it("returns Ø when dividing by Ø", [&]() {
+        AssertThat(zdd_div(C, zdd_empty()) == zdd_empty(), Is().True());
+      });
+
+      it("returns the family itself when dividing by { Ø }", [&]() {
+        AssertThat(zdd_div(C, zdd_null()) == C, Is().True());
+        AssertThat(zdd_rem(C, zdd_null()) == zdd_empty(), Is().True());
+      });
+
+      it("computes { {0,1}, {0,3}, {1,2}, {2,3}, {4} } / { {1}, {3} }", [&]() {
+        const zdd expected = zdd_union(set({0}), set({2}));
+        AssertThat(zdd_div(C, B) == expected, Is().True());
+      });
+
+      it("computes { {0,1}, {0,3}, {1,2}, {2,3}, {4} } % { {1}, {3} }", [&]() {
+        AssertThat(zdd_rem(C, B) == set({4}), Is().True());
+      });
+
+      it("computes the join of the quotient and the divisor", [&]() {
+        const zdd Q = zdd_div(C, B);
+        AssertThat(zdd_union(zdd_join(B, Q), zdd_rem(C, B)) == C, Is().True());
+      });
+
+      it("excludes quotients that are not disjoint from the divisor", [&]() {
+        // { {0,1}, {0,2}, {0,1,2} } / { {1}, {2} }
+        const zdd in = zdd_union(zdd_union(set({1,0}), set({2,0})), set({2,1,0}));
+        const zdd div = zdd_union(set({1}), set({2}));
+
+        AssertThat(zdd_div(in, div) == set({0}), Is().True());
+        AssertThat(zdd_rem(in, div) == set({2,1,0}), Is().True());
+      });
+
+      it("returns Ø if no quotient exists", [&]() {
+        // { {1}, {1,3} } / { {1}, {3} }
+        const zdd in = zdd_union(set({1}), set({3,1}));
+
+        AssertThat(zdd_div(in, B) == zdd_empty(), Is().True());
+        AssertThat(zdd_rem(in, B) == in, Is().True());
+      });
+    });
+  });
+ });
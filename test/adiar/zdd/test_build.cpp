@@ -1,5 +1,7 @@
 #include "../../test.h"
 
+#include <vector>
+
 go_bandit([]() {
   describe("adiar/zdd/build.cpp", []() {
     ptr_uint64 terminal_T = ptr_uint64(true);
@@ -1757,5 +1759,202 @@ go_bandit([]() {
         AssertThat(res->number_of_terminals[true],  Is().EqualTo(2u));
       });
     });
+
+    describe("zdd_from_sets(n, sets)", [&]() {
+      using pairs_t = std::vector<pair<size_t, zdd::label_type>>;
+
+      // Family with a single set (with its elements in descending order)
+      const auto set = [](std::vector<zdd::label_type> vars) {
+        return zdd(zdd_vars(vars.begin(), vars.end()));
+      };
+
+      it("creates Ø for no sets", [&]() {
+        const pairs_t in = {};
+        const zdd res = zdd_from_sets(0, make_generator(in.begin(), in.end()));
+        AssertThat(zdd_isempty(res), Is().True());
+      });
+
+      it("creates { Ø } for sets without elements", [&]() {
+        const pairs_t in = {};
+        const zdd res = zdd_from_sets(2, make_generator(in.begin(), in.end()));
+        AssertThat(zdd_isnull(res), Is().True());
+      });
+
+      it("creates { {1} }", [&]() {
+        const pairs_t in = { {0,1} };
+        const zdd res = zdd_from_sets(1, make_generator(in.begin(), in.end()));
+
+        node_test_stream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(1, node::max_id, terminal_F, terminal_T)));
+        AssertThat(ns.can_pull(), Is().False());
+
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("creates { {0,1}, {0,2}, {2} } from sorted pairs", [&]() {
+        const pairs_t in = { {0,0}, {0,1}, {1,0}, {1,2}, {2,2} };
+        const zdd res = zdd_from_sets(3, make_generator(in.begin(), in.end()));
+
+        const zdd expected = zdd_union(zdd_union(set({1,0}), set({2,0})), set({2}));
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("creates { {0,1}, {0,2}, {2} } from unsorted pairs", [&]() {
+        const pairs_t in = { {2,2}, {1,2}, {0,1}, {1,0}, {0,0} };
+        const zdd res = zdd_from_sets(3, make_generator(in.begin(), in.end()));
+
+        const zdd expected = zdd_union(zdd_union(set({1,0}), set({2,0})), set({2}));
+        AssertThat(res, Is().EqualTo(expected));
+      });
+
+      it("ignores duplicate pairs and duplicate sets", [&]() {
+        const pairs_t in = { {0,3}, {1,1}, {0,3}, {2,3}, {1,3}, {1,1} };
+        const zdd res = zdd_from_sets(3, make_generator(in.begin(), in.end()));
+
+        const zdd expected = zdd_union(set({3}), set({3,1}));
+        AssertThat(res, Is().EqualTo(expected));
+      });
+
+      it("includes Ø for identifiers without pairs", [&]() {
+        const pairs_t in = { {0,2}, {2,1}, {2,2} };
+        const zdd res = zdd_from_sets(3, make_generator(in.begin(), in.end()));
+
+        const zdd expected = zdd_union(zdd_union(set({2}), set({2,1})), zdd_null());
+        AssertThat(res, Is().EqualTo(expected));
+      });
+
+      it("creates sets that share both prefixes and suffixes", [&]() {
+        const pairs_t in = {
+          {0,0}, {0,1}, {0,4},
+          {1,0}, {1,2}, {1,4},
+          {2,0}, {2,1}, {2,3}, {2,4},
+          {3,3}, {3,4},
+          {4,0},
+        };
+        const zdd res = zdd_from_sets(5, make_generator(in.begin(), in.end()));
+
+        const zdd expected = zdd_union(zdd_union(zdd_union(set({4,1,0}), set({4,2,0})),
+                                                 zdd_union(set({4,3,1,0}), set({4,3}))),
+                                       set({0}));
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(zdd_nodecount(res), Is().EqualTo(zdd_nodecount(expected)));
+      });
+
+      it("throws if a set identifier is out of range", [&]() {
+        const pairs_t in = { {0,0}, {2,1} };
+        AssertThrows(invalid_argument,
+                     zdd_from_sets(2, make_generator(in.begin(), in.end())));
+      });
+
+      it("throws if a label is too large", [&]() {
+        const pairs_t in = { {0, zdd::max_label+1} };
+        AssertThrows(invalid_argument,
+                     zdd_from_sets(1, make_generator(in.begin(), in.end())));
+      });
+    });
+
+    describe("zdd_atmost(vars, k) / zdd_exactly(vars, k)", [&]() {
+      using vars_t = std::vector<zdd::label_type>;
+
+      // Family with a single set (with its elements in descending order)
+      const auto set = [](std::vector<zdd::label_type> vars) {
+        return zdd(zdd_vars(vars.begin(), vars.end()));
+      };
+
+      it("creates { Ø } for no variables", [&]() {
+        const vars_t vars = {};
+        AssertThat(zdd_isnull(zdd_atmost(vars.begin(), vars.end(), 2)), Is().True());
+        AssertThat(zdd_isnull(zdd_exactly(vars.begin(), vars.end(), 0)), Is().True());
+      });
+
+      it("creates Ø if k exceeds the number of variables", [&]() {
+        const vars_t vars = { 1, 0 };
+        AssertThat(zdd_isempty(zdd_exactly(vars.begin(), vars.end(), 3)), Is().True());
+      });
+
+      it("creates { Ø, {0}, {1} } for [1, 0] and k = 1", [&]() {
+        const vars_t vars = { 1, 0 };
+        const zdd res = zdd_atmost(vars.begin(), vars.end(), 1);
+
+        node_test_stream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(1, node::max_id, terminal_T, terminal_T)));
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(0, node::max_id,
+                                                ptr_uint64(1, ptr_uint64::max_id),
+                                                terminal_T)));
+
+        AssertThat(ns.can_pull(), Is().False());
+
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("creates { Ø, {0}, {1}, {2} } for [2, 1, 0] and k = 1", [&]() {
+        const vars_t vars = { 2, 1, 0 };
+        const zdd res = zdd_atmost(vars.begin(), vars.end(), 1);
+
+        const zdd expected = zdd_union(zdd_union(zdd_null(), set({0})),
+                                       zdd_union(set({1}), set({2})));
+
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("creates { {0,1}, {0,2}, {1,2} } for [2, 1, 0] and k = 2", [&]() {
+        const vars_t vars = { 2, 1, 0 };
+        const zdd res = zdd_exactly(vars.begin(), vars.end(), 2);
+
+        const zdd expected = zdd_union(zdd_union(set({1,0}), set({2,0})), set({2,1}));
+
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("throws if variables are not in descending order", [&]() {
+        const vars_t vars = { 0, 1 };
+        AssertThrows(invalid_argument, zdd_exactly(vars.begin(), vars.end(), 1));
+      });
+    });
+
+    describe("zdd_linear_leq(terms, bound)", [&]() {
+      using terms_t = std::vector<pair<zdd::label_type, uint64_t>>;
+
+      // Family with a single set (with its elements in descending order)
+      const auto set = [](std::vector<zdd::label_type> vars) {
+        return zdd(zdd_vars(vars.begin(), vars.end()));
+      };
+
+      it("creates all sets with weight at most 3 for [(2,2), (1,3), (0,1)]", [&]() {
+        const terms_t terms = { {2, 2}, {1, 3}, {0, 1} };
+        const zdd res = zdd_linear_leq(terms.begin(), terms.end(), 3);
+
+        const zdd expected = zdd_union(zdd_union(zdd_union(zdd_null(), set({0})),
+                                                 zdd_union(set({2}), set({2,0}))),
+                                       set({1}));
+
+        AssertThat(res, Is().EqualTo(expected));
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("merges budgets that suffice for all variables below [2^i x_i <= 2^40 - 2]", [&]() {
+        terms_t terms;
+        for (zdd::label_type x = 40; 0 < x; --x) { terms.push_back({x-1, uint64_t(1) << (x-1)}); }
+
+        // All but the set of all variables
+        const zdd res = zdd_linear_leq(terms.begin(), terms.end(), (uint64_t(1) << 40) - 2u);
+        AssertThat(zdd_size(res), Is().EqualTo((uint64_t(1) << 40) - 1u));
+        AssertThat(zdd_iscanonical(res), Is().True());
+      });
+
+      it("throws if labels are not in descending order", [&]() {
+        const terms_t terms = { {0, 1}, {2, 1} };
+        AssertThrows(invalid_argument, zdd_linear_leq(terms.begin(), terms.end(), 1));
+      });
+    });
   });
  });
@@ -232,5 +232,112 @@ go_bandit([]() {
         AssertThat(zdd_contains(zdd_2, a.begin(), a.end()), Is().False());
       });
     });
+
+    describe("zdd_contains_many(A, n, sets, out)", [&]() {
+      // Flatten a batch of sets into (set, label) pairs
+      const auto flatten = [](const std::vector<std::vector<zdd::label_type>> &batch) {
+        std::vector<pair<size_t, zdd::label_type>> res;
+        for (size_t i = 0; i < batch.size(); ++i) {
+          for (const zdd::label_type x : batch[i]) { res.push_back({i, x}); }
+        }
+        return res;
+      };
+
+      const auto contains_many = [&](const zdd &A,
+                                     const std::vector<std::vector<zdd::label_type>> &batch) {
+        const std::vector<pair<size_t, zdd::label_type>> sets = flatten(batch);
+
+        std::vector<bool> res;
+        zdd_contains_many(A, batch.size(), make_generator(sets.begin(), sets.end()),
+                          [&res](const bool b) { res.push_back(b); });
+        return res;
+      };
+
+      it("returns nothing for an empty batch", [&]() {
+        AssertThat(contains_many(zdd(zdd_1), {}).size(), Is().EqualTo(0u));
+      });
+
+      it("returns false for all sets on Ø", [&]() {
+        const std::vector<bool> res = contains_many(zdd(zdd_F), { {}, {1, 42} });
+
+        AssertThat(res.size(), Is().EqualTo(2u));
+        AssertThat(res[0], Is().False());
+        AssertThat(res[1], Is().False());
+      });
+
+      it("returns true only for Ø on { Ø }", [&]() {
+        const std::vector<bool> res = contains_many(zdd(zdd_T), { {}, {1, 42}, {} });
+
+        AssertThat(res.size(), Is().EqualTo(3u));
+        AssertThat(res[0], Is().True());
+        AssertThat(res[1], Is().False());
+        AssertThat(res[2], Is().True());
+      });
+
+      it("answers all queries for [1]", [&]() {
+        const std::vector<std::vector<zdd::label_type>> batch = {
+          {}, {0}, {1}, {0,2}, {1,3}, {0,2,3}, {0,1,2}, {2}, {0,2,4}, {0,2,3,4}
+        };
+        const std::vector<bool> res = contains_many(zdd(zdd_1), batch);
+
+        const std::vector<bool> expected = {
+          true, false, false, true, true, true, false, false, false, false
+        };
+        AssertThat(res.size(), Is().EqualTo(expected.size()));
+        for (size_t i = 0; i < expected.size(); ++i) {
+          AssertThat(res[i], Is().EqualTo(expected[i]));
+        }
+      });
+
+      it("answers all queries for [2] as 'zdd_contains' does", [&]() {
+        const std::vector<std::vector<zdd::label_type>> batch = {
+          {}, {2}, {6}, {2,4}, {4,6}, {2,4,6}, {2,3,4}, {2,4,6,8}, {0,2,4}, {0,1,2,4}, {2,6}
+        };
+        const std::vector<bool> res = contains_many(zdd(zdd_2), batch);
+
+        AssertThat(res.size(), Is().EqualTo(batch.size()));
+        for (size_t i = 0; i < batch.size(); ++i) {
+          AssertThat(res[i],
+                     Is().EqualTo(zdd_contains(zdd_2, batch[i].begin(), batch[i].end())));
+        }
+      });
+
+      it("answers duplicate queries", [&]() {
+        const std::vector<bool> res = contains_many(zdd(zdd_2), { {2,4}, {2,4}, {4} });
+
+        AssertThat(res.size(), Is().EqualTo(3u));
+        AssertThat(res[0], Is().True());
+        AssertThat(res[1], Is().True());
+        AssertThat(res[2], Is().False());
+      });
+
+      it("throws if the sets are not in ascending order", [&]() {
+        const std::vector<pair<size_t, zdd::label_type>> sets = { {0, 4}, {0, 2} };
+
+        AssertThrows(invalid_argument,
+                     zdd_contains_many(zdd(zdd_2), 1, make_generator(sets.begin(), sets.end()),
+                                       [](const bool) { }));
+      });
+
+      it("throws if an identifier is out of range", [&]() {
+        const std::vector<pair<size_t, zdd::label_type>> sets = { {0, 2}, {1, 4} };
+
+        AssertThrows(invalid_argument,
+                     zdd_contains_many(zdd(zdd_2), 1, make_generator(sets.begin(), sets.end()),
+                                       [](const bool) { }));
+      });
+
+      it("throws on the same input for a terminal", [&]() {
+        const std::vector<pair<size_t, zdd::label_type>> unordered = { {0, 4}, {0, 2} };
+        AssertThrows(invalid_argument,
+                     zdd_contains_many(zdd(zdd_T), 1, make_generator(unordered.begin(), unordered.end()),
+                                       [](const bool) { }));
+
+        const std::vector<pair<size_t, zdd::label_type>> too_large = { {0, zdd::max_label + 1u} };
+        AssertThrows(invalid_argument,
+                     zdd_contains_many(zdd(zdd_F), 1, make_generator(too_large.begin(), too_large.end()),
+                                       [](const bool) { }));
+      });
+    });
   });
  });
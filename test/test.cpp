@@ -4,6 +4,8 @@
 
 #include "test.h"
 
+#include <adiar/internal/block_size.h>
+
 ////////////////////////////////////////////////////////////////////////////////
 // Adiar Initialization unit tests
 go_bandit([]() {
@@ -33,8 +35,48 @@ go_bandit([]() {
       adiar_init(1024 * 1024 * 1024);
     });
 
-    // TODO: more tests when 'https://github.com/thomasmoelhave/tpie/issues/265'
-    //       is resolved.
+    it("has the memory limit given to 'adiar_init()'", [&]() {
+      AssertThat(adiar_memory_limit(), Is().EqualTo(1024u * 1024u * 1024u));
+    });
+
+    it("throws exception when setting memory limit to 'minimum_memory - 1'", [&]() {
+      AssertThrows(invalid_argument, adiar_set_memory_limit(minimum_memory - 1));
+      AssertThat(adiar_memory_limit(), Is().EqualTo(1024u * 1024u * 1024u));
+    });
+
+    it("can shrink and grow the memory limit", [&]() {
+      adiar_set_memory_limit(minimum_memory);
+      AssertThat(adiar_memory_limit(), Is().EqualTo(minimum_memory));
+
+      adiar_set_memory_limit(1024 * 1024 * 1024);
+      AssertThat(adiar_memory_limit(), Is().EqualTo(1024u * 1024u * 1024u));
+    });
+
+    it("derives the block size from the new memory limit", [&]() {
+      adiar_set_memory_limit(minimum_memory);
+      AssertThat(internal::get_block_size(),
+                 Is().EqualTo(internal::recommended_block_size(minimum_memory)));
+
+      adiar_set_memory_limit(1024 * 1024 * 1024);
+      AssertThat(internal::get_block_size(),
+                 Is().EqualTo(internal::recommended_block_size(1024 * 1024 * 1024)));
+    });
+
+    it("has no disk limit by default", [&]() {
+      AssertThat(adiar_disk_limit(), Is().EqualTo(std::numeric_limits<size_t>::max()));
+    });
+
+    it("can set the disk limit", [&]() {
+      adiar_set_disk_limit(1024 * 1024);
+      AssertThat(adiar_disk_limit(), Is().EqualTo(1024u * 1024u));
+
+      adiar_set_disk_limit(std::numeric_limits<size_t>::max());
+      AssertThat(adiar_disk_limit(), Is().EqualTo(std::numeric_limits<size_t>::max()));
+    });
+
+    it("has a disk peak of at least the current disk usage", [&]() {
+      AssertThat(adiar_disk_peak(), Is().GreaterThanOrEqualTo(adiar_disk_usage()));
+    });
   });
 
   // Kill program immediately instead of trying to run crashing unit tests.
@@ -70,12 +112,16 @@ go_bandit([]() {
 
 #include "adiar/internal/data_structures/test_level_merger.cpp"
 #include "adiar/internal/data_structures/test_levelized_priority_queue.cpp"
+#include "adiar/internal/data_structures/test_radix_heap.cpp"
+#include "adiar/internal/data_structures/test_radix_sort.cpp"
+#include "adiar/internal/data_structures/test_shared_forest.cpp"
 
 #include "adiar/internal/test_dd_func.cpp"
 #include "adiar/internal/test_dot.cpp"
 #include "adiar/internal/test_util.cpp"
 
 #include "adiar/internal/algorithms/test_convert.cpp"
+#include "adiar/internal/algorithms/test_depth_first.cpp"
 #include "adiar/internal/algorithms/test_isomorphism.cpp"
 #include "adiar/internal/algorithms/test_nested_sweeping.cpp"
 #include "adiar/internal/algorithms/test_reduce.cpp"
@@ -93,6 +139,9 @@ go_bandit([]() {
 
 #include "adiar/bdd/test_apply.cpp"
 #include "adiar/bdd/test_build.cpp"
+#include "adiar/bdd/test_circuit.cpp"
+#include "adiar/bdd/test_cnf.cpp"
+#include "adiar/bdd/test_constrain.cpp"
 #include "adiar/bdd/test_count.cpp"
 #include "adiar/bdd/test_evaluate.cpp"
 #include "adiar/bdd/test_if_then_else.cpp"
@@ -105,6 +154,7 @@ go_bandit([]() {
 // Adiar ZDD unit tests
 #include "adiar/zdd/test_zdd.cpp"
 
+#include "adiar/zdd/test_algebra.cpp"
 #include "adiar/zdd/test_binop.cpp"
 #include "adiar/zdd/test_build.cpp"
 #include "adiar/zdd/test_change.cpp"
@@ -133,9 +183,26 @@ go_bandit([]() {
       AssertThat(domain_isset(), Is().False());
     });
 
-    it("throws exception when reinitialized", [&]() {
-      // TODO: remove when 'github.com/thomasmoelhave/tpie/issues/265' is fixed.
-      AssertThrows(runtime_error, adiar_init(minimum_memory));
+    it("throws exception when setting memory limit while not initialized", [&]() {
+      AssertThrows(runtime_error, adiar_set_memory_limit(minimum_memory));
+    });
+
+    it("can be reinitialized", [&]() {
+      adiar_init(minimum_memory);
+
+      AssertThat(adiar_initialized(), Is().True());
+      AssertThat(adiar_memory_limit(), Is().EqualTo(minimum_memory));
+      AssertThat(domain_isset(), Is().False());
+    });
+
+    it("can run algorithms after being reinitialized", [&]() {
+      {
+        const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+        AssertThat(bdd_satcount(f, 2), Is().EqualTo(1u));
+      }
+      adiar_deinit();
+
+      AssertThat(adiar_initialized(), Is().False());
     });
   });
  });